@@ -213,5 +213,11 @@ void USART2_IRQHandler(void)
 }
 
 /* USER CODE BEGIN 1 */
-
+/**
+  * @brief This function handles Flash global interrupt, used by the FOTA slot erases.
+  */
+void FLASH_IRQHandler(void)
+{
+  HAL_FLASH_IRQHandler();
+}
 /* USER CODE END 1 */
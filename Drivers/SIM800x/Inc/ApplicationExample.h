@@ -38,6 +38,9 @@
 //-----------------------------------
 #include "SIM800x.h"
 #include "JSON.h"
+#include "JSONBuilder.h"
+#include "JSONTemplate.h"
+#include "JSONStream.h"
 #include <stdint.h>
 //-----------------------------------
 
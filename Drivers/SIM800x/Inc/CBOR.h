@@ -0,0 +1,262 @@
+/**
+*************************************************************************
+*  	@file: CBOR.h
+*
+*  	@brief: Header file for the CBOR encoder and reader
+*  	@brief: This file provide function declarations, macros and constants
+*			used to serialize records into CBOR (RFC 8949), the binary
+*			counterpart of the JSON serialization functions (See JSON.h).
+*
+*	@note	Items are appended at the current byte position, the same way
+*			AddEntryToJsonObject does, with the buffer size checked before each write:
+*			- integers are written natively, in the shortest of 1, 2, 3 or 5 bytes
+*			- floats are written in half precision when it is exact, in single precision otherwise
+*			- maps and arrays are pre-sized, their item count is written first
+*			On failure the buffer and the position are left unchanged.
+*
+*	@note	Fixed-point values are written exactly as decimal fractions (tag 4,
+*			[exponent, mantissa]), e.g. 23.45 as [-2, 2345]. Items are read back with the
+*			Get...FromCbor functions, which only accept the definite lengths and the
+*			32-bit arguments this encoder writes.
+*
+*	@note	Typical record:
+*			- AddMapToCbor(buf, sizeof(buf), 4, &pos);
+*			- AddIntEntryToCborMap(buf, sizeof(buf), "RPM", 3500, &pos);
+*			- ...
+*			The HTTP "CONTENT" parameter should be "application/cbor".
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+#ifndef __CBOR_H
+#define __CBOR_H
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include <stdint.h>
+//==========================================================================//
+
+//==========================================================================//
+//								CBOR tokens									//
+//==========================================================================//
+#define CBOR_UINT				0x00		//!< Major type 0, unsigned integer
+#define CBOR_NINT				0x20		//!< Major type 1, negative integer
+#define CBOR_BYTES				0x40		//!< Major type 2, byte string
+#define CBOR_TEXT				0x60		//!< Major type 3, UTF-8 text string
+#define CBOR_ARRAY				0x80		//!< Major type 4, array
+#define CBOR_MAP				0xA0		//!< Major type 5, map
+#define CBOR_TAG				0xC0		//!< Major type 6, tagged item
+#define CBOR_SIMPLE				0xE0		//!< Major type 7, simple values and floats
+#define CBOR_FALSE				0xF4
+#define CBOR_TRUE				0xF5
+#define CBOR_NULL				0xF6
+#define CBOR_HALF				0xF9
+#define CBOR_FLOAT				0xFA
+#define CBOR_DECIMAL			4			//!< Tag of a decimal fraction
+//==========================================================================//
+
+//===================================
+/**
+* @brief				: Add an unsigned integer
+* @param	Cbor		: Pointer to a byte array to store the item in
+* @param	Size		: Size of the byte array
+* @param	value		: Value to add
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full
+*/
+extern uint8_t AddUIntToCbor(uint8_t * Cbor, uint16_t Size, uint32_t value, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Add a signed integer
+* @param	Cbor		: Pointer to a byte array to store the item in
+* @param	Size		: Size of the byte array
+* @param	value		: Value to add
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full
+*/
+extern uint8_t AddIntToCbor(uint8_t * Cbor, uint16_t Size, int32_t value, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Add a floating point number
+* @param	Cbor		: Pointer to a byte array to store the item in
+* @param	Size		: Size of the byte array
+* @param	value		: Value to add
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full
+*/
+extern uint8_t AddFloatToCbor(uint8_t * Cbor, uint16_t Size, float value, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Add a text string
+* @param	Cbor		: Pointer to a byte array to store the item in
+* @param	Size		: Size of the byte array
+* @param	text		: Null terminated UTF-8 string
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full
+*/
+extern uint8_t AddTextToCbor(uint8_t * Cbor, uint16_t Size, const char * text, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Add a byte string
+* @param	Cbor		: Pointer to a byte array to store the item in
+* @param	Size		: Size of the byte array
+* @param	data		: Pointer to the bytes to add
+* @param	len			: Number of bytes to add
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full
+*/
+extern uint8_t AddBytesToCbor(uint8_t * Cbor, uint16_t Size, const uint8_t * data, uint16_t len, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Add a boolean
+* @param	Cbor		: Pointer to a byte array to store the item in
+* @param	Size		: Size of the byte array
+* @param	value		: 0 for false, true otherwise
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full
+*/
+extern uint8_t AddBoolToCbor(uint8_t * Cbor, uint16_t Size, uint8_t value, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Add a null
+* @param	Cbor		: Pointer to a byte array to store the item in
+* @param	Size		: Size of the byte array
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full
+*/
+extern uint8_t AddNullToCbor(uint8_t * Cbor, uint16_t Size, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Start a map, to be followed by count key/value pairs
+* @param	Cbor		: Pointer to a byte array to store the item in
+* @param	Size		: Size of the byte array
+* @param	count		: Number of entries in the map
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full
+*/
+extern uint8_t AddMapToCbor(uint8_t * Cbor, uint16_t Size, uint16_t count, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Start an array, to be followed by count items
+* @param	Cbor		: Pointer to a byte array to store the item in
+* @param	Size		: Size of the byte array
+* @param	count		: Number of items in the array
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full
+*/
+extern uint8_t AddArrayToCbor(uint8_t * Cbor, uint16_t Size, uint16_t count, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Add a map entry with a text key and an integer value
+* @param	Cbor		: Pointer to a byte array to store the entry in
+* @param	Size		: Size of the byte array
+* @param	key			: Null terminated entry key
+* @param	value		: Entry value
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full (nothing written)
+*/
+extern uint8_t AddIntEntryToCborMap(uint8_t * Cbor, uint16_t Size, const char * key, int32_t value, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Add a map entry with a text key and a floating point value
+* @param	Cbor		: Pointer to a byte array to store the entry in
+* @param	Size		: Size of the byte array
+* @param	key			: Null terminated entry key
+* @param	value		: Entry value
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full (nothing written)
+*/
+extern uint8_t AddFloatEntryToCborMap(uint8_t * Cbor, uint16_t Size, const char * key, float value, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Add an exact decimal fraction, mantissa * 10^exponent
+* @param	Cbor		: Pointer to a byte array to store the item in
+* @param	Size		: Size of the byte array
+* @param	mantissa	: Value scaled by 10^-exponent (e.g. 2345 with exponent -2 for 23.45)
+* @param	exponent	: Power of ten
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full (nothing written)
+*/
+extern uint8_t AddDecimalToCbor(uint8_t * Cbor, uint16_t Size, int32_t mantissa, int8_t exponent, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Read an item head
+* @param	Cbor		: Pointer to a byte array that contains the items
+* @param	Size		: Number of bytes in the byte array
+* @param	major		: Pointer to the major type to fill (CBOR_UINT ... CBOR_SIMPLE)
+* @param	arg			: Pointer to the argument to fill: value, length, count, tag, simple value
+*						  or float bits
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, truncated, 64-bit or indefinite length item
+*/
+extern uint8_t GetHeadFromCbor(const uint8_t * Cbor, uint16_t Size, uint8_t * major, uint32_t * arg, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Read a signed integer
+* @param	Cbor		: Pointer to a byte array that contains the items
+* @param	Size		: Number of bytes in the byte array
+* @param	value		: Pointer to the value to fill
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, not an integer or out of range (position unchanged)
+*/
+extern uint8_t GetIntFromCbor(const uint8_t * Cbor, uint16_t Size, int32_t * value, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Read a decimal fraction, or an integer as a fraction with a zero exponent
+* @param	Cbor		: Pointer to a byte array that contains the items
+* @param	Size		: Number of bytes in the byte array
+* @param	mantissa	: Pointer to the mantissa to fill
+* @param	exponent	: Pointer to the exponent to fill
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, not a decimal fraction or out of range (position unchanged)
+*/
+extern uint8_t GetDecimalFromCbor(const uint8_t * Cbor, uint16_t Size, int32_t * mantissa, int8_t * exponent, uint16_t *Cpos);
+//===================================
+
+#endif	/* __CBOR_H */
@@ -8,6 +8,12 @@
 *			**The parser is not fully compliant with ECMA 404, development is still ongoing.**
 *
 *	@note 	history:
+*				- 10/18/2026: v0.3
+*                   * Released as source (JSON.c), built with the project instead of libLightJSONParser.a
+*                   * Strings are skipped whole while looking for an item, escaped quotes included
+*                   * GetKeyFromJsonEntry and GetValueFromJsonEntry null terminate their output,
+*                     and return 1 on a malformed entry
+*
 *				- 03/25/2023: v0.2
 *                   * Modified AddEntryToJsonObject function to automatically make keys strings.
 *                   * Changed char pointer variable type from unsigned char to unsigned short
@@ -0,0 +1,269 @@
+/**
+*************************************************************************
+*  	@file: JSONBuilder.h
+*
+*  	@brief: Header file for the JSON builder
+*  	@brief: This file provide function declarations, macros and constants
+*			used to serialize JSON documents into a bounded buffer.
+*
+*	@note	A builder context carries the buffer, its size, the write position and
+*			the nesting stack, so every append goes straight to the known position:
+*			building is linear in the output size, the output is never scanned again.
+*			- objects and arrays nest up to JSON_BUILDER_DEPTH levels
+*			- keys and string values are escaped (quote, backslash, control characters)
+*			- the output is always null terminated
+*			- an item that does not fit is not written at all, the builder keeps its
+*			  previous contents and reports the overflow until it is initialized again
+*
+*	@note	Numbers are formatted straight into the output by the typed appenders
+*			(JsonBuilderAddInt, JsonBuilderAddUInt, JsonBuilderAddFixed), two digits at a
+*			time from a digit-pair table: no sprintf, no floating point, a few bytes of stack.
+*
+*	@note	Dictionary mode: once a versioned key table is registered with
+*			JsonBuilderSetDictionary(), the builders initialized afterwards write the short
+*			alias of each key found in the table, or its index when it has no alias
+*			("Engine Temperature (C)" becomes "0"), and open each root object with a
+*			JSON_DICTIONARY_KEY entry holding the table version. Keys not found in the table
+*			are written as is. The calls are unchanged; JsonExpandKeys() (See JSONDictionary.h)
+*			restores the full keys on the server side.
+*
+*	@note	Typical record:
+*			- JsonBuilderInit(&builder, txmessage, sizeof(txmessage));
+*			- JsonBuilderBeginObject(&builder, NULL);
+*			- JsonBuilderAddInt(&builder, "RPM", rpm);
+*			- JsonBuilderEnd(&builder);
+*			- if(!JsonBuilderFinish(&builder)) send builder.len bytes
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+#ifndef __JSON_BUILDER_H
+#define __JSON_BUILDER_H
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include <stdint.h>
+//==========================================================================//
+
+//==========================================================================//
+//								Builder constants							//
+//==========================================================================//
+#ifndef JSON_BUILDER_DEPTH
+#define JSON_BUILDER_DEPTH		8			//!< Maximum nesting depth of objects and arrays
+#endif
+#define JSON_NUMBER_SIZE		12			//!< Longest formatted number: sign, 10 digits and a decimal point
+#define JSON_DICTIONARY_KEY		"$d"		//!< Key of the dictionary version entry
+//==========================================================================//
+
+//===================================
+/**
+* @brief	Dictionary entry
+*/
+typedef struct
+{
+	const char*	name;						//!< Full key
+	const char*	alias;						//!< Key written instead, or NULL to write the entry index
+}JsonKeyAlias;
+//===================================
+
+//===================================
+/**
+* @brief	Versioned key dictionary
+*/
+typedef struct
+{
+	uint16_t			version;			//!< Dictionary version, to be changed with its entries
+	uint8_t				count;				//!< Number of entries
+	const JsonKeyAlias*	keys;				//!< Entries
+}JsonDictionary;
+//===================================
+
+//===================================
+/**
+* @brief	JSON builder context
+*/
+typedef struct
+{
+	char*		buf;						//!< Output buffer
+	uint16_t	size;						//!< Output buffer size, including the null terminator
+	uint16_t	len;						//!< Output length, position of the next character
+	uint8_t		depth;						//!< Number of open objects and arrays
+	uint8_t		overflow;					//!< Set when an item did not fit
+	uint8_t		stack[JSON_BUILDER_DEPTH];	//!< Open containers, from the outermost
+	const JsonDictionary*	dict;			//!< Key dictionary, NULL for full keys
+}JsonBuilder;
+//===================================
+
+//===================================
+/**
+* @brief				: Register the key dictionary of the builders initialized afterwards
+* @param	dict		: Pointer to the dictionary, kept, or NULL to write full keys
+* @retval  				: none
+*/
+extern void JsonBuilderSetDictionary(const JsonDictionary * dict);
+//===================================
+
+//===================================
+/**
+* @brief				: Initialize a builder over an empty buffer
+* @param	builder		: Pointer to the builder context
+* @param	buf			: Pointer to the output buffer
+* @param	size		: Output buffer size, including the null terminator
+* @retval  				: none
+*/
+extern void JsonBuilderInit(JsonBuilder * builder, char * buf, uint16_t size);
+//===================================
+
+//===================================
+/**
+* @brief				: Open an object
+* @param	builder		: Pointer to the builder context
+* @param	key			: Entry key inside an object, ignored (may be NULL) inside an array or at the root
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full, too deep or misplaced
+*/
+extern uint8_t JsonBuilderBeginObject(JsonBuilder * builder, const char * key);
+//===================================
+
+//===================================
+/**
+* @brief				: Open an array
+* @param	builder		: Pointer to the builder context
+* @param	key			: Entry key inside an object, ignored (may be NULL) inside an array or at the root
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full, too deep or misplaced
+*/
+extern uint8_t JsonBuilderBeginArray(JsonBuilder * builder, const char * key);
+//===================================
+
+//===================================
+/**
+* @brief				: Close the innermost object or array
+* @param	builder		: Pointer to the builder context
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full or nothing open
+*/
+extern uint8_t JsonBuilderEnd(JsonBuilder * builder);
+//===================================
+
+//===================================
+/**
+* @brief				: Add a string value, escaped and quoted
+* @param	builder		: Pointer to the builder context
+* @param	key			: Entry key inside an object, ignored (may be NULL) inside an array or at the root
+* @param	value		: Null terminated string
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full or misplaced
+*/
+extern uint8_t JsonBuilderAddString(JsonBuilder * builder, const char * key, const char * value);
+//===================================
+
+//===================================
+/**
+* @brief				: Add a value written as is: number, true, false, null, or pre-serialized JSON
+* @param	builder		: Pointer to the builder context
+* @param	key			: Entry key inside an object, ignored (may be NULL) inside an array or at the root
+* @param	value		: Null terminated JSON value
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full or misplaced
+*/
+extern uint8_t JsonBuilderAddRaw(JsonBuilder * builder, const char * key, const char * value);
+//===================================
+
+//===================================
+/**
+* @brief				: Add a signed integer
+* @param	builder		: Pointer to the builder context
+* @param	key			: Entry key inside an object, ignored (may be NULL) inside an array or at the root
+* @param	value		: Value to add
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full or misplaced
+*/
+extern uint8_t JsonBuilderAddInt(JsonBuilder * builder, const char * key, int32_t value);
+//===================================
+
+//===================================
+/**
+* @brief				: Add an unsigned integer
+* @param	builder		: Pointer to the builder context
+* @param	key			: Entry key inside an object, ignored (may be NULL) inside an array or at the root
+* @param	value		: Value to add
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full or misplaced
+*/
+extern uint8_t JsonBuilderAddUInt(JsonBuilder * builder, const char * key, uint32_t value);
+//===================================
+
+//===================================
+/**
+* @brief				: Add a fixed-point number
+* @param	builder		: Pointer to the builder context
+* @param	key			: Entry key inside an object, ignored (may be NULL) inside an array or at the root
+* @param	value		: Value scaled by 10^decimals (e.g. 2345 with 2 decimals is written 23.45)
+* @param	decimals	: Number of decimals, 0 to 9, always written
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full, misplaced or too many decimals
+*/
+extern uint8_t JsonBuilderAddFixed(JsonBuilder * builder, const char * key, int32_t value, uint8_t decimals);
+//===================================
+
+//===================================
+/**
+* @brief				: Add a boolean
+* @param	builder		: Pointer to the builder context
+* @param	key			: Entry key inside an object, ignored (may be NULL) inside an array or at the root
+* @param	value		: 0 for false, true otherwise
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full or misplaced
+*/
+extern uint8_t JsonBuilderAddBool(JsonBuilder * builder, const char * key, uint8_t value);
+//===================================
+
+//===================================
+/**
+* @brief				: Add a null
+* @param	builder		: Pointer to the builder context
+* @param	key			: Entry key inside an object, ignored (may be NULL) inside an array or at the root
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full or misplaced
+*/
+extern uint8_t JsonBuilderAddNull(JsonBuilder * builder, const char * key);
+//===================================
+
+//===================================
+/**
+* @brief				: Check that the document is complete
+* @param	builder		: Pointer to the builder context
+* @retval  	0			: Document complete, builder->len characters long
+* @retval	1			: An item did not fit, or an object or array is still open
+*/
+extern uint8_t JsonBuilderFinish(JsonBuilder * builder);
+//===================================
+
+//===================================
+/**
+* @brief				: Format an unsigned integer backwards, ending at end, two digits at a time
+* @param	end			: Pointer past the last character to write
+* @param	value		: Value to format
+* @param	width		: Minimum number of digits, zero padded
+* @retval  				: Pointer to the first character written
+*/
+extern char * JsonFormatUInt(char * end, uint32_t value, uint8_t width);
+//===================================
+
+//===================================
+/**
+* @brief				: Format a fixed-point number backwards, ending at end
+* @param	end			: Pointer past the last character to write, at least JSON_NUMBER_SIZE characters after the
+*						  start of the buffer
+* @param	value		: Value scaled by 10^decimals
+* @param	decimals	: Number of decimals, 0 to 9
+* @retval  				: Pointer to the first character written
+*/
+extern char * JsonFormatFixed(char * end, int32_t value, uint8_t decimals);
+//===================================
+
+#endif	/* __JSON_BUILDER_H */
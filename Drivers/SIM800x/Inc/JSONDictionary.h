@@ -0,0 +1,52 @@
+/**
+*************************************************************************
+*  	@file: JSONDictionary.h
+*
+*  	@brief: Header file for the JSON key dictionary expansion
+*  	@brief: This file provide function declarations used to restore the
+*			full keys of a document written in dictionary mode (See JSONBuilder.h).
+*
+*	@note	The expansion is meant for the server side and for host tests, it is not
+*			needed on the device. The document is copied as is, except:
+*			- each key found as an alias (or as an index) in the dictionary is replaced
+*			  by its full key, written as is
+*			- each JSON_DICTIONARY_KEY entry is checked against the dictionary version,
+*			  then removed
+*			A document built with and without the dictionary expands to the same text.
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+#ifndef __JSON_DICTIONARY_H
+#define __JSON_DICTIONARY_H
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include <stdint.h>
+#include "JSONBuilder.h"
+#include "JSONTokenizer.h"
+//==========================================================================//
+
+//===================================
+/**
+* @brief				: Restore the full keys of a document written in dictionary mode
+* @param	dict		: Pointer to the dictionary the document was written with
+* @param	Json		: Pointer to a char array that contains the document
+* @param	len			: Document length in characters
+* @param	tokens		: Pointer to a token array, used to tokenize the document
+* @param	count		: Number of tokens in the array
+* @param	out			: Pointer to the output buffer, null terminated
+* @param	size		: Output buffer size, including the null terminator
+* @param	outlen		: Pointer to the output length to fill
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, invalid document, not enough tokens, version mismatch
+*						  or output buffer full
+*/
+extern uint8_t JsonExpandKeys(const JsonDictionary * dict, const char * Json, uint16_t len, JsonToken * tokens, uint16_t count,
+							  char * out, uint16_t size, uint16_t * outlen);
+//===================================
+
+#endif	/* __JSON_DICTIONARY_H */
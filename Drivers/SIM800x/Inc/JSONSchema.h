@@ -0,0 +1,349 @@
+/**
+*************************************************************************
+*  	@file: JSONSchema.h
+*
+*  	@brief: Header file for the record schemas
+*  	@brief: This file provide the macros used to generate, from a single
+*			record description, the record type, its JSON and CBOR serializers
+*			and the matching decoders.
+*
+*	@note	A record is described once, as a list of FIELD(type, name, "key") entries:
+*			- #define VEHICLE_RECORD(FIELD)									\
+*				FIELD(INT,	temperature,	"Engine Temperature (C)")			\
+*				FIELD(INT,	rpm,			"RPM")								\
+*				FIELD(FIX1,	speed,			"Vehicle Speed (MPH)")				\
+*				FIELD(INT,	fuel,			"Fuel Level (%)")
+*			- JSON_SCHEMA_DECLARE(VehicleRecord, VEHICLE_RECORD) in a header declares the
+*			  VehicleRecord type, its functions and its VehicleRecord_JSON_SIZE and
+*			  VehicleRecord_CBOR_SIZE buffer sizes
+*			- JSON_SCHEMA_DEFINE(VehicleRecord, VEHICLE_RECORD) in one source file defines
+*			  VehicleRecordToJson, VehicleRecordToCbor, VehicleRecordFromJson and
+*			  VehicleRecordFromCbor
+*
+*	@note	The constant parts of a record are built at compile time: the JSON serializer
+*			copies each ,"key": segment as a literal of known length, the CBOR serializer
+*			copies each key with its precomputed head, and the buffer size is checked
+*			once against the record worst case. Only the field values are formatted at run time,
+*			with the digit-pair formatter of the JSON builder.
+*
+*	@note	Field types:
+*			- INT		: int32_t
+*			- UINT		: uint32_t
+*			- BOOL		: uint8_t
+*			- FIX1..3	: int32_t scaled by 10, 100 or 1000, written with 1, 2 or 3 decimals in
+*						  JSON and as an exact decimal fraction in CBOR
+*			Keys are non-empty string literals of less than 256 characters, written as is.
+*
+*	@note	The decoders expect a flat object holding every field, in any order for JSON
+*			and in schema order for CBOR. They are meant to check the serializers
+*			and the server side in tests.
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+#ifndef __JSON_SCHEMA_H
+#define __JSON_SCHEMA_H
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include <stdint.h>
+#include <string.h>
+#include "JSONBuilder.h"
+#include "JSONTokenizer.h"
+#include "CBOR.h"
+//==========================================================================//
+
+//==========================================================================//
+//								Field types									//
+//==========================================================================//
+#define JSON_SCHEMA_CTYPE_INT					int32_t
+#define JSON_SCHEMA_CTYPE_UINT					uint32_t
+#define JSON_SCHEMA_CTYPE_BOOL					uint8_t
+#define JSON_SCHEMA_CTYPE_FIX1					int32_t
+#define JSON_SCHEMA_CTYPE_FIX2					int32_t
+#define JSON_SCHEMA_CTYPE_FIX3					int32_t
+
+#define JSON_SCHEMA_PUT_INT(p, v)				JsonSchemaPutFixed(p, v, 0)
+#define JSON_SCHEMA_PUT_UINT(p, v)				JsonSchemaPutUInt(p, v)
+#define JSON_SCHEMA_PUT_BOOL(p, v)				JsonSchemaPutBool(p, v)
+#define JSON_SCHEMA_PUT_FIX1(p, v)				JsonSchemaPutFixed(p, v, 1)
+#define JSON_SCHEMA_PUT_FIX2(p, v)				JsonSchemaPutFixed(p, v, 2)
+#define JSON_SCHEMA_PUT_FIX3(p, v)				JsonSchemaPutFixed(p, v, 3)
+
+#define JSON_SCHEMA_PARSE_INT(j, t, v)			JsonSchemaParseFixed(j, t, 0, v)
+#define JSON_SCHEMA_PARSE_UINT(j, t, v)			JsonSchemaParseUInt(j, t, v)
+#define JSON_SCHEMA_PARSE_BOOL(j, t, v)			JsonSchemaParseBool(j, t, v)
+#define JSON_SCHEMA_PARSE_FIX1(j, t, v)			JsonSchemaParseFixed(j, t, 1, v)
+#define JSON_SCHEMA_PARSE_FIX2(j, t, v)			JsonSchemaParseFixed(j, t, 2, v)
+#define JSON_SCHEMA_PARSE_FIX3(j, t, v)			JsonSchemaParseFixed(j, t, 3, v)
+
+#define JSON_SCHEMA_CBOR_INT(c, s, v, p)		AddIntToCbor(c, s, v, p)
+#define JSON_SCHEMA_CBOR_UINT(c, s, v, p)		AddUIntToCbor(c, s, v, p)
+#define JSON_SCHEMA_CBOR_BOOL(c, s, v, p)		AddBoolToCbor(c, s, v, p)
+#define JSON_SCHEMA_CBOR_FIX1(c, s, v, p)		AddDecimalToCbor(c, s, v, -1, p)
+#define JSON_SCHEMA_CBOR_FIX2(c, s, v, p)		AddDecimalToCbor(c, s, v, -2, p)
+#define JSON_SCHEMA_CBOR_FIX3(c, s, v, p)		AddDecimalToCbor(c, s, v, -3, p)
+
+#define JSON_SCHEMA_UNCBOR_INT(c, s, v, p)		JsonSchemaCborFixed(c, s, 0, v, p)
+#define JSON_SCHEMA_UNCBOR_UINT(c, s, v, p)		JsonSchemaCborUInt(c, s, v, p)
+#define JSON_SCHEMA_UNCBOR_BOOL(c, s, v, p)		JsonSchemaCborBool(c, s, v, p)
+#define JSON_SCHEMA_UNCBOR_FIX1(c, s, v, p)		JsonSchemaCborFixed(c, s, 1, v, p)
+#define JSON_SCHEMA_UNCBOR_FIX2(c, s, v, p)		JsonSchemaCborFixed(c, s, 2, v, p)
+#define JSON_SCHEMA_UNCBOR_FIX3(c, s, v, p)		JsonSchemaCborFixed(c, s, 3, v, p)
+
+#define JSON_SCHEMA_CBOR_MAX_INT				5	//!< Longest CBOR value
+#define JSON_SCHEMA_CBOR_MAX_UINT				5
+#define JSON_SCHEMA_CBOR_MAX_BOOL				1
+#define JSON_SCHEMA_CBOR_MAX_FIX1				8	//!< Tag, array, exponent and mantissa
+#define JSON_SCHEMA_CBOR_MAX_FIX2				8
+#define JSON_SCHEMA_CBOR_MAX_FIX3				8
+//==========================================================================//
+
+//==========================================================================//
+//								Field generators							//
+//==========================================================================//
+#define JSON_SCHEMA_SEGMENT(key)				",\"" key "\":"		//!< JSON key segment, the first comma becomes the opening brace
+#define JSON_SCHEMA_KEYLEN(key)					(sizeof(key) - 1)
+#define JSON_SCHEMA_KEYSKIP(key)				((JSON_SCHEMA_KEYLEN(key) < 24) ? 1 : 0)		//!< Unused byte of the CBOR key head
+#define JSON_SCHEMA_CBORKEY(name, key)			(&keys->name.head[JSON_SCHEMA_KEYSKIP(key)]), (uint16_t)(JSON_SCHEMA_KEYLEN(key) + 2 - JSON_SCHEMA_KEYSKIP(key))
+
+#define JSON_SCHEMA_COUNT(type, name, key)		+ 1
+#define JSON_SCHEMA_JSON_MAX(type, name, key)	+ (sizeof(JSON_SCHEMA_SEGMENT(key)) - 1) + JSON_NUMBER_SIZE
+#define JSON_SCHEMA_CBOR_MAX(type, name, key)	+ 2 + JSON_SCHEMA_KEYLEN(key) + JSON_SCHEMA_CBOR_MAX_##type
+#define JSON_SCHEMA_MEMBER(type, name, key)		JSON_SCHEMA_CTYPE_##type name;
+#define JSON_SCHEMA_KEY(type, name, key)		JSON_KEY(key),
+#define JSON_SCHEMA_CBORKEY_TYPE(type, name, key)	struct { uint8_t head[2]; char text[JSON_SCHEMA_KEYLEN(key)]; } name;
+#define JSON_SCHEMA_CBORKEY_INIT(type, name, key)	{ { (JSON_SCHEMA_KEYLEN(key) < 24) ? 0 : (CBOR_TEXT | 24), \
+														(uint8_t)((JSON_SCHEMA_KEYLEN(key) < 24) ? (CBOR_TEXT | JSON_SCHEMA_KEYLEN(key)) : JSON_SCHEMA_KEYLEN(key)) }, key },
+
+#define JSON_SCHEMA_TO_JSON(type, name, key)										\
+	memcpy(p, JSON_SCHEMA_SEGMENT(key), sizeof(JSON_SCHEMA_SEGMENT(key)) - 1);		\
+	p = JSON_SCHEMA_PUT_##type(p + sizeof(JSON_SCHEMA_SEGMENT(key)) - 1, record->name);
+
+#define JSON_SCHEMA_TO_CBOR(type, name, key)										\
+	memcpy(&Cbor[pos], JSON_SCHEMA_CBORKEY(name, key));								\
+	pos += JSON_SCHEMA_KEYLEN(key) + 2 - JSON_SCHEMA_KEYSKIP(key);					\
+	JSON_SCHEMA_CBOR_##type(Cbor, Size, record->name, &pos);
+
+#define JSON_SCHEMA_FROM_JSON(type, name, key)										\
+	if(JSON_SCHEMA_PARSE_##type(Json, &tokens[values[i++]], &record->name))			\
+		return 1;
+
+#define JSON_SCHEMA_FROM_CBOR(type, name, key)										\
+	if(JsonSchemaCborKey(Cbor, len, JSON_SCHEMA_CBORKEY(name, key), &pos) ||		\
+	   JSON_SCHEMA_UNCBOR_##type(Cbor, len, &record->name, &pos))					\
+		return 1;
+//==========================================================================//
+
+//==========================================================================//
+//								Schema generators							//
+//==========================================================================//
+/**
+* @brief	Declare the record type, its buffer sizes and its functions:
+*			- uint16_t NameToJson(const Name * record, char * Json, uint16_t Size)
+*			  Returns the document length, 0 when Size is less than Name_JSON_SIZE
+*			- uint16_t NameToCbor(const Name * record, uint8_t * Cbor, uint16_t Size)
+*			  Returns the encoding length, 0 when Size is less than Name_CBOR_SIZE
+*			- uint8_t NameFromJson(Name * record, const char * Json, uint16_t len)
+*			- uint8_t NameFromCbor(Name * record, const uint8_t * Cbor, uint16_t len)
+*			  Return 0 when every field was decoded, 1 otherwise
+*/
+#define JSON_SCHEMA_DECLARE(Name, SCHEMA)											\
+	typedef struct { SCHEMA(JSON_SCHEMA_MEMBER) } Name;								\
+	enum																			\
+	{																				\
+		Name##_FIELDS = 0 SCHEMA(JSON_SCHEMA_COUNT),								\
+		Name##_JSON_SIZE = 2 SCHEMA(JSON_SCHEMA_JSON_MAX),							\
+		Name##_CBOR_SIZE = 3 SCHEMA(JSON_SCHEMA_CBOR_MAX)							\
+	};																				\
+	extern uint16_t Name##ToJson(const Name * record, char * Json, uint16_t Size);	\
+	extern uint16_t Name##ToCbor(const Name * record, uint8_t * Cbor, uint16_t Size);\
+	extern uint8_t Name##FromJson(Name * record, const char * Json, uint16_t len);	\
+	extern uint8_t Name##FromCbor(Name * record, const uint8_t * Cbor, uint16_t len);
+
+/**
+* @brief	Define the functions declared by JSON_SCHEMA_DECLARE, in one source file
+*/
+#define JSON_SCHEMA_DEFINE(Name, SCHEMA)											\
+	static const struct Name##CborKeyTable { SCHEMA(JSON_SCHEMA_CBORKEY_TYPE) }		\
+		Name##CborKeys = { SCHEMA(JSON_SCHEMA_CBORKEY_INIT) };						\
+																					\
+	uint16_t Name##ToJson(const Name * record, char * Json, uint16_t Size)			\
+	{																				\
+		char *p = Json;																\
+																					\
+		if(Size < Name##_JSON_SIZE)													\
+			return 0;																\
+		SCHEMA(JSON_SCHEMA_TO_JSON)													\
+		Json[0] = '{';																\
+		*p++ = '}';																	\
+		*p = '\0';																	\
+		return (uint16_t)(p - Json);												\
+	}																				\
+																					\
+	uint16_t Name##ToCbor(const Name * record, uint8_t * Cbor, uint16_t Size)		\
+	{																				\
+		const struct Name##CborKeyTable *keys = &Name##CborKeys;					\
+		uint16_t pos = 0;															\
+																					\
+		if(Size < Name##_CBOR_SIZE)													\
+			return 0;																\
+		AddMapToCbor(Cbor, Size, Name##_FIELDS, &pos);								\
+		SCHEMA(JSON_SCHEMA_TO_CBOR)													\
+		return pos;																	\
+	}																				\
+																					\
+	uint8_t Name##FromJson(Name * record, const char * Json, uint16_t len)			\
+	{																				\
+		static const JsonKey keys[] = { SCHEMA(JSON_SCHEMA_KEY) };					\
+		JsonToken tokens[1 + 2 * Name##_FIELDS];									\
+		int16_t values[Name##_FIELDS];												\
+		uint8_t i = 0;																\
+																					\
+		if((TokenizeJson(Json, len, tokens, 1 + 2 * Name##_FIELDS) < 1) ||			\
+		   (FindJsonKeys(Json, tokens, 0, keys, Name##_FIELDS, values) != Name##_FIELDS))	\
+			return 1;																\
+		SCHEMA(JSON_SCHEMA_FROM_JSON)												\
+		return 0;																	\
+	}																				\
+																					\
+	uint8_t Name##FromCbor(Name * record, const uint8_t * Cbor, uint16_t len)		\
+	{																				\
+		const struct Name##CborKeyTable *keys = &Name##CborKeys;					\
+		uint16_t pos = 0;															\
+		uint32_t count;																\
+		uint8_t major;																\
+																					\
+		if(GetHeadFromCbor(Cbor, len, &major, &count, &pos) || (major != CBOR_MAP) || (count != Name##_FIELDS))	\
+			return 1;																\
+		SCHEMA(JSON_SCHEMA_FROM_CBOR)												\
+		return (pos != len);														\
+	}
+//==========================================================================//
+
+//===================================
+/**
+* @brief				: Write a fixed-point number
+* @param	p			: Pointer to the output, JSON_NUMBER_SIZE characters available
+* @param	value		: Value scaled by 10^decimals
+* @param	decimals	: Number of decimals, 0 to 9
+* @retval  				: Pointer past the last character written
+*/
+extern char * JsonSchemaPutFixed(char * p, int32_t value, uint8_t decimals);
+//===================================
+
+//===================================
+/**
+* @brief				: Write an unsigned integer
+* @param	p			: Pointer to the output, JSON_NUMBER_SIZE characters available
+* @param	value		: Value to write
+* @retval  				: Pointer past the last character written
+*/
+extern char * JsonSchemaPutUInt(char * p, uint32_t value);
+//===================================
+
+//===================================
+/**
+* @brief				: Write true or false
+* @param	p			: Pointer to the output, 5 characters available
+* @param	value		: 0 for false, true otherwise
+* @retval  				: Pointer past the last character written
+*/
+extern char * JsonSchemaPutBool(char * p, uint8_t value);
+//===================================
+
+//===================================
+/**
+* @brief				: Parse a fixed-point number token
+* @param	Json		: Pointer to the tokenized document
+* @param	token		: Pointer to the value token
+* @param	decimals	: Number of decimals of the result, 0 to 9
+* @param	value		: Pointer to the value to fill, scaled by 10^decimals
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, not a number, more decimals or out of range
+*/
+extern uint8_t JsonSchemaParseFixed(const char * Json, const JsonToken * token, uint8_t decimals, int32_t * value);
+//===================================
+
+//===================================
+/**
+* @brief				: Parse an unsigned integer token
+* @param	Json		: Pointer to the tokenized document
+* @param	token		: Pointer to the value token
+* @param	value		: Pointer to the value to fill
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, not an unsigned integer or out of range
+*/
+extern uint8_t JsonSchemaParseUInt(const char * Json, const JsonToken * token, uint32_t * value);
+//===================================
+
+//===================================
+/**
+* @brief				: Parse a boolean token
+* @param	Json		: Pointer to the tokenized document
+* @param	token		: Pointer to the value token
+* @param	value		: Pointer to the value to fill, 0 or 1
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, neither true nor false
+*/
+extern uint8_t JsonSchemaParseBool(const char * Json, const JsonToken * token, uint8_t * value);
+//===================================
+
+//===================================
+/**
+* @brief				: Check a CBOR map key against its precomputed encoding
+* @param	Cbor		: Pointer to a byte array that contains the items
+* @param	Size		: Number of bytes in the byte array
+* @param	key			: Pointer to the encoded key, head and text
+* @param	n			: Length of the encoded key
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, another key
+*/
+extern uint8_t JsonSchemaCborKey(const uint8_t * Cbor, uint16_t Size, const void * key, uint16_t n, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Read a fixed-point number, integer or decimal fraction
+* @param	Cbor		: Pointer to a byte array that contains the items
+* @param	Size		: Number of bytes in the byte array
+* @param	decimals	: Number of decimals of the result, 0 to 9
+* @param	value		: Pointer to the value to fill, scaled by 10^decimals
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, not a number, more decimals or out of range
+*/
+extern uint8_t JsonSchemaCborFixed(const uint8_t * Cbor, uint16_t Size, uint8_t decimals, int32_t * value, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Read an unsigned integer
+* @param	Cbor		: Pointer to a byte array that contains the items
+* @param	Size		: Number of bytes in the byte array
+* @param	value		: Pointer to the value to fill
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, not an unsigned integer
+*/
+extern uint8_t JsonSchemaCborUInt(const uint8_t * Cbor, uint16_t Size, uint32_t * value, uint16_t *Cpos);
+//===================================
+
+//===================================
+/**
+* @brief				: Read a boolean
+* @param	Cbor		: Pointer to a byte array that contains the items
+* @param	Size		: Number of bytes in the byte array
+* @param	value		: Pointer to the value to fill, 0 or 1
+* @param	Cpos		: Pointer to the current byte position in the byte array, updated
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, neither true nor false
+*/
+extern uint8_t JsonSchemaCborBool(const uint8_t * Cbor, uint16_t Size, uint8_t * value, uint16_t *Cpos);
+//===================================
+
+#endif	/* __JSON_SCHEMA_H */
@@ -0,0 +1,181 @@
+/**
+*************************************************************************
+*  	@file: JSONStream.h
+*
+*  	@brief: Header file for the JSON stream parser
+*  	@brief: This file provide function declarations, macros and constants
+*			used to parse a JSON document chunk by chunk, as it is received,
+*			without ever holding it whole in memory.
+*
+*	@note	The parser is event driven: it calls a user call-back for each key, each
+*			value, and at the beginning and end of each object and array. All of its
+*			state lives in the JsonStream context, so a document can be fed in chunks of
+*			any size, split anywhere (inside a key, a number or an escape sequence):
+*			- JsonStreamInit(&stream, callback, user);
+*			- JsonStreamFeed(&stream, chunk, len); as many times as needed
+*			- JsonStreamFinish(&stream); checks that the document is complete
+*
+*	@note	Keys and values are given to the call-back as null terminated strings,
+*			escapes decoded (UTF-8). The current key stays available in stream->key for the
+*			value and begin events that follow it; it is empty inside arrays. A string
+*			value longer than JSON_STREAM_TOKEN_SIZE is given in several events,
+*			stream->more being set on all but the last one. Keys longer than
+*			JSON_STREAM_KEY_SIZE and numbers longer than JSON_STREAM_TOKEN_SIZE are errors.
+*
+*	@note	JsonStreamSink() has the SIM800xHTTPStreamCallBack prototype: once a stream is
+*			bound with JsonStreamSetSink(), it is used directly as the sink of
+*			SIM800xHTTPStreamRead() or of a resumable download, so a response is parsed
+*			as it comes out of AT+HTTPREAD.
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+#ifndef __JSON_STREAM_H
+#define __JSON_STREAM_H
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include <stdint.h>
+//==========================================================================//
+
+//==========================================================================//
+//								Stream constants							//
+//==========================================================================//
+#ifndef JSON_STREAM_KEY_SIZE
+#define JSON_STREAM_KEY_SIZE	32			//!< Longest key, in bytes
+#endif
+#ifndef JSON_STREAM_TOKEN_SIZE
+#define JSON_STREAM_TOKEN_SIZE	64			//!< Longest number, and string value fragment, in bytes
+#endif
+#define JSON_STREAM_DEPTH		32			//!< Maximum nesting depth of objects and arrays
+#if (JSON_STREAM_KEY_SIZE > JSON_STREAM_TOKEN_SIZE) || (JSON_STREAM_KEY_SIZE > 255)
+#error "JSON_STREAM_KEY_SIZE must not exceed JSON_STREAM_TOKEN_SIZE, nor 255"
+#endif
+//==========================================================================//
+
+//==========================================================================//
+//								Stream errors								//
+//==========================================================================//
+#define JSON_STREAM_ERROR_NOMEM		-1		//!< Key, number or nesting too large
+#define JSON_STREAM_ERROR_INVALID	-2		//!< Invalid character or structure
+#define JSON_STREAM_ERROR_PARTIAL	-3		//!< Document ends before its last value
+#define JSON_STREAM_ERROR_ABORTED	-4		//!< Stopped by the call-back
+//==========================================================================//
+
+//===================================
+/**
+* @brief	JSON stream events
+*/
+typedef enum
+{
+	JSON_EVENT_BEGIN_OBJECT	= 1,
+	JSON_EVENT_END_OBJECT	= 2,
+	JSON_EVENT_BEGIN_ARRAY	= 3,
+	JSON_EVENT_END_ARRAY	= 4,
+	JSON_EVENT_KEY			= 5,
+	JSON_EVENT_STRING		= 6,
+	JSON_EVENT_NUMBER		= 7,			//!< Given as written, e.g. -12.5e3
+	JSON_EVENT_TRUE			= 8,
+	JSON_EVENT_FALSE		= 9,
+	JSON_EVENT_NULL			= 10
+}JsonStreamEvent;
+//===================================
+
+typedef struct JsonStream JsonStream;
+
+//===================================
+/**
+* @brief				: Event call-back type
+* @param	stream		: Pointer to the stream context
+* @param	event		: JsonStreamEvent
+* @param	data		: Null terminated key or value, empty for the begin and end events
+* @param	len			: Key or value length in bytes
+* @retval  	0			: Continue
+* @retval	1			: Abort the parsing
+*/
+typedef uint8_t (*JsonStreamCallBack)(JsonStream * stream, uint8_t event, const char * data, uint16_t len);
+//===================================
+
+//===================================
+/**
+* @brief	JSON stream context
+*/
+struct JsonStream
+{
+	JsonStreamCallBack	callback;						//!< Event call-back
+	void*				user;							//!< User data, for the call-back
+	uint32_t			offset;							//!< Number of bytes fed
+	uint32_t			stack;							//!< Open containers, one bit per level, set for an object
+	uint8_t				depth;							//!< Number of open objects and arrays
+	uint8_t				state;							//!< Parser state
+	uint8_t				flags;							//!< Parser flags
+	int8_t				error;							//!< 0, or first error met (JSON_STREAM_ERROR_...)
+	uint8_t				more;							//!< Set on a string value event continued by the next one
+	uint8_t				hex;							//!< Number of \u escape digits read
+	uint16_t			unicode;						//!< \u escape being read
+	uint16_t			surrogate;						//!< High surrogate waiting for its low surrogate, or 0
+	uint16_t			len;							//!< Current token length
+	uint8_t				keylen;							//!< Current key length
+	char				key[JSON_STREAM_KEY_SIZE + 1];	//!< Current key, null terminated
+	char				token[JSON_STREAM_TOKEN_SIZE + 1];	//!< Current token, null terminated when given
+};
+//===================================
+
+//===================================
+/**
+* @brief				: Initialize a stream before a new document
+* @param	stream		: Pointer to the stream context
+* @param	callback	: Event call-back
+* @param	user		: User data, for the call-back
+* @retval  				: none
+*/
+extern void JsonStreamInit(JsonStream * stream, JsonStreamCallBack callback, void * user);
+//===================================
+
+//===================================
+/**
+* @brief				: Parse the next chunk of the document
+* @param	stream		: Pointer to the stream context
+* @param	data		: Pointer to the chunk
+* @param	len			: Chunk length in bytes
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, see stream->error. The following chunks are refused.
+*/
+extern uint8_t JsonStreamFeed(JsonStream * stream, const char * data, uint16_t len);
+//===================================
+
+//===================================
+/**
+* @brief				: Complete the document, giving a root number still open
+* @param	stream		: Pointer to the stream context
+* @retval  	0			: Document complete and valid
+* @retval	1			: Operation failed, see stream->error
+*/
+extern uint8_t JsonStreamFinish(JsonStream * stream);
+//===================================
+
+//===================================
+/**
+* @brief				: Bind the stream fed by JsonStreamSink
+* @param	stream		: Pointer to an initialized stream context
+* @retval  				: none
+*/
+extern void JsonStreamSetSink(JsonStream * stream);
+//===================================
+
+//===================================
+/**
+* @brief				: Feed the bound stream, SIM800xHTTPStreamCallBack prototype
+* @param	data		: Received data chunk
+* @param	len			: Chunk size in bytes
+* @param	offset		: Offset of the chunk in the document, must follow the previous chunk
+* @retval  	1			: Continue
+* @retval	0			: Abort the transfer, invalid document or gap in the offsets
+*/
+extern uint8_t JsonStreamSink(const uint8_t * data, uint16_t len, uint32_t offset);
+//===================================
+
+#endif	/* __JSON_STREAM_H */
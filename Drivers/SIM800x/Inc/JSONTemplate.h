@@ -0,0 +1,113 @@
+/**
+*************************************************************************
+*  	@file: JSONTemplate.h
+*
+*  	@brief: Header file for the JSON templates
+*  	@brief: This file provide function declarations, macros and constants
+*			used to build a JSON document once, then update its numbers in place.
+*
+*	@note	Periodic reports keep the same skeleton, only their numbers change. A template
+*			is built once with the JSON builder, numbers being added as fixed-width fields:
+*			each field records its offset and width in the document. Later reports only
+*			rewrite the digits of the fields, in the buffer that is sent:
+*			- nothing else is formatted, copied or scanned
+*			- the document length does not change, so the Content-Length, and the HTTP
+*			  parameters cached by the modem, stay the same from one report to the next
+*
+*	@note	Numbers are right-aligned and padded with leading spaces, which is valid JSON
+*			(leading zeros are not): "RPM":  350 then "RPM": 3500 for a 5 characters field.
+*			A value that does not fit its field is refused and the field keeps its previous value.
+*
+*	@note	Typical report:
+*			- JsonTemplateInit(&report, txmessage, sizeof(txmessage));
+*			- JsonBuilderBeginObject(&report.builder, NULL);
+*			- JsonTemplateAddNumber(&report, "RPM", 5, 0);				field 0
+*			- JsonBuilderEnd(&report.builder);
+*			- then on each report JsonTemplateSetNumber(&report, 0, rpm) and send
+*			  report.builder.len bytes of txmessage
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+#ifndef __JSON_TEMPLATE_H
+#define __JSON_TEMPLATE_H
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include <stdint.h>
+#include "JSONBuilder.h"
+//==========================================================================//
+
+//==========================================================================//
+//								Template constants							//
+//==========================================================================//
+#ifndef JSON_TEMPLATE_FIELDS
+#define JSON_TEMPLATE_FIELDS	8			//!< Maximum number of fields in a template
+#endif
+//==========================================================================//
+
+//===================================
+/**
+* @brief	Template field
+*/
+typedef struct
+{
+	uint16_t	offset;						//!< Offset of the field in the document
+	uint8_t		width;						//!< Field width in characters
+	uint8_t		decimals;					//!< Number of decimals
+}JsonTemplateField;
+//===================================
+
+//===================================
+/**
+* @brief	JSON template
+*/
+typedef struct
+{
+	JsonBuilder			builder;							//!< Builder of the document, holds its buffer and length
+	uint8_t				count;								//!< Number of fields
+	JsonTemplateField	fields[JSON_TEMPLATE_FIELDS];		//!< Fields, in order of addition
+}JsonTemplate;
+//===================================
+
+//===================================
+/**
+* @brief				: Initialize a template over an empty buffer
+* @param	tmpl		: Pointer to the template
+* @param	buf			: Pointer to the document buffer, the one that is sent
+* @param	size		: Document buffer size, including the null terminator
+* @retval  				: none
+*/
+extern void JsonTemplateInit(JsonTemplate * tmpl, char * buf, uint16_t size);
+//===================================
+
+//===================================
+/**
+* @brief				: Add a fixed-width number field, set to 0
+* @param	tmpl		: Pointer to the template
+* @param	key			: Entry key inside an object, ignored (may be NULL) inside an array or at the root
+* @param	width		: Field width in characters, sign and decimal point included, 1 to JSON_NUMBER_SIZE
+* @param	decimals	: Number of decimals, 0 to 9
+* @note					: Fields are numbered in order of addition, from 0.
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, buffer full, misplaced, too many fields or invalid width
+*/
+extern uint8_t JsonTemplateAddNumber(JsonTemplate * tmpl, const char * key, uint8_t width, uint8_t decimals);
+//===================================
+
+//===================================
+/**
+* @brief				: Rewrite a number field in place
+* @param	tmpl		: Pointer to the template
+* @param	field		: Field number
+* @param	value		: Value scaled by 10^decimals, the decimals given when the field was added
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, no such field or value too wide (field unchanged)
+*/
+extern uint8_t JsonTemplateSetNumber(JsonTemplate * tmpl, uint8_t field, int32_t value);
+//===================================
+
+#endif	/* __JSON_TEMPLATE_H */
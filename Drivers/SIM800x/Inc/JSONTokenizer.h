@@ -0,0 +1,217 @@
+/**
+*************************************************************************
+*  	@file: JSONTokenizer.h
+*
+*  	@brief: Header file for the JSON tokenizer
+*  	@brief: This file provide function declarations, macros and constants
+*			used to index a JSON document in a single pass, then access its
+*			entries and values without scanning it again.
+*
+*	@note	TokenizeJson() fills a caller-provided token array, in document order:
+*			- objects and arrays hold the number of their children (keys for an object)
+*			- an object key is a string token whose value is the next token
+*			- strings point inside the quotes, escapes are not decoded
+*			- each token knows where its subtree ends, so the next sibling is one lookup away
+*			Nothing is copied, values are returned as pointer/length views into the
+*			document, which must be kept unchanged.
+*
+*	@note	Unlike GetValueFromJsonArray and GetEntryFromJsonObject, iterating over the
+*			N children of a container by index is O(N): the last lookup is remembered,
+*			so the next index is a single step.
+*
+*	@note	Object values are looked up by key with JSON_KEY descriptors, whose hash is
+*			computed at compile time from the key literal (length, first, middle and
+*			last characters): a document key is only byte-compared when its hash matches.
+*			FindJsonKeys() fills a whole set of fields in one pass over the object.
+*			Document keys are compared as written, escapes are not decoded.
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+#ifndef __JSON_TOKENIZER_H
+#define __JSON_TOKENIZER_H
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include <stdint.h>
+//==========================================================================//
+
+//==========================================================================//
+//								Tokenizer errors							//
+//==========================================================================//
+#define JSON_ERROR_NOMEM		-1			//!< Not enough tokens
+#define JSON_ERROR_INVALID		-2			//!< Invalid character or structure
+#define JSON_ERROR_PARTIAL		-3			//!< Document ends before its last value
+//==========================================================================//
+
+//==========================================================================//
+//								Key lookup									//
+//==========================================================================//
+#define JSON_KEY_HASH(s)		(((uint32_t)(uint8_t)(sizeof(s) - 1) << 24) | ((uint32_t)(uint8_t)(s)[0] << 16) | \
+								((uint32_t)(uint8_t)(s)[(sizeof(s) - 1) / 2] << 8) | (uint32_t)(uint8_t)(s)[(sizeof(s) > 1) ? (sizeof(s) - 2) : 0])	//!< String literals only
+#define JSON_KEY(s)				{ (s), (uint16_t)(sizeof(s) - 1), JSON_KEY_HASH(s) }
+//==========================================================================//
+
+//===================================
+/**
+* @brief	JSON token types
+*/
+typedef enum
+{
+	JSON_TOKEN_OBJECT		= 1,
+	JSON_TOKEN_ARRAY		= 2,
+	JSON_TOKEN_STRING		= 3,
+	JSON_TOKEN_PRIMITIVE	= 4			//!< Number, true, false or null
+}JsonTokenType;
+//===================================
+
+//===================================
+/**
+* @brief	JSON token
+*/
+typedef struct
+{
+	uint8_t		type;					//!< JsonTokenType
+	int16_t		parent;					//!< Parent token: container, or key for an object value. -1 for the root
+	uint16_t	start;					//!< Offset of the token in the document (after the quote for strings)
+	uint16_t	len;					//!< Token length in characters (without the quotes for strings)
+	uint16_t	size;					//!< Number of children: object keys, array values, 1 for a key
+	uint16_t	end;					//!< Index of the first token after the subtree
+}JsonToken;
+//===================================
+
+//===================================
+/**
+* @brief	View of a part of a JSON document
+*/
+typedef struct
+{
+	const char*	ptr;
+	uint16_t	len;
+}JsonView;
+//===================================
+
+//===================================
+/**
+* @brief	Object key descriptor, to be initialized with JSON_KEY("key")
+*/
+typedef struct
+{
+	const char*	name;
+	uint16_t	len;
+	uint32_t	hash;
+}JsonKey;
+//===================================
+
+//===================================
+/**
+* @brief				: Tokenize a JSON document
+* @param	Json		: Pointer to a char array that contains the document
+* @param	len			: Document length in characters
+* @param	tokens		: Pointer to the token array to fill
+* @param	count		: Number of tokens in the array
+* @retval  	>= 0		: Number of tokens used, the root is token 0
+* @retval	< 0			: JSON_ERROR_NOMEM, JSON_ERROR_INVALID or JSON_ERROR_PARTIAL
+*/
+extern int16_t TokenizeJson(const char * Json, uint16_t len, JsonToken * tokens, uint16_t count);
+//===================================
+
+//===================================
+/**
+* @brief				: Get a child token of an object or an array
+* @param	tokens		: Pointer to a token array filled by TokenizeJson
+* @param	parent		: Index of the object or array token
+* @param	idx			: Zero base index of the child
+* @note					: The child of an object is the entry key, the entry value is the next token.
+* @retval  	>= 0		: Index of the child token
+* @retval	-1			: No such child
+*/
+extern int16_t GetJsonChild(const JsonToken * tokens, int16_t parent, uint16_t idx);
+//===================================
+
+//===================================
+/**
+* @brief				: Get the next sibling of a token (next array value, or next object key)
+* @param	tokens		: Pointer to a token array filled by TokenizeJson
+* @param	tok			: Index of an array value or of an object key
+* @retval  	>= 0		: Index of the next sibling
+* @retval	-1			: Last child
+*/
+extern int16_t GetNextJsonSibling(const JsonToken * tokens, int16_t tok);
+//===================================
+
+//===================================
+/**
+* @brief				: Get a value view from a tokenized JSON array
+* @param	Json		: Pointer to the tokenized document
+* @param	tokens		: Pointer to a token array filled by TokenizeJson
+* @param	array		: Index of the array token
+* @param	idx			: Zero base index of the value in the array
+* @param	value		: Pointer to the view to fill, strings are given without their quotes
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed
+*/
+extern uint8_t GetValueViewFromJsonArray(const char * Json, const JsonToken * tokens, int16_t array, uint16_t idx, JsonView * value);
+//===================================
+
+//===================================
+/**
+* @brief				: Get the entry views from a tokenized JSON object
+* @param	Json		: Pointer to the tokenized document
+* @param	tokens		: Pointer to a token array filled by TokenizeJson
+* @param	object		: Index of the object token
+* @param	idx			: Zero base index of the entry in the object
+* @param	key			: Pointer to the view to fill with the entry key
+* @param	value		: Pointer to the view to fill with the entry value
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed
+*/
+extern uint8_t GetEntryViewFromJsonObject(const char * Json, const JsonToken * tokens, int16_t object, uint16_t idx, JsonView * key, JsonView * value);
+//===================================
+
+//===================================
+/**
+* @brief				: Find an entry of a tokenized JSON object by key
+* @param	Json		: Pointer to the tokenized document
+* @param	tokens		: Pointer to a token array filled by TokenizeJson
+* @param	object		: Index of the object token
+* @param	key			: Pointer to the key descriptor
+* @retval  	>= 0		: Index of the entry value token
+* @retval	-1			: No such key
+*/
+extern int16_t FindJsonKey(const char * Json, const JsonToken * tokens, int16_t object, const JsonKey * key);
+//===================================
+
+//===================================
+/**
+* @brief				: Find several entries of a tokenized JSON object, in one pass over the object
+* @param	Json		: Pointer to the tokenized document
+* @param	tokens		: Pointer to a token array filled by TokenizeJson
+* @param	object		: Index of the object token
+* @param	keys		: Pointer to the key descriptors
+* @param	count		: Number of key descriptors
+* @param	values		: Pointer to an array of count token indexes, filled with the entry value
+*						  tokens, -1 for the keys not found
+* @retval  				: Number of keys found
+*/
+extern uint8_t FindJsonKeys(const char * Json, const JsonToken * tokens, int16_t object, const JsonKey * keys, uint8_t count, int16_t * values);
+//===================================
+
+//===================================
+/**
+* @brief				: Get an entry value view from a tokenized JSON object, by key
+* @param	Json		: Pointer to the tokenized document
+* @param	tokens		: Pointer to a token array filled by TokenizeJson
+* @param	object		: Index of the object token
+* @param	key			: Pointer to the key descriptor
+* @param	value		: Pointer to the view to fill with the entry value
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, no such key
+*/
+extern uint8_t GetValueViewFromJsonKey(const char * Json, const JsonToken * tokens, int16_t object, const JsonKey * key, JsonView * value);
+//===================================
+
+#endif	/* __JSON_TOKENIZER_H */
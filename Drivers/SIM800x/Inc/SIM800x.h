@@ -45,6 +45,21 @@ extern "C" {
 #include "SIM800x_IP.h"
 #include "SIM800x_GPRS.h"
 #include "SIM800x_HTTP.h"
+#include "SIM800x_HTTPCache.h"
+#include "SIM800x_HTTPS.h"
+#include "SIM800x_HTTPSession.h"
+#include "SIM800x_HTTPStream.h"
+#include "SIM800x_HTTPDownload.h"
+#include "SIM800x_Batch.h"
+#include "SIM800x_Compress.h"
+#include "SIM800x_CRC.h"
+#include "SIM800x_FOTA.h"
+#include "SIM800x_FlashQueue.h"
+#include "SIM800x_PPP.h"
+#include "SIM800x_AT.h"
+#include "SIM800x_TCPIP.h"
+#include "SIM800x_MQTT.h"
+#include "SIM800x_CoAP.h"
 #include "SIM800x_3GPPTS270057.h"
 #include "SIM800x_V25Ter.h"
 #include <stdio.h>
@@ -0,0 +1,159 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_AT.h
+ * @author          Firmware-Engineers
+ * @brief           Header file for SIM800 series modems AT command channel helpers
+ * @brief           This file provides function definitions used by the API
+ *                  modules built on top of the SDM, to issue AT commands, read
+ *                  response lines and dispatch unsolicited result codes (URC).
+ *
+ * @note            URC handlers are registered once by each module needing them
+ *                  (ex. "+RECEIVE" for TCP/IP connections). Every line read through
+ *                  this file that is not the expected response, is offered to
+ *                  the registered handlers.
+ *
+ * @brief           Supported devices are listed below.
+ * @brief           See dependencies in the include section.
+ *
+ * @note            History:
+ *                   - October 18, 2026: Initial release
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; </center></h2>
+ *
+ *
+ ******************************************************************************
+ */
+
+#ifndef __SIM800X_AT_H
+#define	__SIM800X_AT_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------
+#include <stdint.h>
+#include "SIM800x_Types.h"
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       URC handler type
+ * @param[in]   line: received line (null terminated string, without CR/LF).
+ * @retval      - 1: line consumed by the handler
+ *              - 0: line not handled
+ * @note        A handler may read extra raw bytes from the SDM (ex. "+RECEIVE" payload).
+ */
+typedef uint8_t (*SIM800xATURCHandler)(const char* line);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Register a URC handler
+ * @param[in]   handler: URC handler
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success, or handler already registered
+ *              - SIM800X_ERROR: handler table full (see CONFIG_AT_MAX_URC_HANDLERS)
+ */
+extern SIM800x_APIStatusType SIM800xATRegisterURC(SIM800xATURCHandler handler);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Offer a received line to the registered URC handlers
+ * @param[in]   line: received line (null terminated string, without CR/LF).
+ * @retval      - 1: line consumed by a handler
+ *              - 0: line not handled
+ */
+extern uint8_t SIM800xATDispatch(const char* line);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Read the next non-empty line received from the modem
+ * @param[out]  line: line read (null terminated string, without CR/LF).
+ * @param[in]   size: size of "line" in bytes. Longer lines are truncated.
+ * @param[in]   tout: time-out value in milliseconds.
+ * @note        The data prompt ('>') is returned as a line, since it is not
+ *              followed by a line terminator.
+ * @retval      - line length
+ *              - -1: time-out
+ */
+extern int SIM800xATReadLine(char* line, uint16_t size, uint32_t tout);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Send an AT command and wait for the final result code
+ * @param[in]   cmd: AT command, without the trailing CR (null terminated string).
+ * @param[in]   prefix: information response prefix (ex. "+CIFSR"), or NULL.
+ * @param[out]  resp: first line starting with "prefix" (null terminated string), or NULL.
+ * @param[in]   size: size of "resp" in bytes.
+ * @param[in]   tout: maximum response time in milliseconds.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed
+ *              - SIM800X_CME_ERROR: ME error
+ */
+extern SIM800x_APIStatusType SIM800xATCommand(const char* cmd, const char* prefix, char* resp, uint16_t size, uint32_t tout, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Wait for a line starting with the given prefix
+ * @param[in]   prefix: expected line prefix (null terminated string).
+ * @param[out]  line: matching line (null terminated string), or NULL.
+ * @param[in]   size: size of "line" in bytes.
+ * @param[in]   tout: time-out value in milliseconds.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: line received
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: "ERROR" received instead
+ *              - SIM800X_CME_ERROR: ME error received instead
+ */
+extern SIM800x_APIStatusType SIM800xATWaitLine(const char* prefix, char* line, uint16_t size, uint32_t tout, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Dispatch every complete line waiting in the receive FIFO to the URC handlers
+ * @param       none
+ * @retval      none
+ * @note        This function never blocks on a partially received line.
+ */
+extern void SIM800xATPoll(void);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Append a string to a command under construction
+ * @param[out]  dst: pointer to the end of the command (null terminator)
+ * @param[in]   src: string to append
+ * @retval      pointer to the new end of the command
+ */
+extern char* SIM800xATAppendStr(char* dst, const char* src);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Append an unsigned decimal number to a command under construction
+ * @param[out]  dst: pointer to the end of the command (null terminator)
+ * @param[in]   value: number to append
+ * @retval      pointer to the new end of the command
+ */
+extern char* SIM800xATAppendUInt(char* dst, uint32_t value);
+//-----------------------------------
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* __SIM800X_AT_H */
@@ -0,0 +1,160 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_Batch.h
+ * @author          Firmware-Engineers
+ * @brief           Header file for the telemetry batching layer
+ * @brief           This file provides function definitions used for packing many
+ *                  telemetry records into one HTTP POST request.
+ *
+ * @note            Records are appended to one of two CONFIG_BATCH_BUFFER_SIZE bytes
+ *                  buffers, either as a JSON array ("[rec,rec,...]") or as a binary
+ *                  frame (2-byte big-endian length before each record). A batch is
+ *                  sealed and sent over a managed session (See SIM800x_HTTPSession.h) when:
+ *                  - its size reaches the size threshold
+ *                  - its first record is older than the age threshold
+ *                  - a priority record is added
+ *                  - the next record does not fit
+ *                  New records go to the other buffer while a batch is in flight, or
+ *                  waits to be sent again after a failure.
+ *
+ * @note            The session "CONTENT" parameter must match the format
+ *                  ("application/json" or "application/octet-stream").
+ *
+ * @note            SIM800xBatchAdd() and SIM800xBatchPoll() must be called from the same
+ *                  context.
+ *
+ * @brief           Supported devices are listed below.
+ * @brief           See dependencies in the include section.
+ *
+ * @note            History:
+ *                   - October 18, 2026: Initial release
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; </center></h2>
+ *
+ *
+ ******************************************************************************
+ */
+
+#ifndef __SIM800X_BATCH_H
+#define	__SIM800X_BATCH_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------
+#include <stdint.h>
+#include "SIM800x_Types.h"
+#include "SIM800x_HTTPSession.h"
+//-----------------------------------
+
+/**
+  * @brief  Batch format type definition
+  */
+typedef enum
+{
+    //---------
+    BATCH_JSON_ARRAY                    = 0,                                    //!< Records are JSON values, sent as a JSON array
+    BATCH_BINARY                        = 1                                     //!< Records are length-prefixed binary frames
+    //---------
+}SIM800xBatchFormatType;
+//-----------------------------------
+
+/**
+  * @brief  Batch statistics type definition
+  */
+typedef struct
+{
+    //---------
+    uint32_t                batches;                                            //!< Batches sent
+    uint32_t                records;                                            //!< Records sent
+    uint32_t                bytes;                                              //!< Bytes sent
+    uint32_t                maxrecords;                                         //!< Largest batch, in records
+    uint32_t                latency;                                            //!< Sum of the batch latencies (first record added to batch sent), in milliseconds
+    uint32_t                maxlatency;                                         //!< Largest batch latency, in milliseconds
+    uint32_t                failures;                                           //!< Failed send attempts
+    uint32_t                dropped;                                            //!< Records rejected, both buffers being full
+    //---------
+}SIM800xBatchStatsType;
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Initialize the batching layer, pending records are discarded
+ * @param[in]   session: session used to send the batches (See SIM800xHTTPSessionInit()).
+ * @param[in]   format: batch format (See SIM800xBatchFormatType).
+ * @retval      none
+ * @note        Thresholds are set to CONFIG_BATCH_FLUSH_SIZE and CONFIG_BATCH_MAX_AGE.
+ */
+extern void SIM800xBatchInit(SIM800xHTTPSessionType* session, SIM800xBatchFormatType format);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Change the flush thresholds
+ * @param[in]   size: batch size in bytes. Supported values are:
+ *              - [1...CONFIG_BATCH_BUFFER_SIZE]
+ *
+ * @param[in]   age: maximum age of the first record in a batch, in milliseconds.
+ * @retval      none
+ */
+extern void SIM800xBatchSetThresholds(uint16_t size, uint32_t age);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Add a record
+ * @param[in]   record: record data, a JSON value in BATCH_JSON_ARRAY format.
+ * @param[in]   len: record size in bytes.
+ * @param[in]   priority: 1 to send the batch at the next SIM800xBatchPoll(), 0 otherwise.
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: record added
+ *              - SIM800X_BUSY: both buffers full, record dropped
+ *              - SIM800X_ERROR: record larger than a buffer
+ */
+extern SIM800x_APIStatusType SIM800xBatchAdd(const void* record, uint16_t len, uint8_t priority);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Seal the batch when a threshold is reached, and send the sealed batch
+ * @param[in]   tout: maximum response time in milliseconds (See SIM800xHTTPSessionRequest()).
+ * @param[out]  statuscode: HTTP(S) status code of the last request, or NULL.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: nothing to send, or batch sent (2xx status code)
+ *              - SIM800X_TIME_OUT: time-out, the batch is kept for the next call
+ *              - SIM800X_ERROR: failed, the batch is kept for the next call
+ *              - SIM800X_CME_ERROR: ME error, the batch is kept for the next call
+ */
+extern SIM800x_APIStatusType SIM800xBatchPoll(uint32_t tout, uint16_t* statuscode, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Seal the current batch, whatever the thresholds, and send it
+ * @retval      SIM800x_APIStatusType (See SIM800xBatchPoll())
+ */
+extern SIM800x_APIStatusType SIM800xBatchFlush(uint32_t tout, uint16_t* statuscode, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Get the batch statistics
+ * @param[out]  stats: statistics.
+ * @param[in]   reset: 1 to clear the statistics after reading them.
+ * @retval      none
+ */
+extern void SIM800xBatchGetStats(SIM800xBatchStatsType* stats, uint8_t reset);
+//-----------------------------------
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* __SIM800X_BATCH_H */
@@ -57,6 +57,118 @@ extern "C" {
   * @}
   */
 
+/** @defgroup CONFIG_API_PPP_CONSTANTS API PPP client configuration constants
+ * @{
+ *  
+ */     
+#define CONFIG_PPP_MRU                                          1500    //!< Maximum receive unit, sets the size of the PPP receive frame buffer
+#define CONFIG_PPP_RESTART_TIME                                 3000    //!< Configure/authenticate request retransmission time-out, in milliseconds
+#define CONFIG_PPP_MAX_CONFIGURE                                10      //!< Maximum number of configure/authenticate requests before giving up
+/**
+  * @}
+  */
+
+/** @defgroup CONFIG_API_TCPIP_CONSTANTS API AT channel and TCP/IP toolkit configuration constants
+ * @{
+ *  
+ */     
+#define CONFIG_AT_LINE_SIZE                                     80      //!< Maximum response line length handled by the AT channel helpers
+#define CONFIG_AT_MAX_URC_HANDLERS                              4       //!< Maximum number of registered URC handlers
+#define CONFIG_TCPIP_MAX_CONNECTIONS                            6       //!< Number of concurrent TCP/UDP connections. Supported values are: [1...6]
+#define CONFIG_TCPIP_QUICK_SEND                                 1       //!< Determine wether data sending completes once the modem buffers the data (AT+CIPQSEND=1), instead of once the server acknowledges it
+#define CONFIG_TCPIP_MANUAL_RECEIVE                             1       //!< Determine wether received data is kept by the modem until read (AT+CIPRXGET=1), instead of being pushed to the SDM receive FIFO
+#define CONFIG_TCPIP_RXGET_CHUNK                                256     //!< Maximum number of bytes pulled from the modem per AT+CIPRXGET=2 request. Supported values are: [1...1460]
+/**
+  * @}
+  */
+
+/** @defgroup CONFIG_API_MQTT_CONSTANTS API MQTT client configuration constants
+ * @{
+ *  
+ */     
+#define CONFIG_MQTT_PACKET_SIZE                                 256     //!< Maximum MQTT packet size, sets the size of the receive, transmit and inflight packet buffers
+#define CONFIG_MQTT_MAX_INFLIGHT                                4       //!< Maximum number of unacknowledged QoS 1 messages
+#define CONFIG_MQTT_RX_FIFO_SIZE                                512     //!< Size of the MQTT connection receive buffer (unused with CONFIG_TCPIP_MANUAL_RECEIVE)
+#define CONFIG_MQTT_RETRY_TIME                                  10000   //!< QoS 1 retransmission and PINGRESP time-out, in milliseconds
+/**
+  * @}
+  */
+
+/** @defgroup CONFIG_API_COAP_CONSTANTS API CoAP client configuration constants
+ * @{
+ *  
+ */     
+#define CONFIG_COAP_MAX_PENDING                                 4       //!< Size of the CON message retransmission table
+#define CONFIG_COAP_BLOCK_SIZE                                  256     //!< Maximum payload per message, larger bodies use block-wise transfer. Supported values are: 16, 32, 64, 128, 256, 512, 1024
+#define CONFIG_COAP_RX_FIFO_SIZE                                512     //!< Size of the CoAP connection receive buffer (unused with CONFIG_TCPIP_MANUAL_RECEIVE)
+#define CONFIG_COAP_ACK_TIMEOUT                                 2000    //!< Initial CON retransmission time-out, in milliseconds (ACK_TIMEOUT)
+#define CONFIG_COAP_MAX_RETRANSMIT                              4       //!< Maximum number of CON retransmissions (MAX_RETRANSMIT)
+/**
+  * @}
+  */
+
+/** @defgroup CONFIG_API_HTTP_STREAM_CONSTANTS API HTTP streaming configuration constants
+ * @{
+ *  
+ */     
+#define CONFIG_HTTP_STREAM_WINDOW                               256     //!< Number of bytes requested per AT+HTTPREAD window, keep it below the SDM receive FIFO size
+#define CONFIG_HTTP_STREAM_CHUNK                                64      //!< Maximum number of bytes handed to the call-back at once, sets the size of the chunk buffer
+#define CONFIG_HTTP_DOWNLOAD_RANGE                              4096    //!< Size of the ranges fetched by the resumable download manager, in bytes, and of its range buffer. Supported values are: [1...65535]
+/**
+  * @}
+  */
+
+/** @defgroup CONFIG_API_FOTA_CONSTANTS API firmware over-the-air update configuration constants
+ * @{
+ *  
+ */     
+#define CONFIG_FOTA_SLOT_ADDRESS                                0x08060000UL    //!< Update slot start address, keep in line with STM32F407VGTX_FLASH.ld
+#define CONFIG_FOTA_SLOT_FIRST_SECTOR                           7       //!< First flash sector of the update slot
+#define CONFIG_FOTA_SLOT_SECTORS                                3       //!< Number of flash sectors of the update slot
+#define CONFIG_FOTA_SECTOR_SIZE                                 0x20000UL       //!< Update slot sector size, in bytes
+#define CONFIG_FOTA_APP_ADDRESS                                 0x08004000UL    //!< Running firmware start address, after the boot sector, keep in line with STM32F407VGTX_FLASH.ld
+#define CONFIG_FOTA_APP_SIZE                                    0x5C000UL       //!< Running firmware size, in bytes, largest image
+#define CONFIG_FOTA_APP_FIRST_SECTOR                            1       //!< First flash sector of the running firmware, sector 0 holds the boot selector
+#define CONFIG_FOTA_APP_SECTORS                                 6       //!< Number of flash sectors of the running firmware, replaced by the boot selector
+#define CONFIG_FOTA_BUFFER_SIZE                                 256     //!< Size of each of the two image buffers, multiple of 4
+/**
+  * @}
+  */
+
+/** @defgroup CONFIG_API_BATCH_CONSTANTS API telemetry batching configuration constants
+ * @{
+ *  
+ */     
+#define CONFIG_BATCH_BUFFER_SIZE                                1024    //!< Size of each of the two batch buffers, in bytes
+#define CONFIG_BATCH_FLUSH_SIZE                                 768     //!< Default batch size threshold, in bytes
+#define CONFIG_BATCH_MAX_AGE                                    60000   //!< Default batch age threshold, in milliseconds
+/**
+  * @}
+  */
+
+/** @defgroup CONFIG_API_COMPRESS_CONSTANTS API request body compression configuration constants
+ * @{
+ *  
+ */     
+#define CONFIG_COMPRESS_WINDOW                                  1024    //!< LZ77 window size in bytes (maximum match distance), up to 32768
+#define CONFIG_COMPRESS_HASH_BITS                               8       //!< Hash table size, 2^bits positions of 4 bytes
+#define CONFIG_COMPRESS_CHUNK                                   64      //!< Size of the output chunks streamed to the modem
+/**
+  * @}
+  */
+
+/** @defgroup CONFIG_API_FLASHQUEUE_CONSTANTS API flash-backed store-and-forward queue configuration constants
+ * @{
+ *  
+ */     
+#define CONFIG_FLASHQUEUE_ADDRESS                               0x080C0000UL    //!< Queue start address, keep in line with STM32F407VGTX_FLASH.ld (STORAGE)
+#define CONFIG_FLASHQUEUE_FIRST_SECTOR                          10      //!< First flash sector of the queue
+#define CONFIG_FLASHQUEUE_SECTORS                               2       //!< Number of flash sectors of the queue, at least 2
+#define CONFIG_FLASHQUEUE_SECTOR_SIZE                           0x20000UL       //!< Queue sector size, in bytes
+/**
+  * @}
+  */
+
 /** @defgroup CONFIG_API_IO_CONSTANTS API I/O configuration constants
  * @{
  *  
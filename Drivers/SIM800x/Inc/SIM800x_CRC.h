@@ -0,0 +1,99 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_CRC.h
+ * @author          Firmware-Engineers
+ * @brief           Header file for the API checksum and digest helpers
+ * @brief           This file provides function definitions used for checking the
+ *                  integrity of downloaded and stored data.
+ *
+ * @note            CRC-32 is the IEEE 802.3 / zlib one (reflected, polynomial
+ *                  0xEDB88320), computed with a 16-entry table to keep the flash
+ *                  footprint small.
+ *
+ * @note            MD5 (RFC 1321) is used for the CHAP responses and the firmware
+ *                  image digests.
+ *
+ * @brief           Supported devices are listed below.
+ * @brief           See dependencies in the include section.
+ *
+ * @note            History:
+ *                   - October 18, 2026: Initial release
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; </center></h2>
+ *
+ *
+ ******************************************************************************
+ */
+
+#ifndef __SIM800X_CRC_H
+#define	__SIM800X_CRC_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------
+#include <stdint.h>
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Update a CRC-32 with a block of data
+ * @param[in]   crc: CRC-32 of the previous blocks, 0 for the first one.
+ * @param[in]   data: block data.
+ * @param[in]   len: block size in bytes.
+ * @retval      CRC-32 of the data seen so far
+ */
+extern uint32_t SIM800xCRC32(uint32_t crc, const void* data, uint32_t len);
+//-----------------------------------
+
+/**
+  * @brief  MD5 context type definition
+  */
+typedef struct
+{
+    //---------
+    uint32_t    state[4];
+    uint32_t    count;
+    uint8_t     block[64];
+    //---------
+}SIM800xMD5Type;
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Start an MD5 digest
+ * @param[out]  ctx: MD5 context.
+ * @retval      none
+ */
+extern void SIM800xMD5Init(SIM800xMD5Type* ctx);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Add data to an MD5 digest
+ * @param[in]   ctx: MD5 context.
+ * @param[in]   data: data.
+ * @param[in]   len: data size in bytes.
+ * @retval      none
+ */
+extern void SIM800xMD5Update(SIM800xMD5Type* ctx, const uint8_t* data, uint32_t len);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Complete an MD5 digest
+ * @param[in]   ctx: MD5 context.
+ * @param[out]  digest: 16-byte digest.
+ * @retval      none
+ */
+extern void SIM800xMD5Final(SIM800xMD5Type* ctx, uint8_t* digest);
+//-----------------------------------
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* __SIM800X_CRC_H */
@@ -0,0 +1,207 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_CoAP.h
+ * @author          Firmware-Engineers
+ * @brief           Header file for SIM800 series modems CoAP client (RFC 7252)
+ * @brief           This file provides function definitions used for sending CoAP
+ *                  requests over a UDP connection of the TCP/IP application toolkit
+ *                  (See SIM800x_TCPIP.h).
+ *
+ * @brief           Supported features are:
+ *                  - Confirmable (CON) and non-confirmable (NON) requests
+ *                  - Piggybacked and separate responses
+ *                  - Block-wise transfer of large request bodies (Block1, RFC 7959)
+ *                  - Retransmission of CON messages with exponential back-off, from a
+ *                    static table of CONFIG_COAP_MAX_PENDING messages
+ *
+ * @note            Requests are identified by their message ID, also used as the
+ *                  request token. Responses are delivered to the callback registered
+ *                  with SIM800xCoAPSetResponseCallBack().
+ *
+ * @brief           Supported devices are listed below.
+ * @brief           See dependencies in the include section.
+ *
+ * @note            History:
+ *                   - October 18, 2026: Initial release
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; </center></h2>
+ *
+ *
+ ******************************************************************************
+ */
+
+#ifndef __SIM800X_COAP_H
+#define	__SIM800X_COAP_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------
+#include <stdint.h>
+#include "SIM800x_Types.h"
+#include "SIM800x_TCPIP.h"
+//-----------------------------------
+
+/**
+  * @brief  CoAP message type definition
+  */
+typedef enum
+{
+    //---------
+    COAP_CON                            = 0,                                    //!< Confirmable, retransmitted until acknowledged
+    COAP_NON                            = 1                                     //!< Non-confirmable, sent once
+    //---------
+}SIM800xCoAPMsgType;
+//-----------------------------------
+
+/**
+  * @brief  CoAP request method type definition
+  */
+typedef enum
+{
+    //---------
+    COAP_GET                            = 1,
+    COAP_POST                           = 2,
+    COAP_PUT                            = 3,
+    COAP_DELETE                         = 4
+    //---------
+}SIM800xCoAPMethodType;
+//-----------------------------------
+
+/**
+  * @brief  CoAP content format type definition
+  */
+typedef enum
+{
+    //---------
+    COAP_FORMAT_TEXT                    = 0,                                    //!< text/plain;charset=utf-8
+    COAP_FORMAT_OCTET_STREAM            = 42,                                   //!< application/octet-stream
+    COAP_FORMAT_JSON                    = 50,                                   //!< application/json
+    COAP_FORMAT_CBOR                    = 60,                                   //!< application/cbor
+    COAP_FORMAT_NONE                    = 0xFFFF                                //!< No Content-Format option
+    //---------
+}SIM800xCoAPFormatType;
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Response reception call-back type
+ * @param[in]   msgid: message ID of the request.
+ * @param[in]   code: response code, class in bits 7-5 and detail in bits 4-0 (ex. 0x44 for 2.04 Changed).
+ *              0 when the request was not acknowledged after CONFIG_COAP_MAX_RETRANSMIT
+ *              retransmissions, or was reset by the server.
+ * @param[in]   payload: response payload, or NULL.
+ * @param[in]   len: payload size in bytes.
+ * @note        **payload is only valid for the duration of the call.**
+ */
+typedef void (*SIM800xCoAPResponseCallBack)(uint16_t msgid, uint8_t code, const uint8_t* payload, uint16_t len);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Register the response reception call-back
+ * @param[in]   cb: call-back function, or NULL to drop responses.
+ * @retval      none
+ */
+extern void SIM800xCoAPSetResponseCallBack(SIM800xCoAPResponseCallBack cb);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Open the UDP connection to the CoAP server
+ * @note        The TCP/IP application toolkit must be initialized beforehand, using SIM800xTCPIPInit().
+ * @param[in]   n: TCP/IP connection number used by the client. Supported values are:
+ *              - [0...CONFIG_TCPIP_MAX_CONNECTIONS-1]
+ *
+ * @param[in]   host: server IP address or domain name (null terminated string).
+ * @param[in]   port: server port (ex. 5683).
+ * @param[in]   tout: maximum time in milliseconds, to wait for the connection.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed
+ *              - SIM800X_CME_ERROR: ME error
+ */
+extern SIM800x_APIStatusType SIM800xCoAPOpen(uint8_t n, const char* host, uint16_t port, uint32_t tout, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Send a request
+ * @param[in]   method: request method (See SIM800xCoAPMethodType)
+ * @param[in]   path: resource path, ex. "sensors/temp" (null terminated string).
+ * @param[in]   format: payload content format (See SIM800xCoAPFormatType)
+ * @param[in]   payload: request payload, or NULL.
+ * @param[in]   len: payload size in bytes.
+ * @param[in]   type: message type (See SIM800xCoAPMsgType)
+ * @param[out]  msgid: message ID of the request, or NULL.
+ * @param[in]   tout: maximum time in milliseconds, for a block-wise transfer to complete.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: request sent
+ *              - SIM800X_BUSY: retransmission table full, call SIM800xCoAPPoll() and retry
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed, invalid parameter, or block-wise transfer rejected
+ *              - SIM800X_CME_ERROR: ME error
+ *
+ * @note        Payloads up to CONFIG_COAP_BLOCK_SIZE bytes are sent in a single message and the
+ *              function returns right away. Larger payloads are sent block by block as CON
+ *              messages (Block1 option), the function returns once the last block is acknowledged.
+ *              In both cases, the final response is delivered to the call-back, with "msgid"
+ *              being the message ID of the last block.
+ */
+extern SIM800x_APIStatusType SIM800xCoAPRequest(SIM800xCoAPMethodType method, const char* path, SIM800xCoAPFormatType format, const uint8_t* payload, uint32_t len, SIM800xCoAPMsgType type, uint16_t* msgid, uint32_t tout, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Process received messages and retransmissions
+ * @note        This function will:
+ *                  - Read the datagrams received on the connection and deliver responses to the call-back
+ *                  - Acknowledge CON responses, and reset unexpected CON requests
+ *                  - Retransmit unacknowledged CON messages, giving up after CONFIG_COAP_MAX_RETRANSMIT attempts
+ * @param       none
+ * @retval      none
+ *
+ * @note        This function should be called periodically while requests are pending.
+ */
+extern void SIM800xCoAPPoll(void);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Get the number of CON messages waiting for acknowledgment
+ * @param       none
+ * @retval      pending message count, [0...CONFIG_COAP_MAX_PENDING]
+ */
+extern uint8_t SIM800xCoAPPending(void);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Close the UDP connection
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed
+ *
+ * @note        Pending CON messages are dropped.
+ */
+extern SIM800x_APIStatusType SIM800xCoAPClose(uint16_t* errcode);
+//-----------------------------------
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* __SIM800X_COAP_H */
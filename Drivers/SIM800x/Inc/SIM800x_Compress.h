@@ -0,0 +1,99 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_Compress.h
+ * @author          Firmware-Engineers
+ * @brief           Header file for the request body compression
+ * @brief           This file provides function definitions used for compressing
+ *                  HTTP request bodies before they are sent to the modem.
+ *
+ * @note            Bodies are compressed in the zlib format (RFC 1950/1951), the
+ *                  "deflate" HTTP content coding: LZ77 over a CONFIG_COMPRESS_WINDOW
+ *                  bytes window, one hash table probe per position, and the fixed
+ *                  Huffman codes, so no tree is built or sent. No heap is used: the
+ *                  hash table (4 << CONFIG_COMPRESS_HASH_BITS bytes) and the output
+ *                  chunk are static, the body is matched in place.
+ *
+ * @note            AT+HTTPDATA needs the body size up front: SIM800xCompressWrite()
+ *                  runs the compressor twice, once to size the output, then again to
+ *                  stream it to the modem chunk by chunk (See SIM800xHTTPStreamWrite()).
+ *                  SIM800xCompress() compresses into a buffer instead, e.g. for
+ *                  SIM800xHTTPSessionRequest().
+ *
+ * @note            The server must be told about the coding, set COMPRESS_USERDATA as
+ *                  the "USERDATA" parameter (See SIM800xHTTPSessionSetUserData()), and
+ *                  only when the server supports it. Short or random bodies may grow,
+ *                  compare the sizes and send the body as is in that case.
+ *
+ * @brief           Supported devices are listed below.
+ * @brief           See dependencies in the include section.
+ *
+ * @note            History:
+ *                   - October 18, 2026: Initial release
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; </center></h2>
+ *
+ *
+ ******************************************************************************
+ */
+
+#ifndef __SIM800X_COMPRESS_H
+#define	__SIM800X_COMPRESS_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------
+#include <stdint.h>
+#include "SIM800x_Types.h"
+//-----------------------------------
+
+//-----------------------------------
+#define COMPRESS_USERDATA                   "Content-Encoding: deflate"         //!< "USERDATA" parameter announcing a compressed body
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Compress a body into a buffer
+ * @param[in]   src: body data.
+ * @param[in]   len: body size in bytes.
+ * @param[out]  dst: compressed data.
+ * @param[in]   size: dst size in bytes.
+ * @retval      Compressed size in bytes, 0 if larger than size
+ */
+extern uint32_t SIM800xCompress(const uint8_t* src, uint32_t len, uint8_t* dst, uint32_t size);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Get the compressed size of a body, without storing it
+ * @param[in]   src: body data.
+ * @param[in]   len: body size in bytes.
+ * @retval      Compressed size in bytes
+ */
+extern uint32_t SIM800xCompressSize(const uint8_t* src, uint32_t len);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Compress a body and stream it into the HTTP data buffer (AT+HTTPDATA)
+ * @param[in]   src: body data, kept unchanged until the function returns.
+ * @param[in]   len: body size in bytes.
+ * @param[in]   timeout: maximum time to input the data, in milliseconds (See SIM800xHTTPStreamWrite()).
+ * @param[out]  size: compressed size in bytes, or NULL.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType (See SIM800xHTTPStreamWrite())
+ *
+ * @note        To be followed by SIM800xHTTPAction() (POST).
+ */
+extern SIM800x_APIStatusType SIM800xCompressWrite(const uint8_t* src, uint32_t len, uint32_t timeout, uint32_t* size, uint16_t* errcode);
+//-----------------------------------
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* __SIM800X_COMPRESS_H */
@@ -0,0 +1,192 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_FOTA.h
+ * @author          Firmware-Engineers
+ * @brief           Header file for the firmware over-the-air update pipeline
+ * @brief           This file provides function definitions used for writing a
+ *                  firmware image received over HTTP into the inactive flash slot,
+ *                  verifying it and installing it at the next start-up.
+ *
+ * @note            Flash layout (See STM32F407VGTX_FLASH.ld):
+ *                  - Sector 0 (0x08000000, 16 Kbytes): boot selector, never erased
+ *                  - Sectors 1-6 (CONFIG_FOTA_APP_ADDRESS, 368 Kbytes): running firmware
+ *                  - Sectors 7-9 (CONFIG_FOTA_SLOT_ADDRESS, 384 Kbytes): update slot, the
+ *                    last FOTA_RECORD_SIZE bytes hold the boot record
+ *                  - Sectors 10-11 (0x080C0000, 256 Kbytes): data storage
+ *
+ * @note            SIM800xFOTAWrite() has the SIM800xHTTPStreamCallBack prototype, it can
+ *                  be used directly as the sink of SIM800xHTTPStreamRead() or of a
+ *                  resumable download (See SIM800x_HTTPDownload.h). Received data is
+ *                  gathered in two CONFIG_FOTA_BUFFER_SIZE bytes buffers: one is filled
+ *                  while the other one is programmed. SIM800xFOTAHALFlash programs one
+ *                  word (16 us) per status poll: every SIM800xFOTAWrite() and SIM800xFOTAPoll()
+ *                  call moves the programming on, the main loop polls between modem reads.
+ *
+ * @note            On the single bank STM32F407, the CPU stalls on flash reads while a
+ *                  sector is erased. SIM800xFOTABegin() therefore erases every slot sector
+ *                  the image needs (a few seconds) before returning, and must be called
+ *                  before the download starts; SIM800xFOTAWrite() and SIM800xFOTAPoll()
+ *                  only program, never erase, while modem data flows.
+ *
+ * @note            Flash accesses go through a SIM800xFOTAFlashType driver: SIM800xFOTAHALFlash
+ *                  on the target, or a simulated flash on a host build.
+ *
+ * @note            SIM800xFOTABoot() is the boot selector, the reset handler of the boot
+ *                  sector vector table. When the boot record holds a verified, not yet
+ *                  installed, image it copies it over the running firmware, then resets;
+ *                  it then starts the firmware at CONFIG_FOTA_APP_ADDRESS. The record is
+ *                  only marked installed once the copy is complete and read back, so a copy
+ *                  interrupted by a power loss is restarted at the next reset.
+ *
+ * @note            The boot sector is programmed once, with the debugger. Update images are
+ *                  the running firmware alone, without the boot sector:
+ *                  arm-none-eabi-objcopy -O binary -R .fotaboot SIM800xSTM32F4.elf image.bin
+ *
+ * @brief           Supported devices are listed below.
+ * @brief           See dependencies in the include section.
+ *
+ * @note            History:
+ *                   - October 18, 2026: Initial release
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; </center></h2>
+ *
+ *
+ ******************************************************************************
+ */
+
+#ifndef __SIM800X_FOTA_H
+#define	__SIM800X_FOTA_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------
+#include <stdint.h>
+#include "SIM800x_Types.h"
+//-----------------------------------
+
+//-----------------------------------
+#define FOTA_RECORD_SIZE                    32                                  //!< Boot record size, at the end of the update slot
+#define FOTA_DIGEST_SIZE                    16                                  //!< Image digest (MD5) size
+//-----------------------------------
+
+/**
+  * @brief  Flash operation status type definition
+  */
+typedef enum
+{
+    //---------
+    FOTA_FLASH_READY                    = 0,                                    //!< Last operation completed
+    FOTA_FLASH_BUSY                     = 1,                                    //!< Operation on-going
+    FOTA_FLASH_ERROR                    = 2                                     //!< Last operation failed
+    //---------
+}SIM800xFOTAFlashStatusType;
+//-----------------------------------
+
+/**
+  * @brief  Update slot flash driver type definition
+  * @note   Offsets are relative to the start of the slot. An operation is only started
+  *         when the previous one is completed.
+  */
+typedef struct
+{
+    //---------
+    uint8_t                     (*erase)(uint8_t sector);                       //!< Start erasing a slot sector, 1 if started
+    uint8_t                     (*program)(uint32_t offset, const uint8_t* data, uint16_t len); //!< Start programming len (multiple of 4) bytes, data is kept until completed, 1 if started
+    SIM800xFOTAFlashStatusType  (*status)(void);                                //!< Status of the last operation
+    const uint8_t*              slot;                                           //!< Slot contents, memory mapped
+    //---------
+}SIM800xFOTAFlashType;
+//-----------------------------------
+
+//-----------------------------------
+#if defined(HAL_FLASH_MODULE_ENABLED)
+extern const SIM800xFOTAFlashType SIM800xFOTAHALFlash;                          //!< STM32F4 HAL driver, needs FLASH_IRQHandler() to call HAL_FLASH_IRQHandler()
+#endif
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Start writing a new image to the update slot
+ * @param[in]   flash: slot flash driver.
+ * @param[in]   size: image size in bytes. Supported values are:
+ *              - [1...CONFIG_FOTA_APP_SIZE], and at most (CONFIG_FOTA_SLOT_SECTORS * CONFIG_FOTA_SECTOR_SIZE - FOTA_RECORD_SIZE)
+ *
+ * @param[in]   offset: number of bytes already written by a previous, interrupted, update
+ *              (See SIM800xFOTASync()), 0 for a new update. Must be a multiple of CONFIG_FOTA_BUFFER_SIZE.
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_ERROR: invalid size or offset, or flash error
+ * @note        Blocks until the slot sectors not yet holding image data are erased.
+ */
+extern SIM800x_APIStatusType SIM800xFOTABegin(const SIM800xFOTAFlashType* flash, uint32_t size, uint32_t offset);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Write image data
+ * @param[in]   data: image data.
+ * @param[in]   len: data size in bytes.
+ * @param[in]   offset: offset of the data in the image. Data already written is skipped,
+ *              a gap is an error.
+ * @retval      - 1: continue
+ *              - 0: failed, abort the transfer
+ * @note        Only waits when both buffers are full, for the flash to catch up.
+ */
+extern uint8_t SIM800xFOTAWrite(const uint8_t* data, uint16_t len, uint32_t offset);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Advance the programming pipeline, never waits
+ * @param       none
+ * @retval      SIM800xFOTAFlashStatusType: FOTA_FLASH_BUSY while work is pending
+ */
+extern SIM800xFOTAFlashStatusType SIM800xFOTAPoll(void);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Wait until every full buffer is programmed
+ * @param       none
+ * @retval      Number of image bytes in flash, to be saved to resume an interrupted update
+ *              (See SIM800xFOTABegin()), 0 on flash error
+ */
+extern uint32_t SIM800xFOTASync(void);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Complete the image, verify it and mark it for installation
+ * @param[in]   digest: expected image MD5 digest.
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: image verified, installed at the next reset
+ *              - SIM800X_ERROR: image incomplete, digest mismatch, or flash error
+ */
+extern SIM800x_APIStatusType SIM800xFOTAFinish(const uint8_t* digest);
+//-----------------------------------
+
+//-----------------------------------
+#if defined(HAL_FLASH_MODULE_ENABLED)
+/**
+ * @brief       Boot selector, installs a pending verified image then starts the running firmware
+ * @param       none
+ * @retval      none, never returns
+ * @note        Reset handler of the boot sector, not to be called by the firmware. Runs
+ *              before the C run-time initialization: it only uses the stack and registers.
+ */
+extern void SIM800xFOTABoot(void);
+#endif
+//-----------------------------------
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* __SIM800X_FOTA_H */
@@ -0,0 +1,172 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_FlashQueue.h
+ * @author          Firmware-Engineers
+ * @brief           Header file for the flash-backed store-and-forward queue
+ * @brief           This file provides function definitions used for keeping
+ *                  records in flash while the link is down, and draining them
+ *                  once it is back.
+ *
+ * @note            The queue is an append-only log over CONFIG_FLASHQUEUE_SECTORS flash
+ *                  sectors (sectors 10-11 by default, See STM32F407VGTX_FLASH.ld), used
+ *                  in turn so that they wear evenly. Each sector starts with a magic
+ *                  and a sequence number, each record is framed as:
+ *                  - length word: length | ~length << 16, checked at start-up
+ *                  - CRC-32 of the data, programmed after the data
+ *                  - consumed word: 0xFFFFFFFF, programmed to 0 once drained
+ *                  - data, padded to a word boundary
+ *                  The head and the tail are rebuilt from flash at start-up: a record
+ *                  torn by a reset fails its CRC and is skipped, a drain interrupted
+ *                  before its commit is sent again.
+ *
+ * @note            When the next sector still holds records, it is erased anyway: the
+ *                  oldest records are dropped and counted (See SIM800xFlashQueueGetStats()).
+ *
+ * @note            Drained records are read straight from flash: SIM800xFlashQueueProducer()
+ *                  has the SIM800xHTTPStreamProducer prototype and can feed
+ *                  SIM800xHTTPStreamWrite() directly. Records are sent back to back,
+ *                  store them self-delimited (e.g. JSON lines, length-prefixed frames).
+ *
+ * @note            Erases and programs are synchronous, the CPU stalls for about one
+ *                  second when a sector is erased. No other flash operation must be on-going
+ *                  (e.g. a FOTA sector erase).
+ *
+ * @brief           Supported devices are listed below.
+ * @brief           See dependencies in the include section.
+ *
+ * @note            History:
+ *                   - October 18, 2026: Initial release
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; </center></h2>
+ *
+ *
+ ******************************************************************************
+ */
+
+#ifndef __SIM800X_FLASHQUEUE_H
+#define	__SIM800X_FLASHQUEUE_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------
+#include <stdint.h>
+#include "SIM800x_Types.h"
+//-----------------------------------
+
+/**
+  * @brief  Queue flash driver type definition
+  * @note   Offsets are relative to the start of the queue, operations are synchronous.
+  */
+typedef struct
+{
+    //---------
+    uint8_t                 (*erase)(uint8_t sector);                           //!< Erase a queue sector, 1 on success
+    uint8_t                 (*program)(uint32_t offset, uint32_t word);         //!< Program a word, 1 on success
+    const uint8_t*          base;                                               //!< Queue contents, memory mapped
+    //---------
+}SIM800xFlashQueueFlashType;
+//-----------------------------------
+
+/**
+  * @brief  Queue statistics type definition
+  */
+typedef struct
+{
+    //---------
+    uint32_t                records;                                            //!< Records waiting
+    uint32_t                bytes;                                              //!< Data bytes waiting
+    uint32_t                dropped;                                            //!< Records dropped, sector reclaimed or write failure
+    uint32_t                corrupted;                                          //!< Records skipped, CRC mismatch
+    uint32_t                erases;                                             //!< Sector erases since start-up
+    //---------
+}SIM800xFlashQueueStatsType;
+//-----------------------------------
+
+//-----------------------------------
+#if defined(HAL_FLASH_MODULE_ENABLED)
+extern const SIM800xFlashQueueFlashType SIM800xFlashQueueHALFlash;              //!< STM32F4 HAL driver
+#endif
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Mount the queue, rebuilding the head and the tail from flash
+ * @param[in]   flash: queue flash driver.
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_ERROR: flash error
+ *
+ * @note        An unformatted queue is erased.
+ */
+extern SIM800x_APIStatusType SIM800xFlashQueueInit(const SIM800xFlashQueueFlashType* flash);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Append a record
+ * @param[in]   data: record data.
+ * @param[in]   len: record size in bytes. Supported values are:
+ *              - [1...(CONFIG_FLASHQUEUE_SECTOR_SIZE - 20)]
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_ERROR: invalid size, or flash error
+ */
+extern SIM800x_APIStatusType SIM800xFlashQueuePush(const void* data, uint16_t len);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Select the oldest records for a drain
+ * @param[in]   maxsize: maximum drain size in bytes.
+ * @param[out]  size: drain size in bytes, 0 if the queue is empty.
+ * @retval      Number of records selected
+ * @note        At least one record is selected when the queue is not empty, even if larger than maxsize.
+ */
+extern uint16_t SIM800xFlashQueueDrainBegin(uint32_t maxsize, uint32_t* size);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Hand the selected records, one per call, straight from flash
+ * @param[out]  data: set to the record data.
+ * @param[in]   offset: offset in the drain (unused, records are handed in order).
+ * @param[in]   remain: number of drain bytes left (unused).
+ * @retval      Record size, 0 when every selected record was handed
+ * @note        The drain restarts from the first selected record after SIM800xFlashQueueDrainBegin().
+ */
+extern uint16_t SIM800xFlashQueueProducer(const uint8_t** data, uint32_t offset, uint32_t remain);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Mark the selected records as consumed, once the server acknowledged them
+ * @param       none
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_ERROR: flash error
+ */
+extern SIM800x_APIStatusType SIM800xFlashQueueDrainCommit(void);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Get the queue statistics
+ * @param[out]  stats: statistics.
+ * @retval      none
+ */
+extern void SIM800xFlashQueueGetStats(SIM800xFlashQueueStatsType* stats);
+//-----------------------------------
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* __SIM800X_FLASHQUEUE_H */
@@ -0,0 +1,124 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_HTTPCache.h
+ * @author          Firmware-Engineers
+ * @brief           Header file for SIM800 series modems HTTP parameters shadow cache
+ * @brief           This file provides function definitions used for setting HTTP
+ *                  parameters (AT+HTTPPARA) only when their value changes.
+ *
+ * @note            The last value accepted by the modem for each parameter is kept as
+ *                  a 32-bit FNV-1a hash and a length, a set with the same value is
+ *                  skipped. The cache is invalidated by:
+ *                  - SIM800xHTTPCacheInit() and SIM800xHTTPCacheTerminate()
+ *                  - The "RDY" URC sent by the modem after a reset
+ *                  - SIM800xHTTPCacheInvalidate(), to be called when the HTTP service
+ *                    is initialized/terminated or the modem is reset by other means
+ *
+ * @brief           Supported devices are listed below.
+ * @brief           See dependencies in the include section.
+ *
+ * @note            History:
+ *                   - October 18, 2026: Initial release
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; </center></h2>
+ *
+ *
+ ******************************************************************************
+ */
+
+#ifndef __SIM800X_HTTPCACHE_H
+#define	__SIM800X_HTTPCACHE_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------
+#include <stdint.h>
+#include "SIM800x_Types.h"
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Initialize HTTP service (See SIM800xHTTPInit()) and invalidate the cache
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ * @retval      SIM800x_APIStatusType (See SIM800xHTTPInit())
+ */
+extern SIM800x_APIStatusType SIM800xHTTPCacheInit(uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Terminate HTTP service (See SIM800xHTTPTerminate()) and invalidate the cache
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ * @retval      SIM800x_APIStatusType (See SIM800xHTTPTerminate())
+ */
+extern SIM800x_APIStatusType SIM800xHTTPCacheTerminate(uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Forget every cached parameter value
+ * @param       none
+ * @retval      none
+ */
+extern void SIM800xHTTPCacheInvalidate(void);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Set bearer profile identifier, if changed (See SIM800xHTTPSetCID())
+ * @retval      SIM800x_APIStatusType: SIM800X_OK if unchanged, or see SIM800xHTTPSetCID()
+ */
+extern SIM800x_APIStatusType SIM800xHTTPCacheSetCID(uint8_t cid, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Set HTTP client URL, if changed (See SIM800xHTTPSetURL())
+ * @retval      SIM800x_APIStatusType: SIM800X_OK if unchanged, or see SIM800xHTTPSetURL()
+ */
+extern SIM800x_APIStatusType SIM800xHTTPCacheSetURL(const char* url, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Set user agent, if changed (See SIM800xHTTPSetUA())
+ * @retval      SIM800x_APIStatusType: SIM800X_OK if unchanged, or see SIM800xHTTPSetUA()
+ */
+extern SIM800x_APIStatusType SIM800xHTTPCacheSetUA(const char* ua, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Set Content-Type, if changed (See SIM800xHTTPSetContent())
+ * @retval      SIM800x_APIStatusType: SIM800X_OK if unchanged, or see SIM800xHTTPSetContent()
+ */
+extern SIM800x_APIStatusType SIM800xHTTPCacheSetContent(const char* content, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Set user data, if changed (See SIM800xHTTPSetUserData())
+ * @retval      SIM800x_APIStatusType: SIM800X_OK if unchanged, or see SIM800xHTTPSetUserData()
+ */
+extern SIM800x_APIStatusType SIM800xHTTPCacheSetUserData(const char* userdata, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Get the cache statistics
+ * @param[out]  hits: number of skipped sets, or NULL.
+ * @param[out]  misses: number of sets sent to the modem, or NULL.
+ * @retval      none
+ */
+extern void SIM800xHTTPCacheGetStats(uint32_t* hits, uint32_t* misses);
+//-----------------------------------
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* __SIM800X_HTTPCACHE_H */
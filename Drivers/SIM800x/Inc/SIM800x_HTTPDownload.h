@@ -0,0 +1,138 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_HTTPDownload.h
+ * @author          Firmware-Engineers
+ * @brief           Header file for SIM800 series modems resumable HTTP downloads
+ * @brief           This file provides function definitions used for fetching a
+ *                  large resource in fixed-size ranges ("BREAK"/"BREAKEND" HTTP
+ *                  parameters), resuming from the last good range.
+ *
+ * @note            Each range of CONFIG_HTTP_DOWNLOAD_RANGE bytes is requested with a
+ *                  GET over a managed session (See SIM800x_HTTPSession.h), streamed to
+ *                  a user sink (See SIM800x_HTTPStream.h) and verified against its
+ *                  expected CRC-32 (See SIM800x_CRC.h) before the progress is committed.
+ *                  The expected range CRC-32 list is required (e.g. fetched first from a
+ *                  small manifest resource): every byte is checked by its range, so a
+ *                  corrupted range is fetched again alone and the download never restarts
+ *                  from the beginning.
+ *                  The committed progress is handed to a user call-back, to be kept in
+ *                  non-volatile memory, and passed back to SIM800xHTTPDownloadInit()
+ *                  after a reset. A bearer drop or a failed range only restarts the
+ *                  current range.
+ *
+ * @note            A range is kept in a CONFIG_HTTP_DOWNLOAD_RANGE bytes buffer until it is
+ *                  verified: the sink only receives verified ranges, each once, in order.
+ *
+ * @note            The saved progress is trusted on resume: the data written before it is not
+ *                  read back. The sink must have stored a range before it returns, and keep
+ *                  its own state consistent with the saved progress (e.g. erase its storage
+ *                  when the download starts from the beginning).
+ *
+ * @brief           Supported devices are listed below.
+ * @brief           See dependencies in the include section.
+ *
+ * @note            History:
+ *                   - October 18, 2026: Initial release
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; </center></h2>
+ *
+ *
+ ******************************************************************************
+ */
+
+#ifndef __SIM800X_HTTPDOWNLOAD_H
+#define	__SIM800X_HTTPDOWNLOAD_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------
+#include <stdint.h>
+#include "SIM800x_Types.h"
+#include "SIM800x_HTTPSession.h"
+#include "SIM800x_HTTPStream.h"
+//-----------------------------------
+
+/**
+  * @brief  Download progress type definition, to be kept in non-volatile memory
+  */
+typedef struct
+{
+    //---------
+    uint32_t                offset;                                             //!< Size of the verified part of the resource
+    //---------
+}SIM800xHTTPDownloadProgressType;
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Progress commit call-back type
+ * @param[in]   progress: new progress, after a verified range.
+ * @retval      - 1: continue
+ *              - 0: abort the download
+ */
+typedef uint8_t (*SIM800xHTTPDownloadSaveCallBack)(const SIM800xHTTPDownloadProgressType* progress);
+//-----------------------------------
+
+/**
+  * @brief  Download type definition
+  */
+typedef struct
+{
+    //---------
+    SIM800xHTTPSessionType*             session;                                //!< Session, its URL is the resource
+    uint32_t                            size;                                   //!< Resource size in bytes
+    const uint32_t*                     crcs;                                   //!< Expected CRC-32 of each range
+    SIM800xHTTPStreamCallBack           sink;                                   //!< Data sink, offsets are resource offsets
+    SIM800xHTTPDownloadSaveCallBack     save;                                   //!< Progress commit call-back, or NULL
+    SIM800xHTTPDownloadProgressType     progress;                               //!< Current progress
+    //---------
+}SIM800xHTTPDownloadType;
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Initialize a download object, no command is sent to the modem
+ * @param[out]  dl: download object.
+ * @param[in]   session: initialized session (See SIM800xHTTPSessionInit()).
+ * @param[in]   size: resource size in bytes.
+ * @param[in]   crcs: CRC-32 of each CONFIG_HTTP_DOWNLOAD_RANGE bytes range, the last one
+ *              possibly shorter, kept by the object.
+ * @param[in]   sink: call-back receiving the data.
+ * @param[in]   save: call-back committing the progress, or NULL.
+ * @param[in]   resume: progress saved by a previous run, or NULL to start from the beginning.
+ *              An offset past the resource or not on a range boundary is ignored.
+ * @retval      none
+ */
+extern void SIM800xHTTPDownloadInit(SIM800xHTTPDownloadType* dl, SIM800xHTTPSessionType* session, uint32_t size, const uint32_t* crcs, SIM800xHTTPStreamCallBack sink, SIM800xHTTPDownloadSaveCallBack save, const SIM800xHTTPDownloadProgressType* resume);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Download the remaining ranges
+ * @param[in]   dl: download object.
+ * @param[in]   retries: maximum number of consecutive failed attempts for one range.
+ * @param[in]   tout: maximum response time per range, in milliseconds (See SIM800xHTTPAction()).
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: resource complete and verified
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed, aborted by a call-back, no range CRC-32 list, or a
+ *                range still corrupted after "retries" attempts
+ *              - SIM800X_CME_ERROR: ME error
+ *
+ * @note        Can be called again after a failure, the download resumes from dl->progress.
+ */
+extern SIM800x_APIStatusType SIM800xHTTPDownloadRun(SIM800xHTTPDownloadType* dl, uint8_t retries, uint32_t tout, uint16_t* errcode);
+//-----------------------------------
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* __SIM800X_HTTPDOWNLOAD_H */
@@ -0,0 +1,114 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_HTTPS.h
+ * @author          Firmware-Engineers
+ * @brief           Header file for SIM800 series modems HTTPS functions
+ * @brief           This file provides function definitions used for securing the
+ *                  HTTP service with SSL (AT+HTTPSSL, AT+SSLOPT, AT+SSLSETCERT).
+ *
+ * @note            SSL is enabled per HTTP service: it must be set after SIM800xHTTPInit(),
+ *                  and the SSL context is kept by the firmware until SIM800xHTTPTerminate().
+ *                  Use a managed session (See SIM800xHTTPSessionSetSSL()) to only set it up
+ *                  again when the HTTP service is restarted.
+ *
+ * @note            Certificates must be stored in the modem file system beforehand
+ *                  (AT+FSCREATE/AT+FSWRITE), and are only supported by firmwares with
+ *                  SSL certificate management (R14.18 onwards).
+ *
+ * @brief           Supported devices are listed below.
+ * @brief           See dependencies in the include section.
+ *
+ * @note            History:
+ *                   - October 18, 2026: Initial release
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; </center></h2>
+ *
+ *
+ ******************************************************************************
+ */
+
+#ifndef __SIM800X_HTTPS_H
+#define	__SIM800X_HTTPS_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------
+#include <stdint.h>
+#include "SIM800x_Types.h"
+//-----------------------------------
+
+/**
+  * @brief  SSL option type definition (AT+SSLOPT)
+  */
+typedef enum
+{
+    //---------
+    HTTPS_OPT_IGNORE_INVALID_CERT       = 0,                                    //!< Accept server certificates that fail the verification
+    HTTPS_OPT_CLIENT_AUTH               = 1                                     //!< Authenticate with the client certificate (See SIM800xHTTPSSetCert())
+    //---------
+}SIM800xHTTPSOptionType;
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Enable or disable SSL for the HTTP service
+ * @param[in]   enable: 1 to enable, 0 to disable.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed
+ *              - SIM800X_CME_ERROR: ME error
+ *
+ * @note        This function cannot be used when HTTP service is not initialized.
+ */
+extern SIM800x_APIStatusType SIM800xHTTPSSetSSL(uint8_t enable, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Read the SSL state of the HTTP service
+ * @param[out]  enable: 1 if enabled, 0 otherwise.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ * @retval      SIM800x_APIStatusType (See SIM800xHTTPSSetSSL())
+ */
+extern SIM800x_APIStatusType SIM800xHTTPSGetSSL(uint8_t* enable, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Set an SSL option
+ * @param[in]   option: option (See SIM800xHTTPSOptionType).
+ * @param[in]   enable: 1 to enable, 0 to disable.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ * @retval      SIM800x_APIStatusType (See SIM800xHTTPSSetSSL())
+ */
+extern SIM800x_APIStatusType SIM800xHTTPSSetOption(SIM800xHTTPSOptionType option, uint8_t enable, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Select the client certificate
+ * @param[in]   file: certificate file name in the modem file system (null terminated string).
+ * @param[in]   password: certificate password (null terminated string), or NULL.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: certificate loaded
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed, not supported by the firmware, or invalid certificate
+ *              - SIM800X_CME_ERROR: ME error
+ */
+extern SIM800x_APIStatusType SIM800xHTTPSSetCert(const char* file, const char* password, uint16_t* errcode);
+//-----------------------------------
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* __SIM800X_HTTPS_H */
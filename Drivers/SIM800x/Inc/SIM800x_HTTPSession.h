@@ -0,0 +1,212 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_HTTPSession.h
+ * @author          Firmware-Engineers
+ * @brief           Header file for SIM800 series modems managed HTTP session
+ * @brief           This file provides function definitions used for sending
+ *                  repeated HTTP requests without re-initializing the bearer, the
+ *                  HTTP service and the HTTP parameters before each request.
+ *
+ * @note            The session tracks which of the bearer, the HTTP service and the
+ *                  HTTP parameters are live, and only re-runs the invalidated parts
+ *                  before the next request. Parts are invalidated by:
+ *                  - The "+SAPBR <cid>: DEACT" URC (bearer)
+ *                  - HTTP status 601 Network Error (bearer)
+ *                  - HTTP status 604 Stack Busy and command failures (HTTP service)
+ *                  - URL or user data changes (HTTP parameters)
+ *                  - URL scheme or certificate changes (HTTP service)
+ *                  Invalidating a part also invalidates the parts depending on it.
+ *                  HTTP parameters are set through the shadow cache (See SIM800x_HTTPCache.h),
+ *                  only the values that changed are sent to the modem.
+ *                  With an "https://" URL, SSL is set up with the HTTP service (See SIM800x_HTTPS.h),
+ *                  the SSL context is then reused by every request until the service is restarted.
+ *
+ * @brief           Supported devices are listed below.
+ * @brief           See dependencies in the include section.
+ *
+ * @note            History:
+ *                   - October 18, 2026: Initial release
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; </center></h2>
+ *
+ *
+ ******************************************************************************
+ */
+
+#ifndef __SIM800X_HTTPSESSION_H
+#define	__SIM800X_HTTPSESSION_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------
+#include <stdint.h>
+#include "SIM800x_Types.h"
+//-----------------------------------
+
+/**
+  * @brief  HTTP session live parts type definition (bit flags)
+  */
+typedef enum
+{
+    //---------
+    HTTP_SESSION_BEARER                 = 0x01,                                 //!< Bearer profile activated
+    HTTP_SESSION_SERVICE                = 0x02,                                 //!< HTTP service initialized
+    HTTP_SESSION_PARAMS                 = 0x04,                                 //!< HTTP parameters set
+    HTTP_SESSION_ALL                    = 0x07
+    //---------
+}SIM800xHTTPSessionLiveType;
+//-----------------------------------
+
+/**
+  * @brief  HTTP session type definition
+  * @note   **Strings are referenced, not copied, they must remain valid while the session is used.**
+  */
+typedef struct
+{
+    //---------
+    uint8_t                 cid;                                                //!< Bearer profile id, [1...3]
+    const char*             apn;                                                //!< Access point name
+    const char*             url;                                                //!< HTTP "URL" parameter
+    const char*             content;                                            //!< HTTP "CONTENT" parameter, or NULL
+    const char*             userdata;                                           //!< HTTP "USERDATA" parameter, or NULL
+    const char*             cert;                                               //!< Client certificate file, or NULL
+    const char*             certpw;                                             //!< Client certificate password, or NULL
+    uint8_t                 ssl;                                                //!< SSL enabled, from the URL scheme
+    uint8_t                 live;                                               //!< Live parts (See SIM800xHTTPSessionLiveType)
+    //---------
+}SIM800xHTTPSessionType;
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Initialize a session object, no command is sent to the modem
+ * @param[out]  session: session object.
+ * @param[in]   cid: bearer profile id. Supported values are:
+ *              - [1...3]
+ *
+ * @param[in]   apn: access point name (null terminated string).
+ * @param[in]   url: server URL (null terminated string).
+ * @param[in]   content: Content-Type (null terminated string), or NULL for the modem default (text/plain).
+ * @retval      none
+ */
+extern void SIM800xHTTPSessionInit(SIM800xHTTPSessionType* session, uint8_t cid, const char* apn, const char* url, const char* content);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Change the session URL
+ * @param[in]   session: session object.
+ * @param[in]   url: server URL (null terminated string).
+ * @retval      none
+ * @note        The HTTP parameters are only set again if the URL differs, the HTTP
+ *              service is only restarted if the scheme (http/https) differs.
+ */
+extern void SIM800xHTTPSessionSetURL(SIM800xHTTPSessionType* session, const char* url);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Change the session user data (extra request header lines)
+ * @param[in]   session: session object.
+ * @param[in]   userdata: user data (null terminated string), or NULL for none: an empty
+ *              "USERDATA" parameter is then sent, clearing the previous header lines.
+ * @retval      none
+ */
+extern void SIM800xHTTPSessionSetUserData(SIM800xHTTPSessionType* session, const char* userdata);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Change the client certificate used with an "https://" URL
+ * @param[in]   session: session object.
+ * @param[in]   cert: certificate file name in the modem file system (null terminated string), or NULL.
+ * @param[in]   password: certificate password (null terminated string), or NULL.
+ * @retval      none
+ */
+extern void SIM800xHTTPSessionSetCert(SIM800xHTTPSessionType* session, const char* cert, const char* password);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Invalidate session parts, so that they are set up again before the next request
+ * @param[in]   session: session object.
+ * @param[in]   parts: parts to invalidate (See SIM800xHTTPSessionLiveType)
+ * @retval      none
+ */
+extern void SIM800xHTTPSessionInvalidate(SIM800xHTTPSessionType* session, uint8_t parts);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Set up the invalidated session parts
+ * @note        This function will, for the parts that are not live only:
+ *                  - Activate the bearer profile ("GPRS" connection type and APN), unless it is already active
+ *                  - Initialize the HTTP service (AT+HTTPINIT), and SSL with an "https://" URL
+ *                  - Set the CID, URL, CONTENT and USERDATA parameters (AT+HTTPPARA)
+ * @param[in]   session: session object.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: every part is live
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed
+ *              - SIM800X_CME_ERROR: ME error
+ */
+extern SIM800x_APIStatusType SIM800xHTTPSessionOpen(SIM800xHTTPSessionType* session, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Send a request, setting up the invalidated session parts beforehand
+ * @param[in]   session: session object.
+ * @param[in]   method: method request. Supported values are:
+ *              - 0: GET
+ *              - 1: POST
+ *              - 2: HEAD
+ *              - 3: DELETE
+ *
+ * @param[in]   data: request body (POST), or NULL.
+ * @param[in]   cnt: request body size in bytes.
+ * @param[out]  statuscode: HTTP(S) status codes (See description in SIM800x_Types.h)
+ * @param[out]  rcnt: the length of data received from the server.
+ * @param[in]   tout: maximum response time in milliseconds, that will be used to wait for response from the server.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success, check "statuscode"
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed
+ *              - SIM800X_CME_ERROR: ME error
+ *
+ * @note        Failed requests are not retried, the failure invalidates the session
+ *              parts involved, which are set up again by the next request.
+ * @note        The response can be read using SIM800xHTTPRead().
+ */
+extern SIM800x_APIStatusType SIM800xHTTPSessionRequest(SIM800xHTTPSessionType* session, uint8_t method, char* data, uint32_t cnt, uint16_t* statuscode, uint32_t* rcnt, uint32_t tout, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Terminate the HTTP service and deactivate the bearer profile
+ * @param[in]   session: session object.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed
+ */
+extern SIM800x_APIStatusType SIM800xHTTPSessionClose(SIM800xHTTPSessionType* session, uint16_t* errcode);
+//-----------------------------------
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* __SIM800X_HTTPSESSION_H */
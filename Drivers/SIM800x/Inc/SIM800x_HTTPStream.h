@@ -0,0 +1,146 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_HTTPStream.h
+ * @author          Firmware-Engineers
+ * @brief           Header file for SIM800 series modems HTTP streaming
+ * @brief           This file provides function definitions used for transferring
+ *                  HTTP bodies larger than the available RAM, through small
+ *                  successive windows.
+ *
+ * @note            Response data is read in AT+HTTPREAD windows of
+ *                  CONFIG_HTTP_STREAM_WINDOW bytes, and handed to a user call-back
+ *                  in chunks of CONFIG_HTTP_STREAM_CHUNK bytes, as it is pulled out
+ *                  of the SDM receive FIFO.
+ *
+ * @note            Request data is sent after AT+HTTPDATA, either from a list of
+ *                  segments or from a producer call-back, pulled while the modem
+ *                  is fed. The body size is declared up front, and peak RAM only
+ *                  depends on the producer's own buffer.
+ *
+ * @note            These functions cannot be used when HTTP service is not initialized.
+ *
+ * @brief           Supported devices are listed below.
+ * @brief           See dependencies in the include section.
+ *
+ * @note            History:
+ *                   - October 18, 2026: Initial release
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; </center></h2>
+ *
+ *
+ ******************************************************************************
+ */
+
+#ifndef __SIM800X_HTTPSTREAM_H
+#define	__SIM800X_HTTPSTREAM_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------
+#include <stdint.h>
+#include "SIM800x_Types.h"
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Response data call-back type
+ * @param[in]   data: received data chunk.
+ * @param[in]   len: chunk size in bytes.
+ * @param[in]   offset: offset of the chunk in the response body.
+ * @retval      - 1: continue
+ *              - 0: abort the transfer
+ * @note        **data is only valid for the duration of the call.**
+ */
+typedef uint8_t (*SIM800xHTTPStreamCallBack)(const uint8_t* data, uint16_t len, uint32_t offset);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Request data producer type
+ * @param[out]  data: set to the next piece of data.
+ * @param[in]   offset: offset of the piece in the request body.
+ * @param[in]   remain: number of body bytes still to be produced.
+ * @retval      Number of bytes available at *data, at most remain. 0 aborts the transfer.
+ * @note        **data must stay valid until the next call.**
+ */
+typedef uint16_t (*SIM800xHTTPStreamProducer)(const uint8_t** data, uint32_t offset, uint32_t remain);
+//-----------------------------------
+
+/**
+  * @brief  Request data segment type definition
+  */
+typedef struct
+{
+    //---------
+    const uint8_t*          data;                                               //!< Segment data
+    uint16_t                len;                                                //!< Segment size in bytes
+    //---------
+}SIM800xHTTPStreamSegmentType;
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Read the HTTP response body, streaming it to a call-back
+ * @param[in]   start: offset of the first byte to read. Supported values are:
+ *              - [0...319487]
+ *
+ * @param[in]   size: number of bytes to read, usually the length returned by SIM800xHTTPAction().
+ * @param[in]   cb: call-back receiving the data.
+ * @param[out]  cnt: number of bytes handed to the call-back, or NULL.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success, or end of the response body reached
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed, or aborted by the call-back
+ *              - SIM800X_CME_ERROR: ME error
+ */
+extern SIM800x_APIStatusType SIM800xHTTPStreamRead(uint32_t start, uint32_t size, SIM800xHTTPStreamCallBack cb, uint32_t* cnt, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Input the POST request body from a producer call-back
+ * @param[in]   size: body size in bytes. Supported values are:
+ *              - [1...319488]
+ *
+ * @param[in]   producer: call-back supplying the data.
+ * @param[in]   timeout: maximum time in milliseconds, required to input data. Supported values are:
+ *              - [1000...120000]
+ * @note        timeout should be long enough to input all the "size" bytes of data.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed, or aborted by the producer
+ *              - SIM800X_CME_ERROR: ME error
+ *
+ * @note        When the producer aborts, the modem keeps the partial body until timeout expires.
+ */
+extern SIM800x_APIStatusType SIM800xHTTPStreamWrite(uint32_t size, SIM800xHTTPStreamProducer producer, uint32_t timeout, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Input the POST request body from a list of segments
+ * @param[in]   segments: segments sent in order, their total size is the body size.
+ * @param[in]   count: number of segments.
+ * @param[in]   timeout: See SIM800xHTTPStreamWrite().
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ * @retval      SIM800x_APIStatusType (See SIM800xHTTPStreamWrite())
+ */
+extern SIM800x_APIStatusType SIM800xHTTPStreamWriteSegments(const SIM800xHTTPStreamSegmentType* segments, uint8_t count, uint32_t timeout, uint16_t* errcode);
+//-----------------------------------
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* __SIM800X_HTTPSTREAM_H */
@@ -0,0 +1,233 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_MQTT.h
+ * @author          Firmware-Engineers
+ * @brief           Header file for SIM800 series modems MQTT 3.1.1 client
+ * @brief           This file provides function definitions used for publishing
+ *                  and receiving MQTT messages over a persistent TCP connection of
+ *                  the TCP/IP application toolkit (See SIM800x_TCPIP.h).
+ *
+ * @brief           Supported features are:
+ *                  - QoS 0 and QoS 1 publishing, with up to CONFIG_MQTT_MAX_INFLIGHT
+ *                    unacknowledged QoS 1 messages, retransmitted with the DUP flag
+ *                  - QoS 0 and QoS 1 subscriptions
+ *                  - Keepalive (PINGREQ/PINGRESP), driven by the API tick
+ *
+ * @note            Incoming packets are parsed incrementally, straight from the
+ *                  connection receive data into a CONFIG_MQTT_PACKET_SIZE buffer.
+ *                  A larger packet is dropped; a QoS 1 PUBLISH is still acknowledged,
+ *                  or the connection closed if its identifier does not fit either.
+ *                  Every buffer is statically allocated, a single client instance
+ *                  is supported.
+ *
+ * @note            The session is always started clean (Clean Session flag set).
+ *
+ * @brief           Supported devices are listed below.
+ * @brief           See dependencies in the include section.
+ *
+ * @note            History:
+ *                   - October 18, 2026: Initial release
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; </center></h2>
+ *
+ *
+ ******************************************************************************
+ */
+
+#ifndef __SIM800X_MQTT_H
+#define	__SIM800X_MQTT_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------
+#include <stdint.h>
+#include "SIM800x_Types.h"
+#include "SIM800x_TCPIP.h"
+//-----------------------------------
+
+/**
+  * @brief  MQTT client state type definition
+  */
+typedef enum
+{
+    //---------
+    MQTT_DISCONNECTED                   = 0,                                    //!< No broker connection
+    MQTT_CONNECTING                     = 1,                                    //!< CONNECT sent, waiting for CONNACK
+    MQTT_CONNECTED                      = 2                                     //!< Connection accepted by the broker
+    //---------
+}SIM800xMQTTStateType;
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Message reception call-back type
+ * @param[in]   topic: topic name (**not** null terminated).
+ * @param[in]   topiclen: topic name length in bytes.
+ * @param[in]   payload: message payload.
+ * @param[in]   len: payload size in bytes.
+ * @note        **topic and payload point into the receive packet buffer, they are only
+ *              valid for the duration of the call.**
+ */
+typedef void (*SIM800xMQTTMessageCallBack)(const char* topic, uint16_t topiclen, const uint8_t* payload, uint16_t len);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Register the message reception call-back
+ * @param[in]   cb: call-back function, or NULL to drop received messages.
+ * @retval      none
+ */
+extern void SIM800xMQTTSetMessageCallBack(SIM800xMQTTMessageCallBack cb);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Open a TCP connection to the broker and start an MQTT session
+ * @note        The TCP/IP application toolkit must be initialized beforehand, using SIM800xTCPIPInit().
+ * @param[in]   n: TCP/IP connection number used by the client. Supported values are:
+ *              - [0...CONFIG_TCPIP_MAX_CONNECTIONS-1]
+ *
+ * @param[in]   host: broker IP address or domain name (null terminated string).
+ * @param[in]   port: broker port (ex. 1883).
+ * @param[in]   clientid: client identifier (null terminated string).
+ * @param[in]   user: user name (null terminated string), or NULL.
+ * @param[in]   pw: password (null terminated string), or NULL.
+ * @param[in]   keepalive: keepalive interval in seconds, 0 to disable.
+ * @param[in]   tout: maximum time in milliseconds, to wait for the connection and the broker acknowledgment.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: session started
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: connection failed, or refused by the broker
+ *              - SIM800X_CME_ERROR: ME error
+ */
+extern SIM800x_APIStatusType SIM800xMQTTConnect(uint8_t n, const char* host, uint16_t port, const char* clientid, const char* user, const char* pw, uint16_t keepalive, uint32_t tout, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Publish a message
+ * @param[in]   topic: topic name (null terminated string).
+ * @param[in]   payload: message payload.
+ * @param[in]   len: payload size in bytes. The whole packet must fit in CONFIG_MQTT_PACKET_SIZE bytes.
+ * @param[in]   qos: quality of service. Supported values are:
+ *              - 0: at most once
+ *              - 1: at least once
+ *
+ * @param[in]   retain: retain flag. Supported values are:
+ *              - 0: not retained
+ *              - 1: retained by the broker
+ *
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: message sent (QoS 1: waiting for acknowledgment, see SIM800xMQTTInflight())
+ *              - SIM800X_BUSY: QoS 1 inflight window full, call SIM800xMQTTPoll() and retry
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: not connected, or invalid parameter
+ *              - SIM800X_CME_ERROR: ME error
+ */
+extern SIM800x_APIStatusType SIM800xMQTTPublish(const char* topic, const uint8_t* payload, uint16_t len, uint8_t qos, uint8_t retain, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Subscribe to a topic filter
+ * @param[in]   topic: topic filter (null terminated string).
+ * @param[in]   qos: maximum quality of service. Supported values are:
+ *              - [0...1]
+ *
+ * @param[in]   tout: maximum time in milliseconds, to wait for the broker acknowledgment.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: subscription granted
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: subscription refused, not connected or invalid parameter
+ *              - SIM800X_CME_ERROR: ME error
+ *
+ * @note        Messages received while waiting are delivered to the registered call-back.
+ */
+extern SIM800x_APIStatusType SIM800xMQTTSubscribe(const char* topic, uint8_t qos, uint32_t tout, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Unsubscribe from a topic filter
+ * @param[in]   topic: topic filter (null terminated string).
+ * @param[in]   tout: maximum time in milliseconds, to wait for the broker acknowledgment.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: not connected or invalid parameter
+ *              - SIM800X_CME_ERROR: ME error
+ */
+extern SIM800x_APIStatusType SIM800xMQTTUnsubscribe(const char* topic, uint32_t tout, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Process received packets, keepalive and retransmissions
+ * @note        This function will:
+ *                  - Parse the packets received on the connection and deliver messages to the call-back
+ *                  - Acknowledge QoS 1 messages and release acknowledged inflight messages
+ *                  - Retransmit unacknowledged QoS 1 messages every CONFIG_MQTT_RETRY_TIME
+ *                  - Send PINGREQ when the connection has been idle for the keepalive interval
+ *                  - Drop the connection when PINGRESP is not received within CONFIG_MQTT_RETRY_TIME
+ * @param       none
+ * @retval      SIM800xMQTTStateType: current client state
+ *
+ * @note        This function should be called periodically while connected.
+ */
+extern SIM800xMQTTStateType SIM800xMQTTPoll(void);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Get the number of QoS 1 messages waiting for acknowledgment
+ * @param       none
+ * @retval      inflight message count, [0...CONFIG_MQTT_MAX_INFLIGHT]
+ */
+extern uint8_t SIM800xMQTTInflight(void);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Send DISCONNECT and close the TCP connection
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed
+ *
+ * @note        Unacknowledged QoS 1 messages are dropped.
+ */
+extern SIM800x_APIStatusType SIM800xMQTTDisconnect(uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Get the client state
+ * @param       none
+ * @retval      SIM800xMQTTStateType
+ */
+extern SIM800xMQTTStateType SIM800xMQTTGetState(void);
+//-----------------------------------
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* __SIM800X_MQTT_H */
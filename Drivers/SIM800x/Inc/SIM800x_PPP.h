@@ -0,0 +1,180 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_PPP.h
+ * @author          Firmware-Engineers
+ * @brief           Header file for SIM800 series modems PPP client
+ * @brief           This file provides function definitions used for running a
+ *                  PPP link (RFC 1661) over the modem data mode, entered via
+ *                  SIM800xGPRSSetDataMode().
+ *
+ * @brief           Supported protocols are:
+ *                  - LCP: link configuration, echo and termination
+ *                  - PAP and CHAP-MD5: authentication
+ *                  - IPCP: IP address and DNS servers negotiation
+ *
+ * @note            Received IP datagrams are delivered to the callback registered
+ *                  with SIM800xPPPSetInputCallBack(), straight from the PPP frame
+ *                  buffer. Together with SIM800xPPPSend(), it is the hook an IP
+ *                  stack network interface (ex. lwIP netif input/output) binds to.
+ *
+ * @brief           Supported devices are listed below.
+ * @brief           See dependencies in the include section.
+ *
+ * @note            History:
+ *                   - October 18, 2026: Initial release
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; </center></h2>
+ *
+ *
+ ******************************************************************************
+ */
+
+#ifndef __SIM800X_PPP_H
+#define	__SIM800X_PPP_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------
+#include <stdint.h>
+#include "SIM800x_Types.h"
+//-----------------------------------
+
+/**
+  * @brief  PPP link phase type definition
+  */
+typedef enum
+{
+    //---------
+    PPP_DEAD                            = 0,                                    //!< Link down, modem in command mode
+    PPP_ESTABLISH                       = 1,                                    //!< LCP negotiation in progress
+    PPP_AUTHENTICATE                    = 2,                                    //!< PAP/CHAP authentication in progress
+    PPP_NETWORK                         = 3,                                    //!< IPCP negotiation in progress
+    PPP_RUNNING                         = 4,                                    //!< Link up, IP datagrams can be exchanged
+    PPP_TERMINATE                       = 5                                     //!< LCP termination in progress
+    //---------
+}SIM800xPPPPhaseType;
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       IP datagram reception call-back type
+ * @param[in]   pkt: IP datagram, pointing into the PPP receive frame buffer.
+ * @param[in]   len: datagram size in bytes.
+ * @note        **pkt is only valid for the duration of the call.**
+ */
+typedef void (*SIM800xPPPInputCallBack)(const uint8_t* pkt, uint16_t len);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Register the IP datagram reception call-back
+ * @param[in]   cb: call-back function, or NULL to drop received datagrams.
+ * @retval      none
+ */
+extern void SIM800xPPPSetInputCallBack(SIM800xPPPInputCallBack cb);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Enter data mode and bring the PPP link up
+ * @param[in]   cid: PDP context id. Supported values are:
+ *              - [1...3]
+ *
+ * @param[in]   user: PAP/CHAP user name (null terminated string), or NULL.
+ * @param[in]   pw: PAP/CHAP password (null terminated string), or NULL.
+ * @note        The PDP context must be defined beforehand, using SIM800xGPRSSetPDPContext().
+ * @param[in]   tout: maximum time in milliseconds, to wait for the link to come up.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: link up
+ *              - SIM800X_TIME_OUT: negotiation did not complete in time
+ *              - SIM800X_ERROR: negotiation or authentication failed
+ *              - SIM800X_CME_ERROR: ME error, data mode not entered
+ *
+ * @note        Once the link is up, SIM800xPPPPoll() must be called periodically.
+ */
+extern SIM800x_APIStatusType SIM800xPPPOpen(uint8_t cid, const char* user, const char* pw, uint32_t tout, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Process received PPP frames and protocol timers
+ * @note        This function will:
+ *                  - Decode every frame available in the SDM receive FIFO
+ *                  - Answer LCP echo and termination requests
+ *                  - Deliver IP datagrams to the registered call-back
+ *                  - Retransmit pending configure/authenticate requests
+ * @param       none
+ * @retval      SIM800xPPPPhaseType: current link phase
+ */
+extern SIM800xPPPPhaseType SIM800xPPPPoll(void);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Send an IP datagram over the PPP link
+ * @param[in]   pkt: IP datagram
+ * @param[in]   len: datagram size in bytes. Supported values are:
+ *              - [1...CONFIG_PPP_MRU]
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_ERROR: link not running or invalid size
+ *
+ * @note        The datagram is HDLC-escaped on the fly, no copy of it is made.
+ */
+extern SIM800x_APIStatusType SIM800xPPPSend(const uint8_t* pkt, uint16_t len);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Terminate the PPP link and return to command mode
+ * @note        This function will:
+ *                  - Send an LCP terminate request and wait for the peer acknowledgment
+ *                  - Escape the data mode ("+++") and hang up the call (ATH)
+ * @param       none
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_TIME_OUT: no terminate acknowledgment from the peer
+ *
+ * @warning     It takes at least 2s to complete (data mode escape guard times).
+ */
+extern SIM800x_APIStatusType SIM800xPPPClose(void);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Get the current link phase
+ * @param       none
+ * @retval      SIM800xPPPPhaseType
+ */
+extern SIM800xPPPPhaseType SIM800xPPPGetPhase(void);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Get the addresses negotiated by IPCP
+ * @param[out]  ip: local IP address (4 bytes, network order), or NULL.
+ * @param[out]  dns1: primary DNS server address (4 bytes, network order), or NULL.
+ * @param[out]  dns2: secondary DNS server address (4 bytes, network order), or NULL.
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_ERROR: link not running
+ */
+extern SIM800x_APIStatusType SIM800xPPPGetAddress(uint8_t* ip, uint8_t* dns1, uint8_t* dns2);
+//-----------------------------------
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* __SIM800X_PPP_H */
@@ -0,0 +1,238 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_TCPIP.h
+ * @author          Firmware-Engineers
+ * @brief           Header file for SIM800 series modems TCP/IP application toolkit
+ * @brief           This file provides function definitions used for opening up to
+ *                  CONFIG_TCPIP_MAX_CONNECTIONS concurrent TCP or UDP connections
+ *                  (AT+CIPMUX=1), and exchanging data over them.
+ *
+ * @note            Payloads are streamed to the modem right after the '>' prompt,
+ *                  straight from the caller buffer. Received data ("+RECEIVE" URC)
+ *                  is read from the SDM receive FIFO straight into the receive
+ *                  buffer provided by the caller when opening the connection.
+ *
+ * @note            With CONFIG_TCPIP_QUICK_SEND, a send completes as soon as the modem
+ *                  has buffered the data ("DATA ACCEPT"), so that several writes can be
+ *                  issued per network round trip.
+ *                  With CONFIG_TCPIP_MANUAL_RECEIVE, received data is kept by the modem
+ *                  and only pulled (AT+CIPRXGET=2) when the application reads it, in
+ *                  chunks of CONFIG_TCPIP_RXGET_CHUNK bytes, straight into the caller
+ *                  buffer. The application read rate then throttles the downlink data.
+ *
+ * @note            This toolkit and the bearer based applications (SIM800x_IP.h,
+ *                  SIM800x_HTTP.h) use different PDP context handling on the modem,
+ *                  they should not be used at the same time.
+ *
+ * @brief           Supported devices are listed below.
+ * @brief           See dependencies in the include section.
+ *
+ * @note            History:
+ *                   - October 18, 2026: Initial release
+ ******************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; </center></h2>
+ *
+ *
+ ******************************************************************************
+ */
+
+#ifndef __SIM800X_TCPIP_H
+#define	__SIM800X_TCPIP_H
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+//-----------------------------------
+#include <stdint.h>
+#include "SIM800x_Types.h"
+//-----------------------------------
+
+/**
+  * @brief  TCP/IP connection state type definition
+  */
+typedef enum
+{
+    //---------
+    TCPIP_CLOSED                        = 0,                                    //!< Connection closed
+    TCPIP_CONNECTING                    = 1,                                    //!< Connection being established
+    TCPIP_CONNECTED                     = 2,                                    //!< Connection established
+    TCPIP_CLOSING                       = 3                                     //!< Connection being closed
+    //---------
+}SIM800xTCPIPStateType;
+//-----------------------------------
+
+/**
+  * @brief  TCP/IP connection mode type definition
+  */
+typedef enum
+{
+    //---------
+    TCPIP_TCP                           = 0,                                    //!< TCP connection
+    TCPIP_UDP                           = 1                                     //!< UDP connection
+    //---------
+}SIM800xTCPIPModeType;
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Bring up the wireless connection for the TCP/IP application toolkit
+ * @note        This function will:
+ *                  - Shut down any previous TCP/IP context (AT+CIPSHUT)
+ *                  - Enable multiple connections (AT+CIPMUX=1)
+ *                  - Enable quick send (AT+CIPQSEND=1) and manual receive (AT+CIPRXGET=1), if configured
+ *                  - Set APN, user name and password (AT+CSTT) and bring up the connection (AT+CIICR)
+ *                  - Read the local IP address (AT+CIFSR)
+ * @param[in]   apn: access point name (null terminated string).
+ * @param[in]   user: user name (null terminated string), or NULL.
+ * @param[in]   pw: password (null terminated string), or NULL.
+ * @param[out]  ip: local IP address (null terminated string, 16 bytes min.), or NULL.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed
+ *              - SIM800X_CME_ERROR: ME error
+ *
+ * @warning     Bringing up the connection can take up to 85s.
+ */
+extern SIM800x_APIStatusType SIM800xTCPIPInit(const char* apn, const char* user, const char* pw, char* ip, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Shut down the wireless connection, closing every TCP/IP connection
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed
+ */
+extern SIM800x_APIStatusType SIM800xTCPIPShut(uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Open a TCP or UDP connection
+ * @param[in]   n: connection number. Supported values are:
+ *              - [0...CONFIG_TCPIP_MAX_CONNECTIONS-1]
+ *
+ * @param[in]   mode: connection mode (See SIM800xTCPIPModeType)
+ * @param[in]   host: remote IP address or domain name (null terminated string).
+ * @param[in]   port: remote port.
+ * @param[in]   rxbuf: receive buffer, used as a FIFO for the data received on this connection.
+ * @param[in]   rxsize: size of "rxbuf" in bytes.
+ * @note        **rxbuf must remain valid until the connection is closed.** Data received
+ *              while the buffer is full is dropped, UDP datagrams are kept whole or dropped.
+ *              Unused with CONFIG_TCPIP_MANUAL_RECEIVE, may be NULL.
+ * @param[in]   tout: maximum time in milliseconds, to wait for the connection to be established.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: connection established
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: connection failed or invalid parameter
+ *              - SIM800X_CME_ERROR: ME error
+ */
+extern SIM800x_APIStatusType SIM800xTCPIPConnect(uint8_t n, SIM800xTCPIPModeType mode, const char* host, uint16_t port, uint8_t* rxbuf, uint16_t rxsize, uint32_t tout, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Send data over a connection
+ * @param[in]   n: connection number.
+ * @param[in]   data: data to send.
+ * @param[in]   cnt: data size in bytes. Supported values are:
+ *              - [1...1460] for TCP
+ *              - [1...1472] for UDP
+ *
+ * @param[in]   tout: maximum time in milliseconds, to wait for the send result.
+ * @note        With CONFIG_TCPIP_QUICK_SEND, the send result is the modem acknowledgment
+ *              of the buffered data, not the server acknowledgment.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ *
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: data sent
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: send failed or connection not established
+ *              - SIM800X_CME_ERROR: ME error
+ */
+extern SIM800x_APIStatusType SIM800xTCPIPSend(uint8_t n, const uint8_t* data, uint16_t cnt, uint32_t tout, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Read data received on a connection
+ * @param[in]   n: connection number.
+ * @param[out]  data: byte array to copy data to.
+ * @param[in]   size: maximum number of bytes to read.
+ * @note        With CONFIG_TCPIP_MANUAL_RECEIVE, data is requested from the modem,
+ *              this function blocks until the requested chunks are received.
+ * @note        On UDP connections, a single datagram is read per call. The part of
+ *              the datagram that does not fit in "size" bytes is dropped. With
+ *              CONFIG_TCPIP_MANUAL_RECEIVE, the datagram is pulled whole by a single
+ *              request, regardless of CONFIG_TCPIP_RXGET_CHUNK.
+ * @retval      number of bytes read
+ */
+extern uint16_t SIM800xTCPIPRead(uint8_t n, uint8_t* data, uint16_t size);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Get the amount of received data available on a connection
+ * @param[in]   n: connection number.
+ * @note        With CONFIG_TCPIP_MANUAL_RECEIVE, the modem is queried (AT+CIPRXGET=4)
+ *              only once data arrival has been notified.
+ * @note        On UDP connections, without CONFIG_TCPIP_MANUAL_RECEIVE, the size of
+ *              the next datagram is returned.
+ * @retval      byte count
+ */
+extern uint16_t SIM800xTCPIPAvailable(uint8_t n);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Close a connection
+ * @param[in]   n: connection number.
+ * @param[out]  errcode: CME_ERROR code (See description in SIM800x_Types.h)
+ * @retval      SIM800x_APIStatusType. Supported values are:
+ *
+ *              - SIM800X_OK: success
+ *              - SIM800X_TIME_OUT: time-out
+ *              - SIM800X_ERROR: failed
+ */
+extern SIM800x_APIStatusType SIM800xTCPIPClose(uint8_t n, uint16_t* errcode);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Get a connection state
+ * @param[in]   n: connection number.
+ * @retval      SIM800xTCPIPStateType
+ */
+extern SIM800xTCPIPStateType SIM800xTCPIPGetState(uint8_t n);
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief       Process received data and connection events
+ * @note        This function should be called periodically, so that the data
+ *              received on every connection is moved out of the SDM receive FIFO.
+ * @param       none
+ * @retval      none
+ */
+extern void SIM800xTCPIPPoll(void);
+//-----------------------------------
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* __SIM800X_TCPIP_H */
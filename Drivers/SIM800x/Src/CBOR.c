@@ -0,0 +1,265 @@
+/**
+*************************************************************************
+*  	@file: CBOR.c
+*
+*  	@brief: CBOR encoder and reader
+*  	@brief: See CBOR.h for more details.
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "CBOR.h"
+#include <string.h>
+//==========================================================================//
+
+//===================================
+/**
+* @brief				: Write an item head, major type and argument in the shortest form
+*/
+static uint8_t CborHead(uint8_t * Cbor, uint16_t Size, uint8_t major, uint32_t arg, uint16_t *Cpos)
+{
+	uint8_t n = (arg < 24) ? 1 : (arg < 0x100) ? 2 : (arg < 0x10000) ? 3 : 5;
+	uint8_t *p;
+
+	if(((uint32_t)*Cpos + n) > Size)
+		return 1;
+	p = &Cbor[*Cpos];
+	*Cpos += n;
+	switch(n)
+	{
+		case 1:
+			*p = (uint8_t)(major | arg);
+			return 0;
+		case 2:
+			*p++ = major | 24;
+			break;
+		case 3:
+			*p++ = major | 25;
+			*p++ = (uint8_t)(arg >> 8);
+			break;
+		default:
+			*p++ = major | 26;
+			*p++ = (uint8_t)(arg >> 24);
+			*p++ = (uint8_t)(arg >> 16);
+			*p++ = (uint8_t)(arg >> 8);
+			break;
+	}
+	*p = (uint8_t)arg;
+	return 0;
+}
+//===================================
+
+//===================================
+static uint8_t CborString(uint8_t * Cbor, uint16_t Size, uint8_t major, const void * data, uint16_t len, uint16_t *Cpos)
+{
+	uint16_t pos = *Cpos;
+
+	if(CborHead(Cbor, Size, major, len, &pos) || (((uint32_t)pos + len) > Size))
+		return 1;
+	memcpy(&Cbor[pos], data, len);
+	*Cpos = (uint16_t)(pos + len);
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t AddUIntToCbor(uint8_t * Cbor, uint16_t Size, uint32_t value, uint16_t *Cpos)
+{
+	return CborHead(Cbor, Size, CBOR_UINT, value, Cpos);
+}
+//===================================
+
+//===================================
+uint8_t AddIntToCbor(uint8_t * Cbor, uint16_t Size, int32_t value, uint16_t *Cpos)
+{
+	if(value < 0)
+		return CborHead(Cbor, Size, CBOR_NINT, (uint32_t)(-1 - value), Cpos);	//!< Encoded as -1 - n
+	return CborHead(Cbor, Size, CBOR_UINT, (uint32_t)value, Cpos);
+}
+//===================================
+
+//===================================
+uint8_t AddFloatToCbor(uint8_t * Cbor, uint16_t Size, float value, uint16_t *Cpos)
+{
+	uint32_t bits;
+	int32_t exp;
+	uint16_t half;
+	uint8_t *p;
+
+	memcpy(&bits, &value, 4);
+	exp = (int32_t)((bits >> 23) & 0xFF);
+	half = (uint16_t)((bits >> 16) & 0x8000);
+	if(!(bits & 0x1FFF) && ((exp == 0xFF) || ((exp >= (127 - 14)) && (exp <= (127 + 15))) || !(bits & 0x7FFFFFFF)))
+	{
+		if(exp == 0xFF)																	//!< Infinity, NaN
+			half |= (uint16_t)(0x7C00 | ((bits >> 13) & 0x3FF));
+		else if(bits & 0x7FFFFFFF)
+			half |= (uint16_t)(((exp - 127 + 15) << 10) | ((bits >> 13) & 0x3FF));
+		if(((uint32_t)*Cpos + 3) > Size)
+			return 1;
+		p = &Cbor[*Cpos];
+		p[0] = CBOR_HALF;
+		p[1] = (uint8_t)(half >> 8);
+		p[2] = (uint8_t)half;
+		*Cpos += 3;
+		return 0;
+	}
+	if(((uint32_t)*Cpos + 5) > Size)
+		return 1;
+	p = &Cbor[*Cpos];
+	p[0] = CBOR_FLOAT;
+	p[1] = (uint8_t)(bits >> 24);
+	p[2] = (uint8_t)(bits >> 16);
+	p[3] = (uint8_t)(bits >> 8);
+	p[4] = (uint8_t)bits;
+	*Cpos += 5;
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t AddTextToCbor(uint8_t * Cbor, uint16_t Size, const char * text, uint16_t *Cpos)
+{
+	return CborString(Cbor, Size, CBOR_TEXT, text, (uint16_t)strlen(text), Cpos);
+}
+//===================================
+
+//===================================
+uint8_t AddBytesToCbor(uint8_t * Cbor, uint16_t Size, const uint8_t * data, uint16_t len, uint16_t *Cpos)
+{
+	return CborString(Cbor, Size, CBOR_BYTES, data, len, Cpos);
+}
+//===================================
+
+//===================================
+uint8_t AddBoolToCbor(uint8_t * Cbor, uint16_t Size, uint8_t value, uint16_t *Cpos)
+{
+	return CborHead(Cbor, Size, CBOR_SIMPLE, value ? (CBOR_TRUE & 0x1F) : (CBOR_FALSE & 0x1F), Cpos);
+}
+//===================================
+
+//===================================
+uint8_t AddNullToCbor(uint8_t * Cbor, uint16_t Size, uint16_t *Cpos)
+{
+	return CborHead(Cbor, Size, CBOR_SIMPLE, CBOR_NULL & 0x1F, Cpos);
+}
+//===================================
+
+//===================================
+uint8_t AddMapToCbor(uint8_t * Cbor, uint16_t Size, uint16_t count, uint16_t *Cpos)
+{
+	return CborHead(Cbor, Size, CBOR_MAP, count, Cpos);
+}
+//===================================
+
+//===================================
+uint8_t AddArrayToCbor(uint8_t * Cbor, uint16_t Size, uint16_t count, uint16_t *Cpos)
+{
+	return CborHead(Cbor, Size, CBOR_ARRAY, count, Cpos);
+}
+//===================================
+
+//===================================
+uint8_t AddIntEntryToCborMap(uint8_t * Cbor, uint16_t Size, const char * key, int32_t value, uint16_t *Cpos)
+{
+	uint16_t pos = *Cpos;
+
+	if(AddTextToCbor(Cbor, Size, key, &pos) || AddIntToCbor(Cbor, Size, value, &pos))
+		return 1;
+	*Cpos = pos;
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t AddFloatEntryToCborMap(uint8_t * Cbor, uint16_t Size, const char * key, float value, uint16_t *Cpos)
+{
+	uint16_t pos = *Cpos;
+
+	if(AddTextToCbor(Cbor, Size, key, &pos) || AddFloatToCbor(Cbor, Size, value, &pos))
+		return 1;
+	*Cpos = pos;
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t AddDecimalToCbor(uint8_t * Cbor, uint16_t Size, int32_t mantissa, int8_t exponent, uint16_t *Cpos)
+{
+	uint16_t pos = *Cpos;
+
+	if(CborHead(Cbor, Size, CBOR_TAG, CBOR_DECIMAL, &pos) || CborHead(Cbor, Size, CBOR_ARRAY, 2, &pos) ||
+	   AddIntToCbor(Cbor, Size, exponent, &pos) || AddIntToCbor(Cbor, Size, mantissa, &pos))
+		return 1;
+	*Cpos = pos;
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t GetHeadFromCbor(const uint8_t * Cbor, uint16_t Size, uint8_t * major, uint32_t * arg, uint16_t *Cpos)
+{
+	uint16_t pos = *Cpos;
+	uint8_t n, info;
+
+	if(pos >= Size)
+		return 1;
+	*major = Cbor[pos] & 0xE0;
+	info = Cbor[pos++] & 0x1F;
+	if(info < 24)
+	{
+		*arg = info;
+		*Cpos = pos;
+		return 0;
+	}
+	if(info > 26)
+		return 1;
+	n = (uint8_t)(1 << (info - 24));
+	if(((uint32_t)pos + n) > Size)
+		return 1;
+	for(*arg = 0; n; n--)
+		*arg = (*arg << 8) | Cbor[pos++];
+	*Cpos = pos;
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t GetIntFromCbor(const uint8_t * Cbor, uint16_t Size, int32_t * value, uint16_t *Cpos)
+{
+	uint16_t pos = *Cpos;
+	uint32_t arg;
+	uint8_t major;
+
+	if(GetHeadFromCbor(Cbor, Size, &major, &arg, &pos) || ((major != CBOR_UINT) && (major != CBOR_NINT)) || (arg > 0x7FFFFFFF))
+		return 1;
+	*value = (major == CBOR_NINT) ? (-1 - (int32_t)arg) : (int32_t)arg;
+	*Cpos = pos;
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t GetDecimalFromCbor(const uint8_t * Cbor, uint16_t Size, int32_t * mantissa, int8_t * exponent, uint16_t *Cpos)
+{
+	uint16_t pos = *Cpos;
+	uint32_t arg;
+	int32_t exp;
+	uint8_t major;
+
+	if(!GetIntFromCbor(Cbor, Size, mantissa, Cpos))
+	{
+		*exponent = 0;
+		return 0;
+	}
+	if(GetHeadFromCbor(Cbor, Size, &major, &arg, &pos) || (major != CBOR_TAG) || (arg != CBOR_DECIMAL) ||
+	   GetHeadFromCbor(Cbor, Size, &major, &arg, &pos) || (major != CBOR_ARRAY) || (arg != 2) ||
+	   GetIntFromCbor(Cbor, Size, &exp, &pos) || (exp < -128) || (exp > 127) || GetIntFromCbor(Cbor, Size, mantissa, &pos))
+		return 1;
+	*exponent = (int8_t)exp;
+	*Cpos = pos;
+	return 0;
+}
+//===================================
@@ -0,0 +1,149 @@
+/**
+*************************************************************************
+*  	@file: JSON.c
+*
+*  	@brief: JSON parser library
+*  	@brief: See JSON.h for more details.
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "JSON.h"
+//==========================================================================//
+
+//===================================
+/**
+* @brief				: Append an item to an array or object, opening it first when *Cpos is 0.
+*						  The closing character is written at *Cpos, where the next item starts.
+*/
+static void JsonAppend(char * Json, char open, char close, const char * key, const char * value, uint16_t *Cpos)
+{
+	uint16_t pos = *Cpos;
+	size_t n;
+
+	Json[pos] = pos ? ',' : open;
+	pos++;
+	if(key)
+	{
+		n = strlen(key);
+		Json[pos++] = '"';
+		memcpy(&Json[pos], key, n);
+		pos += n;
+		Json[pos++] = '"';
+		Json[pos++] = ':';
+	}
+	n = strlen(value);
+	memcpy(&Json[pos], value, n);
+	pos += n;
+	Json[pos] = close;
+	Json[pos + 1] = '\0';
+	*Cpos = pos;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Copy the idx-th item of an array or object, without its separators.
+*						  Strings are skipped whole, so their commas and brackets are not counted.
+*/
+static uint8_t JsonGetItem(const char * Json, char * item, uint16_t idx, char close)
+{
+	const char *start = Json + 1, *p = start;
+	uint16_t depth = 0;
+	char c;
+
+	for(;; p++)
+	{
+		c = *p;
+		if(!c)
+			return 1;
+		if(c == '"')
+		{
+			while((c = *++p) != '"')
+			{
+				if(!c)
+					return 1;
+				if((c == '\\') && !*++p)
+					return 1;
+			}
+		}else if((c == '{') || (c == '['))
+			depth++;
+		else if(!depth && ((c == ',') || (c == close)))
+		{
+			if(!idx--)
+				break;
+			if(c == close)
+				return 1;
+			start = p + 1;
+		}else if((c == '}') || (c == ']'))
+		{
+			if(!depth)
+				return 1;
+			depth--;
+		}
+	}
+	memcpy(item, start, (size_t)(p - start));
+	item[p - start] = '\0';
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t AddValueToJsonArray(char * JsonArray, const char * value, uint16_t *Cpos)
+{
+	JsonAppend(JsonArray, '[', ']', NULL, value, Cpos);
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t AddEntryToJsonObject(char * JsonObject, const char * key, const char * value, uint16_t *Cpos)
+{
+	JsonAppend(JsonObject, '{', '}', key, value, Cpos);
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t GetValueFromJsonArray(char * JsonArray, char* value, uint16_t idx)
+{
+	return JsonGetItem(JsonArray, value, idx, ']');
+}
+//===================================
+
+//===================================
+uint8_t GetEntryFromJsonObject(char * JsonObject, char* entry, uint8_t idx)
+{
+	return JsonGetItem(JsonObject, entry, idx, '}');
+}
+//===================================
+
+//===================================
+uint8_t GetKeyFromJsonEntry(char * JsonEntry, char* key)
+{
+	const char *p = JsonEntry + 1;
+
+	while(*p != '"')
+	{
+		if(!*p)
+			return 1;
+		*key++ = *p++;
+	}
+	*key = '\0';
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t GetValueFromJsonEntry(char * JsonEntry, char* value)
+{
+	const char *p = strchr(JsonEntry, ':');
+
+	if(!p)
+		return 1;
+	strcpy(value, p + 1);
+	return 0;
+}
+//===================================
@@ -0,0 +1,355 @@
+/**
+*************************************************************************
+*  	@file: JSONBuilder.c
+*
+*  	@brief: JSON builder
+*  	@brief: See JSONBuilder.h for more details.
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "JSONBuilder.h"
+#include <string.h>
+//==========================================================================//
+
+//==========================================================================//
+//								Container flags								//
+//==========================================================================//
+#define JB_OBJECT				0x01		//!< Object, array otherwise
+#define JB_ITEMS				0x02		//!< At least one item, next one needs a comma
+//==========================================================================//
+
+//===================================
+static const char digitpairs[201] =
+	"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+	"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+static const uint32_t pow10[10] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+static const JsonDictionary *dictionary;	//!< Registered key dictionary
+//===================================
+
+//===================================
+char * JsonFormatUInt(char * end, uint32_t value, uint8_t width)
+{
+	char *p = end;
+	uint32_t q;
+
+	while(value >= 100)
+	{
+		q = value / 100;
+		p -= 2;
+		memcpy(p, &digitpairs[(value - q * 100) * 2], 2);
+		value = q;
+	}
+	if(value >= 10)
+	{
+		p -= 2;
+		memcpy(p, &digitpairs[value * 2], 2);
+	}else
+		*--p = (char)('0' + value);
+	while((end - p) < width)
+		*--p = '0';
+	return p;
+}
+//===================================
+
+//===================================
+char * JsonFormatFixed(char * end, int32_t value, uint8_t decimals)
+{
+	uint32_t mag = (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value;
+	char *p;
+
+	if(decimals)
+	{
+		p = JsonFormatUInt(end, mag % pow10[decimals], decimals);
+		*--p = '.';
+		p = JsonFormatUInt(p, mag / pow10[decimals], 1);
+	}else
+		p = JsonFormatUInt(end, mag, 1);
+	if(value < 0)
+		*--p = '-';
+	return p;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Append characters, keeping room for the closing characters of the
+*						  open containers and for the null terminator
+*/
+static uint8_t JsonPut(JsonBuilder * builder, const char * s, uint16_t n)
+{
+	if(((uint32_t)builder->len + n + builder->depth) >= builder->size)
+	{
+		builder->overflow = 1;
+		return 1;
+	}
+	memcpy(&builder->buf[builder->len], s, n);
+	builder->len += n;
+	return 0;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Append a string, escaped, copying the runs of plain characters at once
+*/
+static uint8_t JsonPutEscaped(JsonBuilder * builder, const char * s)
+{
+	static const char hex[] = "0123456789abcdef";
+	char esc[6] = {'\\', 'u', '0', '0', '0', '0'};
+	const char *run = s;
+	uint8_t n;
+	char c;
+
+	for(;; s++)
+	{
+		c = *s;
+		if(c && (c != '"') && (c != '\\') && ((uint8_t)c >= 0x20))
+			continue;
+		if(JsonPut(builder, run, (uint16_t)(s - run)))
+			return 1;
+		if(!c)
+			return 0;
+		n = 2;
+		switch(c)
+		{
+			case '\n':	esc[1] = 'n';	break;
+			case '\r':	esc[1] = 'r';	break;
+			case '\t':	esc[1] = 't';	break;
+			case '\b':	esc[1] = 'b';	break;
+			case '\f':	esc[1] = 'f';	break;
+			case '"':
+			case '\\':	esc[1] = c;		break;
+			default:
+				esc[1] = 'u';
+				esc[4] = hex[(uint8_t)c >> 4];
+				esc[5] = hex[c & 0x0F];
+				n = 6;
+				break;
+		}
+		if(JsonPut(builder, esc, n))
+			return 1;
+		run = s + 1;
+	}
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Write a key, or its alias from the dictionary
+*/
+static uint8_t JsonPutKey(JsonBuilder * builder, const char * key)
+{
+	char num[JSON_NUMBER_SIZE], *end = num + sizeof(num), *p;
+	const JsonKeyAlias *k;
+	uint8_t i;
+
+	if(builder->dict)
+	{
+		for(i = 0, k = builder->dict->keys; i < builder->dict->count; i++, k++)
+		{
+			if((k->name != key) && strcmp(k->name, key))
+				continue;
+			if(k->alias)
+				return JsonPut(builder, "\"", 1) || JsonPutEscaped(builder, k->alias) || JsonPut(builder, "\":", 2);
+			p = JsonFormatUInt(end, i, 1);
+			return JsonPut(builder, "\"", 1) || JsonPut(builder, p, (uint16_t)(end - p)) || JsonPut(builder, "\":", 2);
+		}
+	}
+	return JsonPut(builder, "\"", 1) || JsonPutEscaped(builder, key) || JsonPut(builder, "\":", 2);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Start an item: comma and key as needed
+*/
+static uint8_t JsonItem(JsonBuilder * builder, const char * key)
+{
+	uint8_t top;
+
+	if(builder->overflow)
+		return 1;
+	if(!builder->depth)
+		return builder->len ? 1 : 0;											//!< Single root value
+	top = builder->stack[builder->depth - 1];
+	if((top & JB_ITEMS) && JsonPut(builder, ",", 1))
+		return 1;
+	if(top & JB_OBJECT)
+	{
+		if(!key || JsonPutKey(builder, key))
+			return 1;
+	}
+	return 0;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Complete an item, or drop it when it did not fit
+*/
+static uint8_t JsonItemDone(JsonBuilder * builder, uint16_t start, uint8_t failed)
+{
+	if(failed)
+		builder->len = start;
+	else if(builder->depth)
+		builder->stack[builder->depth - 1] |= JB_ITEMS;
+	if(builder->size)
+		builder->buf[builder->len] = '\0';
+	return failed;
+}
+//===================================
+
+//===================================
+static uint8_t JsonBegin(JsonBuilder * builder, const char * key, char open, uint8_t type)
+{
+	uint16_t start = builder->len;
+	uint8_t failed;
+
+	if(builder->depth >= JSON_BUILDER_DEPTH)
+		return 1;
+	if(JsonItem(builder, key))
+		return JsonItemDone(builder, start, 1);
+	builder->depth++;															//!< Room for its closing character too
+	failed = JsonPut(builder, &open, 1);
+	builder->depth--;
+	if(JsonItemDone(builder, start, failed))
+		return 1;
+	builder->stack[builder->depth++] = type;
+	if(builder->dict && (builder->depth == 1) && (type & JB_OBJECT) &&			//!< Version first, for the expansion
+	   JsonBuilderAddUInt(builder, JSON_DICTIONARY_KEY, builder->dict->version))
+	{
+		builder->depth--;
+		return JsonItemDone(builder, start, 1);
+	}
+	return 0;
+}
+//===================================
+
+//===================================
+void JsonBuilderSetDictionary(const JsonDictionary * dict)
+{
+	dictionary = dict;
+}
+//===================================
+
+//===================================
+void JsonBuilderInit(JsonBuilder * builder, char * buf, uint16_t size)
+{
+	builder->buf = buf;
+	builder->size = size;
+	builder->len = 0;
+	builder->depth = 0;
+	builder->overflow = !size;
+	builder->dict = dictionary;
+	if(size)
+		buf[0] = '\0';
+}
+//===================================
+
+//===================================
+uint8_t JsonBuilderBeginObject(JsonBuilder * builder, const char * key)
+{
+	return JsonBegin(builder, key, '{', JB_OBJECT);
+}
+//===================================
+
+//===================================
+uint8_t JsonBuilderBeginArray(JsonBuilder * builder, const char * key)
+{
+	return JsonBegin(builder, key, '[', 0);
+}
+//===================================
+
+//===================================
+uint8_t JsonBuilderEnd(JsonBuilder * builder)
+{
+	if(!builder->depth)
+		return 1;
+	builder->depth--;
+	builder->buf[builder->len++] = (builder->stack[builder->depth] & JB_OBJECT) ? '}' : ']';	//!< Room kept by JsonPut
+	builder->buf[builder->len] = '\0';
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t JsonBuilderAddString(JsonBuilder * builder, const char * key, const char * value)
+{
+	uint16_t start = builder->len;
+
+	return JsonItemDone(builder, start, JsonItem(builder, key) || JsonPut(builder, "\"", 1) || JsonPutEscaped(builder, value) || JsonPut(builder, "\"", 1));
+}
+//===================================
+
+//===================================
+uint8_t JsonBuilderAddRaw(JsonBuilder * builder, const char * key, const char * value)
+{
+	uint16_t start = builder->len;
+
+	return JsonItemDone(builder, start, JsonItem(builder, key) || JsonPut(builder, value, (uint16_t)strlen(value)));
+}
+//===================================
+
+//===================================
+uint8_t JsonBuilderFinish(JsonBuilder * builder)
+{
+	return builder->overflow || builder->depth || !builder->len;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Add a formatted number, from p to end
+*/
+static uint8_t JsonAddNumber(JsonBuilder * builder, const char * key, const char * p, const char * end)
+{
+	uint16_t start = builder->len;
+
+	return JsonItemDone(builder, start, JsonItem(builder, key) || JsonPut(builder, p, (uint16_t)(end - p)));
+}
+//===================================
+
+//===================================
+uint8_t JsonBuilderAddInt(JsonBuilder * builder, const char * key, int32_t value)
+{
+	return JsonBuilderAddFixed(builder, key, value, 0);
+}
+//===================================
+
+//===================================
+uint8_t JsonBuilderAddUInt(JsonBuilder * builder, const char * key, uint32_t value)
+{
+	char num[JSON_NUMBER_SIZE], *end = num + sizeof(num);
+
+	return JsonAddNumber(builder, key, JsonFormatUInt(end, value, 1), end);
+}
+//===================================
+
+//===================================
+uint8_t JsonBuilderAddFixed(JsonBuilder * builder, const char * key, int32_t value, uint8_t decimals)
+{
+	char num[JSON_NUMBER_SIZE], *end = num + sizeof(num);
+
+	if(decimals > 9)
+		return 1;
+	return JsonAddNumber(builder, key, JsonFormatFixed(end, value, decimals), end);
+}
+//===================================
+
+//===================================
+uint8_t JsonBuilderAddBool(JsonBuilder * builder, const char * key, uint8_t value)
+{
+	return JsonBuilderAddRaw(builder, key, value ? "true" : "false");
+}
+//===================================
+
+//===================================
+uint8_t JsonBuilderAddNull(JsonBuilder * builder, const char * key)
+{
+	return JsonBuilderAddRaw(builder, key, "null");
+}
+//===================================
@@ -0,0 +1,123 @@
+/**
+*************************************************************************
+*  	@file: JSONDictionary.c
+*
+*  	@brief: JSON key dictionary expansion
+*  	@brief: See JSONDictionary.h for more details.
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "JSONDictionary.h"
+#include <string.h>
+//==========================================================================//
+
+//===================================
+/**
+* @brief				: Find the full key of a document key, alias or index
+* @retval				: Full key, or NULL when the key is not in the dictionary
+*/
+static const char * JsonFindAlias(const JsonDictionary * dict, const char * key, uint16_t len)
+{
+	char num[JSON_NUMBER_SIZE], *end = num + sizeof(num), *p;
+	uint8_t i;
+
+	for(i = 0; i < dict->count; i++)
+	{
+		if(dict->keys[i].alias)
+		{
+			if((strlen(dict->keys[i].alias) == len) && !memcmp(dict->keys[i].alias, key, len))
+				return dict->keys[i].name;
+		}else
+		{
+			p = JsonFormatUInt(end, i, 1);
+			if(((uint16_t)(end - p) == len) && !memcmp(p, key, len))
+				return dict->keys[i].name;
+		}
+	}
+	return NULL;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Parse the version of a JSON_DICTIONARY_KEY entry
+*/
+static uint8_t JsonParseVersion(const JsonToken * token, const char * Json, uint32_t * version)
+{
+	uint16_t i;
+
+	if((token->type != JSON_TOKEN_PRIMITIVE) || !token->len || (token->len > 5))
+		return 1;
+	for(*version = 0, i = 0; i < token->len; i++)
+	{
+		if((Json[token->start + i] < '0') || (Json[token->start + i] > '9'))
+			return 1;
+		*version = *version * 10 + (uint32_t)(Json[token->start + i] - '0');
+	}
+	return 0;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Append characters to the output, keeping room for the null terminator
+*/
+static uint8_t JsonExpandPut(char * out, uint16_t size, uint16_t * pos, const char * s, uint16_t n)
+{
+	if(((uint32_t)*pos + n) >= size)
+		return 1;
+	memcpy(&out[*pos], s, n);
+	*pos += n;
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t JsonExpandKeys(const JsonDictionary * dict, const char * Json, uint16_t len, JsonToken * tokens, uint16_t count,
+					   char * out, uint16_t size, uint16_t * outlen)
+{
+	int16_t n = TokenizeJson(Json, len, tokens, count), t;
+	uint16_t src = 0, pos = 0, keyend;
+	uint32_t version;
+	const char *name;
+
+	if(n < 1)
+		return 1;
+	for(t = 0; t < n; t++)
+	{
+		if((tokens[t].type != JSON_TOKEN_STRING) || (tokens[t].size != 1))			//!< Keys only
+			continue;
+		keyend = (uint16_t)(tokens[t].start + tokens[t].len);
+		if((tokens[t].len == (sizeof(JSON_DICTIONARY_KEY) - 1)) && !memcmp(&Json[tokens[t].start], JSON_DICTIONARY_KEY, tokens[t].len))
+		{
+			if(JsonParseVersion(&tokens[t + 1], Json, &version) || (version != dict->version))
+				return 1;
+			if(JsonExpandPut(out, size, &pos, &Json[src], (uint16_t)(tokens[t].start - 1 - src)))
+				return 1;
+			src = (uint16_t)(tokens[t + 1].start + tokens[t + 1].len);				//!< Entry dropped, with the comma that follows it
+			while((src < len) && ((Json[src] == ' ') || (Json[src] == '\t') || (Json[src] == '\r') || (Json[src] == '\n')))
+				src++;
+			if((src < len) && (Json[src] == ','))
+				src++;
+			else if(pos && (out[pos - 1] == ','))									//!< Last entry, the comma before it goes
+				pos--;
+			t++;
+			continue;
+		}
+		if((name = JsonFindAlias(dict, &Json[tokens[t].start], tokens[t].len)) == NULL)
+			continue;
+		if(JsonExpandPut(out, size, &pos, &Json[src], (uint16_t)(tokens[t].start - src)) ||
+		   JsonExpandPut(out, size, &pos, name, (uint16_t)strlen(name)))
+			return 1;
+		src = keyend;
+	}
+	if(JsonExpandPut(out, size, &pos, &Json[src], (uint16_t)(len - src)))
+		return 1;
+	out[pos] = '\0';
+	*outlen = pos;
+	return 0;
+}
+//===================================
@@ -0,0 +1,190 @@
+/**
+*************************************************************************
+*  	@file: JSONSchema.c
+*
+*  	@brief: Record schema helpers
+*  	@brief: See JSONSchema.h for more details.
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "JSONSchema.h"
+//==========================================================================//
+
+//===================================
+static const uint32_t pow10[10] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+//===================================
+
+//===================================
+/**
+* @brief				: Scale a magnitude and apply its sign, checking the int32_t range
+*/
+static uint8_t JsonSchemaScale(uint32_t mag, uint8_t scale, uint8_t negative, int32_t * value)
+{
+	if(mag > ((0x80000000UL - !negative) / pow10[scale]))
+		return 1;
+	mag *= pow10[scale];
+	*value = negative ? (int32_t)(0U - mag) : (int32_t)mag;
+	return 0;
+}
+//===================================
+
+//===================================
+char * JsonSchemaPutFixed(char * p, int32_t value, uint8_t decimals)
+{
+	char num[JSON_NUMBER_SIZE], *end = num + sizeof(num), *s = JsonFormatFixed(end, value, decimals);
+
+	memcpy(p, s, (size_t)(end - s));
+	return p + (end - s);
+}
+//===================================
+
+//===================================
+char * JsonSchemaPutUInt(char * p, uint32_t value)
+{
+	char num[JSON_NUMBER_SIZE], *end = num + sizeof(num), *s = JsonFormatUInt(end, value, 1);
+
+	memcpy(p, s, (size_t)(end - s));
+	return p + (end - s);
+}
+//===================================
+
+//===================================
+char * JsonSchemaPutBool(char * p, uint8_t value)
+{
+	if(value)
+	{
+		memcpy(p, "true", 4);
+		return p + 4;
+	}
+	memcpy(p, "false", 5);
+	return p + 5;
+}
+//===================================
+
+//===================================
+uint8_t JsonSchemaParseFixed(const char * Json, const JsonToken * token, uint8_t decimals, int32_t * value)
+{
+	const char *s = Json + token->start, *end = s + token->len;
+	uint32_t mag = 0;
+	uint8_t negative = 0, digits = 0, fraction = 0, dot = 0;
+
+	if((token->type != JSON_TOKEN_PRIMITIVE) || (decimals > 9))
+		return 1;
+	if((s < end) && (*s == '-'))
+	{
+		negative = 1;
+		s++;
+	}
+	for(; s < end; s++)
+	{
+		if((*s == '.') && !dot && digits)
+		{
+			dot = 1;
+			continue;
+		}
+		if((*s < '0') || (*s > '9') || (dot && (fraction >= decimals)) || (mag > 429496728UL))
+			return 1;
+		mag = mag * 10 + (uint32_t)(*s - '0');
+		digits++;
+		fraction += dot;
+	}
+	if(!digits || (dot && !fraction))
+		return 1;
+	return JsonSchemaScale(mag, decimals - fraction, negative, value);
+}
+//===================================
+
+//===================================
+uint8_t JsonSchemaParseUInt(const char * Json, const JsonToken * token, uint32_t * value)
+{
+	const char *s = Json + token->start;
+	uint32_t v = 0, d;
+	uint16_t i;
+
+	if((token->type != JSON_TOKEN_PRIMITIVE) || !token->len)
+		return 1;
+	for(i = 0; i < token->len; i++)
+	{
+		d = (uint32_t)(s[i] - '0');
+		if((d > 9) || (v > ((0xFFFFFFFFUL - d) / 10)))
+			return 1;
+		v = v * 10 + d;
+	}
+	*value = v;
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t JsonSchemaParseBool(const char * Json, const JsonToken * token, uint8_t * value)
+{
+	const char *s = Json + token->start;
+
+	if((token->type == JSON_TOKEN_PRIMITIVE) && (token->len == 4) && !memcmp(s, "true", 4))
+		*value = 1;
+	else if((token->type == JSON_TOKEN_PRIMITIVE) && (token->len == 5) && !memcmp(s, "false", 5))
+		*value = 0;
+	else
+		return 1;
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t JsonSchemaCborKey(const uint8_t * Cbor, uint16_t Size, const void * key, uint16_t n, uint16_t *Cpos)
+{
+	if((((uint32_t)*Cpos + n) > Size) || memcmp(&Cbor[*Cpos], key, n))
+		return 1;
+	*Cpos += n;
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t JsonSchemaCborFixed(const uint8_t * Cbor, uint16_t Size, uint8_t decimals, int32_t * value, uint16_t *Cpos)
+{
+	uint16_t pos = *Cpos;
+	int32_t mantissa;
+	uint32_t mag;
+	int8_t exponent;
+
+	if((decimals > 9) || GetDecimalFromCbor(Cbor, Size, &mantissa, &exponent, &pos) || (exponent > 0) || ((decimals + exponent) < 0))
+		return 1;
+	mag = (mantissa < 0) ? (0U - (uint32_t)mantissa) : (uint32_t)mantissa;
+	if(JsonSchemaScale(mag, (uint8_t)(decimals + exponent), mantissa < 0, value))
+		return 1;
+	*Cpos = pos;
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t JsonSchemaCborUInt(const uint8_t * Cbor, uint16_t Size, uint32_t * value, uint16_t *Cpos)
+{
+	uint16_t pos = *Cpos;
+	uint8_t major;
+
+	if(GetHeadFromCbor(Cbor, Size, &major, value, &pos) || (major != CBOR_UINT))
+		return 1;
+	*Cpos = pos;
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t JsonSchemaCborBool(const uint8_t * Cbor, uint16_t Size, uint8_t * value, uint16_t *Cpos)
+{
+	uint16_t pos = *Cpos;
+	uint32_t arg;
+	uint8_t major;
+
+	if(GetHeadFromCbor(Cbor, Size, &major, &arg, &pos) || (major != CBOR_SIMPLE) || ((arg != (CBOR_FALSE & 0x1F)) && (arg != (CBOR_TRUE & 0x1F))))
+		return 1;
+	*value = (arg == (CBOR_TRUE & 0x1F));
+	*Cpos = pos;
+	return 0;
+}
+//===================================
@@ -0,0 +1,490 @@
+/**
+*************************************************************************
+*  	@file: JSONStream.c
+*
+*  	@brief: JSON stream parser
+*  	@brief: See JSONStream.h for more details.
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "JSONStream.h"
+#include <string.h>
+//==========================================================================//
+
+//==========================================================================//
+//								Parser states								//
+//==========================================================================//
+#define JS_EXPECT_VALUE			0			//!< Value, or end of an empty array
+#define JS_EXPECT_KEY			1			//!< Key, or end of an empty object
+#define JS_EXPECT_COLON			2
+#define JS_EXPECT_COMMA			3			//!< Comma, or end of the container
+#define JS_EXPECT_NOTHING		4			//!< Root value complete
+#define JS_STRING				5			//!< Inside a key or a string value
+#define JS_ESCAPE				6			//!< After a backslash
+#define JS_UNICODE				7			//!< Inside a \u escape
+#define JS_LITERAL				8			//!< Inside a number, true, false or null
+//==========================================================================//
+
+//==========================================================================//
+//								Parser flags								//
+//==========================================================================//
+#define JS_FIRST				0x01		//!< No item yet, the container may be closed
+#define JS_KEY					0x02		//!< The string is a key
+//==========================================================================//
+
+//===================================
+static JsonStream	*sink;					//!< Stream fed by JsonStreamSink
+//===================================
+
+//===================================
+static uint8_t JsonStreamIsSpace(char c)
+{
+	return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n');
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Check a number: -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+*/
+static uint8_t JsonStreamIsNumber(const char * s)
+{
+	if(*s == '-')
+		s++;
+	if(*s == '0')
+		s++;
+	else if((*s >= '1') && (*s <= '9'))
+	{
+		while((*s >= '0') && (*s <= '9'))
+			s++;
+	}else
+		return 0;
+	if(*s == '.')
+	{
+		if((*++s < '0') || (*s > '9'))
+			return 0;
+		while((*s >= '0') && (*s <= '9'))
+			s++;
+	}
+	if((*s == 'e') || (*s == 'E'))
+	{
+		if((*++s == '+') || (*s == '-'))
+			s++;
+		if((*s < '0') || (*s > '9'))
+			return 0;
+		while((*s >= '0') && (*s <= '9'))
+			s++;
+	}
+	return !*s;
+}
+//===================================
+
+//===================================
+static int8_t JsonStreamEmit(JsonStream * stream, uint8_t event, const char * data, uint16_t len)
+{
+	if(stream->callback && stream->callback(stream, event, data, len))
+		return JSON_STREAM_ERROR_ABORTED;
+	return 0;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Complete a value: forget its key, expect what follows it
+*/
+static void JsonStreamValueDone(JsonStream * stream)
+{
+	stream->keylen = 0;
+	stream->key[0] = '\0';
+	stream->state = stream->depth ? JS_EXPECT_COMMA : JS_EXPECT_NOTHING;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Append a byte to the current token, giving the filled part of a long string value
+*/
+static int8_t JsonStreamPut(JsonStream * stream, char c)
+{
+	int8_t err;
+
+	if(stream->len >= ((stream->flags & JS_KEY) ? JSON_STREAM_KEY_SIZE : JSON_STREAM_TOKEN_SIZE))
+	{
+		if((stream->state == JS_LITERAL) || (stream->flags & JS_KEY))
+			return JSON_STREAM_ERROR_NOMEM;
+		stream->token[stream->len] = '\0';
+		stream->more = 1;
+		err = JsonStreamEmit(stream, JSON_EVENT_STRING, stream->token, stream->len);
+		stream->more = 0;
+		stream->len = 0;
+		if(err)
+			return err;
+	}
+	stream->token[stream->len++] = c;
+	return 0;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Append a code point to the current string, UTF-8 encoded
+*/
+static int8_t JsonStreamPutCode(JsonStream * stream, uint32_t code)
+{
+	char utf[4];
+	uint8_t n, i;
+	int8_t err;
+
+	if(code < 0x80)
+	{
+		utf[0] = (char)code;
+		n = 1;
+	}else if(code < 0x800)
+	{
+		utf[0] = (char)(0xC0 | (code >> 6));
+		utf[1] = (char)(0x80 | (code & 0x3F));
+		n = 2;
+	}else if(code < 0x10000)
+	{
+		utf[0] = (char)(0xE0 | (code >> 12));
+		utf[1] = (char)(0x80 | ((code >> 6) & 0x3F));
+		utf[2] = (char)(0x80 | (code & 0x3F));
+		n = 3;
+	}else
+	{
+		utf[0] = (char)(0xF0 | (code >> 18));
+		utf[1] = (char)(0x80 | ((code >> 12) & 0x3F));
+		utf[2] = (char)(0x80 | ((code >> 6) & 0x3F));
+		utf[3] = (char)(0x80 | (code & 0x3F));
+		n = 4;
+	}
+	for(i = 0; i < n; i++)
+	{
+		if((err = JsonStreamPut(stream, utf[i])) != 0)
+			return err;
+	}
+	return 0;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Replace a high surrogate left without its low surrogate
+*/
+static int8_t JsonStreamLoneSurrogate(JsonStream * stream)
+{
+	if(!stream->surrogate)
+		return 0;
+	stream->surrogate = 0;
+	return JsonStreamPutCode(stream, 0xFFFD);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Complete a \u escape, pairing the surrogates
+*/
+static int8_t JsonStreamUnicode(JsonStream * stream)
+{
+	uint32_t code = stream->unicode;
+	int8_t err;
+
+	if((code >= 0xDC00) && (code <= 0xDFFF) && stream->surrogate)
+	{
+		code = 0x10000 + (((uint32_t)stream->surrogate - 0xD800) << 10) + (code - 0xDC00);
+		stream->surrogate = 0;
+		return JsonStreamPutCode(stream, code);
+	}
+	if((err = JsonStreamLoneSurrogate(stream)) != 0)
+		return err;
+	if((code >= 0xD800) && (code <= 0xDBFF))
+	{
+		stream->surrogate = (uint16_t)code;
+		return 0;
+	}
+	return JsonStreamPutCode(stream, ((code >= 0xDC00) && (code <= 0xDFFF)) ? 0xFFFD : code);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Complete a key or a string value
+*/
+static int8_t JsonStreamStringDone(JsonStream * stream)
+{
+	int8_t err;
+
+	if((err = JsonStreamLoneSurrogate(stream)) != 0)
+		return err;
+	stream->token[stream->len] = '\0';
+	if(stream->flags & JS_KEY)
+	{
+		memcpy(stream->key, stream->token, stream->len + 1);
+		stream->keylen = (uint8_t)stream->len;
+		stream->flags &= (uint8_t)~JS_KEY;
+		stream->state = JS_EXPECT_COLON;
+		return JsonStreamEmit(stream, JSON_EVENT_KEY, stream->key, stream->keylen);
+	}
+	err = JsonStreamEmit(stream, JSON_EVENT_STRING, stream->token, stream->len);
+	JsonStreamValueDone(stream);
+	return err;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Complete a number, true, false or null
+*/
+static int8_t JsonStreamLiteralDone(JsonStream * stream)
+{
+	uint8_t event;
+	int8_t err;
+
+	stream->token[stream->len] = '\0';
+	if(!strcmp(stream->token, "true"))
+		event = JSON_EVENT_TRUE;
+	else if(!strcmp(stream->token, "false"))
+		event = JSON_EVENT_FALSE;
+	else if(!strcmp(stream->token, "null"))
+		event = JSON_EVENT_NULL;
+	else if(JsonStreamIsNumber(stream->token))
+		event = JSON_EVENT_NUMBER;
+	else
+		return JSON_STREAM_ERROR_INVALID;
+	err = JsonStreamEmit(stream, event, stream->token, stream->len);
+	JsonStreamValueDone(stream);
+	return err;
+}
+//===================================
+
+//===================================
+static int8_t JsonStreamBegin(JsonStream * stream, uint8_t object)
+{
+	int8_t err;
+
+	if(stream->depth >= JSON_STREAM_DEPTH)
+		return JSON_STREAM_ERROR_NOMEM;
+	stream->token[0] = '\0';
+	if((err = JsonStreamEmit(stream, object ? JSON_EVENT_BEGIN_OBJECT : JSON_EVENT_BEGIN_ARRAY, stream->token, 0)) != 0)
+		return err;
+	if(object)
+		stream->stack |= (1UL << stream->depth);
+	else
+		stream->stack &= ~(1UL << stream->depth);
+	stream->depth++;
+	stream->keylen = 0;
+	stream->key[0] = '\0';
+	stream->flags |= JS_FIRST;
+	stream->state = object ? JS_EXPECT_KEY : JS_EXPECT_VALUE;
+	return 0;
+}
+//===================================
+
+//===================================
+static int8_t JsonStreamEnd(JsonStream * stream, uint8_t object)
+{
+	if(!stream->depth || (((stream->stack >> (stream->depth - 1)) & 1) != object))
+		return JSON_STREAM_ERROR_INVALID;
+	stream->depth--;
+	stream->token[0] = '\0';
+	JsonStreamValueDone(stream);
+	return JsonStreamEmit(stream, object ? JSON_EVENT_END_OBJECT : JSON_EVENT_END_ARRAY, stream->token, 0);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Handle a character outside of any token
+*/
+static int8_t JsonStreamStructure(JsonStream * stream, char c)
+{
+	uint8_t first = stream->flags & JS_FIRST;
+
+	switch(stream->state)
+	{
+		case JS_EXPECT_VALUE:
+			stream->flags &= (uint8_t)~JS_FIRST;
+			stream->len = 0;
+			if((c == '{') || (c == '['))
+				return JsonStreamBegin(stream, c == '{');
+			if(c == '"')
+			{
+				stream->state = JS_STRING;
+				return 0;
+			}
+			if((c == ']') && first)
+				return JsonStreamEnd(stream, 0);
+			if((c == '-') || ((c >= '0') && (c <= '9')) || (c == 't') || (c == 'f') || (c == 'n'))
+			{
+				stream->state = JS_LITERAL;
+				return JsonStreamPut(stream, c);
+			}
+			return JSON_STREAM_ERROR_INVALID;
+		case JS_EXPECT_KEY:
+			stream->flags &= (uint8_t)~JS_FIRST;
+			if(c == '"')
+			{
+				stream->len = 0;
+				stream->flags |= JS_KEY;
+				stream->state = JS_STRING;
+				return 0;
+			}
+			if((c == '}') && first)
+				return JsonStreamEnd(stream, 1);
+			return JSON_STREAM_ERROR_INVALID;
+		case JS_EXPECT_COLON:
+			if(c != ':')
+				return JSON_STREAM_ERROR_INVALID;
+			stream->state = JS_EXPECT_VALUE;
+			return 0;
+		case JS_EXPECT_COMMA:
+			if(c == ',')
+			{
+				stream->state = ((stream->stack >> (stream->depth - 1)) & 1) ? JS_EXPECT_KEY : JS_EXPECT_VALUE;
+				return 0;
+			}
+			if((c == '}') || (c == ']'))
+				return JsonStreamEnd(stream, c == '}');
+			return JSON_STREAM_ERROR_INVALID;
+		default:
+			return JSON_STREAM_ERROR_INVALID;
+	}
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Handle a character inside a string
+*/
+static int8_t JsonStreamString(JsonStream * stream, char c)
+{
+	int8_t err;
+	uint8_t h;
+
+	switch(stream->state)
+	{
+		case JS_STRING:
+			if(c == '"')
+				return JsonStreamStringDone(stream);
+			if(c == '\\')
+			{
+				stream->state = JS_ESCAPE;
+				return 0;
+			}
+			if((uint8_t)c < 0x20)
+				return JSON_STREAM_ERROR_INVALID;
+			if((err = JsonStreamLoneSurrogate(stream)) != 0)
+				return err;
+			return JsonStreamPut(stream, c);
+		case JS_ESCAPE:
+			stream->state = JS_STRING;
+			if(c == 'u')
+			{
+				stream->state = JS_UNICODE;
+				stream->unicode = 0;
+				stream->hex = 0;
+				return 0;
+			}
+			if((err = JsonStreamLoneSurrogate(stream)) != 0)
+				return err;
+			switch(c)
+			{
+				case '"':
+				case '\\':
+				case '/':	return JsonStreamPut(stream, c);
+				case 'b':	return JsonStreamPut(stream, '\b');
+				case 'f':	return JsonStreamPut(stream, '\f');
+				case 'n':	return JsonStreamPut(stream, '\n');
+				case 'r':	return JsonStreamPut(stream, '\r');
+				case 't':	return JsonStreamPut(stream, '\t');
+				default:	return JSON_STREAM_ERROR_INVALID;
+			}
+		default:
+			if((c >= '0') && (c <= '9'))
+				h = (uint8_t)(c - '0');
+			else if(((c | 0x20) >= 'a') && ((c | 0x20) <= 'f'))
+				h = (uint8_t)((c | 0x20) - 'a' + 10);
+			else
+				return JSON_STREAM_ERROR_INVALID;
+			stream->unicode = (uint16_t)((stream->unicode << 4) | h);
+			if(++stream->hex < 4)
+				return 0;
+			stream->state = JS_STRING;
+			return JsonStreamUnicode(stream);
+	}
+}
+//===================================
+
+//===================================
+void JsonStreamInit(JsonStream * stream, JsonStreamCallBack callback, void * user)
+{
+	memset(stream, 0, sizeof(JsonStream));
+	stream->callback = callback;
+	stream->user = user;
+	stream->state = JS_EXPECT_VALUE;
+}
+//===================================
+
+//===================================
+uint8_t JsonStreamFeed(JsonStream * stream, const char * data, uint16_t len)
+{
+	uint16_t i = 0;
+	int8_t err = 0;
+	char c;
+
+	if(stream->error)
+		return 1;
+	while(!err && (i < len))
+	{
+		c = data[i];
+		if(stream->state == JS_LITERAL)
+		{
+			if(JsonStreamIsSpace(c) || (c == ',') || (c == ':') || (c == ']') || (c == '}'))
+				err = JsonStreamLiteralDone(stream);									//!< The delimiter is handled next
+			else
+			{
+				err = JsonStreamPut(stream, c);
+				i++;
+			}
+		}else if(stream->state >= JS_STRING)
+			err = JsonStreamString(stream, data[i++]);
+		else if(JsonStreamIsSpace(c))
+			i++;
+		else
+			err = JsonStreamStructure(stream, data[i++]);
+	}
+	stream->offset += i;
+	stream->error = err;
+	return (err != 0);
+}
+//===================================
+
+//===================================
+uint8_t JsonStreamFinish(JsonStream * stream)
+{
+	if(!stream->error && (stream->state == JS_LITERAL) && !stream->depth)
+		stream->error = JsonStreamLiteralDone(stream);
+	if(!stream->error && (stream->state != JS_EXPECT_NOTHING))
+		stream->error = JSON_STREAM_ERROR_PARTIAL;
+	return (stream->error != 0);
+}
+//===================================
+
+//===================================
+void JsonStreamSetSink(JsonStream * stream)
+{
+	sink = stream;
+}
+//===================================
+
+//===================================
+uint8_t JsonStreamSink(const uint8_t * data, uint16_t len, uint32_t offset)
+{
+	if(!sink || (offset != sink->offset))
+		return 0;
+	return !JsonStreamFeed(sink, (const char *)data, len);
+}
+//===================================
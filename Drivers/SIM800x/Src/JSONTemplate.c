@@ -0,0 +1,71 @@
+/**
+*************************************************************************
+*  	@file: JSONTemplate.c
+*
+*  	@brief: JSON templates
+*  	@brief: See JSONTemplate.h for more details.
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "JSONTemplate.h"
+#include <string.h>
+//==========================================================================//
+
+//===================================
+/**
+* @brief				: Format a number right-aligned, padded with spaces
+*/
+static uint8_t JsonTemplateFormat(char * out, int32_t value, uint8_t width, uint8_t decimals)
+{
+	char num[JSON_NUMBER_SIZE], *end = num + sizeof(num), *p = JsonFormatFixed(end, value, decimals);
+	uint8_t n = (uint8_t)(end - p);
+
+	if(n > width)
+		return 1;
+	memset(out, ' ', width - n);
+	memcpy(&out[width - n], p, n);
+	return 0;
+}
+//===================================
+
+//===================================
+void JsonTemplateInit(JsonTemplate * tmpl, char * buf, uint16_t size)
+{
+	JsonBuilderInit(&tmpl->builder, buf, size);
+	tmpl->count = 0;
+}
+//===================================
+
+//===================================
+uint8_t JsonTemplateAddNumber(JsonTemplate * tmpl, const char * key, uint8_t width, uint8_t decimals)
+{
+	char value[JSON_NUMBER_SIZE + 1];
+
+	if((tmpl->count >= JSON_TEMPLATE_FIELDS) || !width || (width > JSON_NUMBER_SIZE) || (decimals > 9) ||
+	   JsonTemplateFormat(value, 0, width, decimals))
+		return 1;
+	value[width] = '\0';
+	if(JsonBuilderAddRaw(&tmpl->builder, key, value))
+		return 1;
+	tmpl->fields[tmpl->count].offset = (uint16_t)(tmpl->builder.len - width);
+	tmpl->fields[tmpl->count].width = width;
+	tmpl->fields[tmpl->count].decimals = decimals;
+	tmpl->count++;
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t JsonTemplateSetNumber(JsonTemplate * tmpl, uint8_t field, int32_t value)
+{
+	const JsonTemplateField *f;
+
+	if(field >= tmpl->count)
+		return 1;
+	f = &tmpl->fields[field];
+	return JsonTemplateFormat(&tmpl->builder.buf[f->offset], value, f->width, f->decimals);
+}
+//===================================
@@ -0,0 +1,280 @@
+/**
+*************************************************************************
+*  	@file: JSONTokenizer.c
+*
+*  	@brief: JSON tokenizer
+*  	@brief: See JSONTokenizer.h for more details.
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "JSONTokenizer.h"
+#include <string.h>
+//==========================================================================//
+
+//==========================================================================//
+//								Parser states								//
+//==========================================================================//
+#define JT_EXPECT_VALUE			0			//!< Value, or end of an empty array
+#define JT_EXPECT_KEY			1			//!< Key, or end of an empty object
+#define JT_EXPECT_COLON			2
+#define JT_EXPECT_COMMA			3			//!< Comma, or end of the container
+#define JT_EXPECT_NOTHING		4			//!< Root value complete
+//==========================================================================//
+
+//===================================
+static const JsonToken	*lasttokens;		//!< Last GetJsonChild lookup
+static int16_t			lastparent = -1;
+static uint16_t			lastidx;
+static int16_t			lasttok;
+//===================================
+
+//===================================
+/**
+* @brief				: Complete a value token, and the key it belongs to
+* @retval				: Container the value belongs to
+*/
+static int16_t JsonValueDone(JsonToken * tokens, int16_t tok, int16_t n)
+{
+	int16_t p = tokens[tok].parent;
+
+	tokens[tok].end = (uint16_t)n;
+	if((p >= 0) && (tokens[p].type == JSON_TOKEN_STRING))
+	{
+		tokens[p].end = (uint16_t)n;
+		p = tokens[p].parent;
+	}
+	return p;
+}
+//===================================
+
+//===================================
+static uint8_t JsonIsDelimiter(char c)
+{
+	return (c == ',') || (c == ':') || (c == ']') || (c == '}') || (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n');
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Hash of a document key, same as JSON_KEY_HASH
+*/
+static uint32_t JsonKeyHash(const char * key, uint16_t len)
+{
+	if(!len)
+		return 0;
+	return ((uint32_t)(uint8_t)len << 24) | ((uint32_t)(uint8_t)key[0] << 16) | ((uint32_t)(uint8_t)key[len / 2] << 8) | (uint8_t)key[len - 1];
+}
+//===================================
+
+//===================================
+int16_t TokenizeJson(const char * Json, uint16_t len, JsonToken * tokens, uint16_t count)
+{
+	int16_t n = 0, super = -1, parent = -1, tok;
+	uint16_t pos = 0, start;
+	uint8_t expect = JT_EXPECT_VALUE, type;
+	char c;
+
+	lastparent = -1;
+	for(; pos < len; pos++)
+	{
+		c = Json[pos];
+		if((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n'))
+			continue;
+		switch(c)
+		{
+			case '{':
+			case '[':
+			case '"':
+			default:
+				if((c == '"') ? ((expect != JT_EXPECT_VALUE) && (expect != JT_EXPECT_KEY)) : (expect != JT_EXPECT_VALUE))
+					return JSON_ERROR_INVALID;
+				if(n >= (int16_t)count)
+					return JSON_ERROR_NOMEM;
+				tok = n++;
+				start = pos;
+				type = (c == '{') ? JSON_TOKEN_OBJECT : (c == '[') ? JSON_TOKEN_ARRAY : (c == '"') ? JSON_TOKEN_STRING : JSON_TOKEN_PRIMITIVE;
+				if(type == JSON_TOKEN_STRING)
+				{
+					for(start = ++pos; (pos < len) && (Json[pos] != '"'); pos++)
+					{
+						if(Json[pos] == '\\')
+							pos++;
+					}
+					if(pos >= len)
+						return JSON_ERROR_PARTIAL;
+				}else if(type == JSON_TOKEN_PRIMITIVE)
+				{
+					if((c != '-') && ((c < '0') || (c > '9')) && (c != 't') && (c != 'f') && (c != 'n'))
+						return JSON_ERROR_INVALID;
+					while(((pos + 1) < len) && !JsonIsDelimiter(Json[pos + 1]))
+						pos++;
+				}
+				tokens[tok].type = type;
+				tokens[tok].parent = parent;
+				tokens[tok].start = start;
+				tokens[tok].len = (uint16_t)(pos + (type != JSON_TOKEN_STRING) - start);		//!< Containers completed at their end
+				tokens[tok].size = 0;
+				tokens[tok].end = (uint16_t)n;
+				if(super >= 0)
+					tokens[super].size += (expect == JT_EXPECT_KEY) || (tokens[super].type == JSON_TOKEN_ARRAY);
+				if(expect == JT_EXPECT_KEY)											//!< Object key, its value is its child
+				{
+					tokens[tok].size = 1;
+					parent = tok;
+					expect = JT_EXPECT_COLON;
+				}else if((type == JSON_TOKEN_OBJECT) || (type == JSON_TOKEN_ARRAY))
+				{
+					super = parent = tok;
+					expect = (type == JSON_TOKEN_OBJECT) ? JT_EXPECT_KEY : JT_EXPECT_VALUE;
+				}else
+				{
+					super = JsonValueDone(tokens, tok, n);
+					parent = super;
+					expect = (super < 0) ? JT_EXPECT_NOTHING : JT_EXPECT_COMMA;
+				}
+				break;
+			case '}':
+			case ']':
+				if((super < 0) || (tokens[super].type != ((c == '}') ? JSON_TOKEN_OBJECT : JSON_TOKEN_ARRAY)))
+					return JSON_ERROR_INVALID;
+				if((expect != JT_EXPECT_COMMA) && (tokens[super].size || (expect == JT_EXPECT_COLON)))
+					return JSON_ERROR_INVALID;								//!< Trailing comma, or dangling key
+				tokens[super].len = (uint16_t)(pos + 1 - tokens[super].start);
+				super = JsonValueDone(tokens, super, n);
+				parent = super;
+				expect = (super < 0) ? JT_EXPECT_NOTHING : JT_EXPECT_COMMA;
+				break;
+			case ':':
+				if(expect != JT_EXPECT_COLON)
+					return JSON_ERROR_INVALID;
+				expect = JT_EXPECT_VALUE;
+				break;
+			case ',':
+				if(expect != JT_EXPECT_COMMA)
+					return JSON_ERROR_INVALID;
+				expect = (tokens[super].type == JSON_TOKEN_OBJECT) ? JT_EXPECT_KEY : JT_EXPECT_VALUE;
+				break;
+		}
+	}
+	if(expect != JT_EXPECT_NOTHING)
+		return JSON_ERROR_PARTIAL;
+	return n;
+}
+//===================================
+
+//===================================
+int16_t GetJsonChild(const JsonToken * tokens, int16_t parent, uint16_t idx)
+{
+	int16_t tok = parent + 1;
+	uint16_t i = 0;
+
+	if(idx >= tokens[parent].size)
+		return -1;
+	if((tokens == lasttokens) && (parent == lastparent) && (idx >= lastidx))	//!< Resume from the last lookup
+	{
+		tok = lasttok;
+		i = lastidx;
+	}
+	for(; i < idx; i++)
+		tok = (int16_t)tokens[tok].end;
+	lasttokens = tokens;
+	lastparent = parent;
+	lastidx = idx;
+	lasttok = tok;
+	return tok;
+}
+//===================================
+
+//===================================
+int16_t GetNextJsonSibling(const JsonToken * tokens, int16_t tok)
+{
+	int16_t p = tokens[tok].parent;
+
+	if((p < 0) || (tokens[tok].end >= tokens[p].end))
+		return -1;
+	return (int16_t)tokens[tok].end;
+}
+//===================================
+
+//===================================
+uint8_t GetValueViewFromJsonArray(const char * Json, const JsonToken * tokens, int16_t array, uint16_t idx, JsonView * value)
+{
+	int16_t tok;
+
+	if((tokens[array].type != JSON_TOKEN_ARRAY) || ((tok = GetJsonChild(tokens, array, idx)) < 0))
+		return 1;
+	value->ptr = Json + tokens[tok].start;
+	value->len = tokens[tok].len;
+	return 0;
+}
+//===================================
+
+//===================================
+uint8_t GetEntryViewFromJsonObject(const char * Json, const JsonToken * tokens, int16_t object, uint16_t idx, JsonView * key, JsonView * value)
+{
+	int16_t tok;
+
+	if((tokens[object].type != JSON_TOKEN_OBJECT) || ((tok = GetJsonChild(tokens, object, idx)) < 0))
+		return 1;
+	key->ptr = Json + tokens[tok].start;
+	key->len = tokens[tok].len;
+	value->ptr = Json + tokens[tok + 1].start;
+	value->len = tokens[tok + 1].len;
+	return 0;
+}
+//===================================
+
+//===================================
+int16_t FindJsonKey(const char * Json, const JsonToken * tokens, int16_t object, const JsonKey * key)
+{
+	int16_t value;
+
+	FindJsonKeys(Json, tokens, object, key, 1, &value);
+	return value;
+}
+//===================================
+
+//===================================
+uint8_t FindJsonKeys(const char * Json, const JsonToken * tokens, int16_t object, const JsonKey * keys, uint8_t count, int16_t * values)
+{
+	int16_t tok = object + 1;
+	uint16_t n;
+	uint32_t hash;
+	uint8_t i, found = 0;
+
+	for(i = 0; i < count; i++)
+		values[i] = -1;
+	if(tokens[object].type != JSON_TOKEN_OBJECT)
+		return 0;
+	for(n = 0; (n < tokens[object].size) && (found < count); n++, tok = (int16_t)tokens[tok].end)
+	{
+		hash = JsonKeyHash(Json + tokens[tok].start, tokens[tok].len);
+		for(i = 0; i < count; i++)
+		{
+			if((values[i] < 0) && (keys[i].hash == hash) && (keys[i].len == tokens[tok].len) && !memcmp(keys[i].name, Json + tokens[tok].start, keys[i].len))
+			{
+				values[i] = tok + 1;
+				found++;
+				break;
+			}
+		}
+	}
+	return found;
+}
+//===================================
+
+//===================================
+uint8_t GetValueViewFromJsonKey(const char * Json, const JsonToken * tokens, int16_t object, const JsonKey * key, JsonView * value)
+{
+	int16_t tok = FindJsonKey(Json, tokens, object, key);
+
+	if(tok < 0)
+		return 1;
+	value->ptr = Json + tokens[tok].start;
+	value->len = tokens[tok].len;
+	return 0;
+}
+//===================================
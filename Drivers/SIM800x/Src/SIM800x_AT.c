@@ -0,0 +1,240 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_AT.c
+ * @author          Firmware-Engineers
+ * @brief           SIM800 series modems AT command channel helpers
+ * @brief           See SIM800x_AT.h for more details.
+ ******************************************************************************
+ */
+
+//-----------------------------------
+#include "SIM800x_AT.h"
+#include "SIM800x_SDM.h"
+#include <string.h>
+#include <stdlib.h>
+//-----------------------------------
+
+//-----------------------------------
+static SIM800xATURCHandler urchandlers[CONFIG_AT_MAX_URC_HANDLERS];
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Check the final result codes common to every command
+ */
+static uint8_t ATFinalResult(const char* line, SIM800x_APIStatusType* status, uint16_t* errcode)
+{
+    if(!strcmp(line, "OK"))
+    {
+        *status = SIM800X_OK;
+        return 1;
+    }
+    if(!strcmp(line, "ERROR"))
+    {
+        *status = SIM800X_ERROR;
+        return 1;
+    }
+    if(!strncmp(line, "+CME ERROR:", 11))
+    {
+        if(errcode)
+            *errcode = (uint16_t)strtoul(&line[11], NULL, 10);
+        *status = SIM800X_CME_ERROR;
+        return 1;
+    }
+    return 0;
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xATRegisterURC(SIM800xATURCHandler handler)
+{
+    uint8_t i;
+    //---------
+    for(i = 0; i < CONFIG_AT_MAX_URC_HANDLERS; i++)
+    {
+        if(urchandlers[i] == handler)
+            return SIM800X_OK;
+    }
+    for(i = 0; i < CONFIG_AT_MAX_URC_HANDLERS; i++)
+    {
+        if(!urchandlers[i])
+        {
+            urchandlers[i] = handler;
+            return SIM800X_OK;
+        }
+    }
+    return SIM800X_ERROR;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+uint8_t SIM800xATDispatch(const char* line)
+{
+    uint8_t i;
+    //---------
+    for(i = 0; i < CONFIG_AT_MAX_URC_HANDLERS; i++)
+    {
+        if(urchandlers[i] && urchandlers[i](line))
+            return 1;
+    }
+    return 0;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+int SIM800xATReadLine(char* line, uint16_t size, uint32_t tout)
+{
+    uint32_t start = Tick();
+    uint16_t n = 0;
+    uint8_t c;
+    //---------
+    while((Tick() - start) < tout)
+    {
+        if(!SIM800xSDMRxAvailable())
+            continue;
+        c = SIM800xSDMReadByte();
+        if(c == '\r')
+            continue;
+        if(c == '\n')
+        {
+            if(!n)
+                continue;
+            line[n] = 0;
+            return n;
+        }
+        if(!n && (c == ' '))
+            continue;
+        if(!n && (c == '>'))
+        {
+            line[0] = '>';
+            line[1] = 0;
+            return 1;
+        }
+        if(n < (size - 1))
+            line[n++] = (char)c;
+    }
+    line[n] = 0;
+    return -1;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xATCommand(const char* cmd, const char* prefix, char* resp, uint16_t size, uint32_t tout, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    char line[CONFIG_AT_LINE_SIZE];
+    uint32_t start, elapsed;
+    uint16_t plen = (uint16_t)(prefix ? strlen(prefix) : 0);
+    //---------
+    SIM800xATPoll();
+    SIM800xSDMPrint(cmd);
+    SIM800xSDMPrint("\r");
+    start = Tick();
+    while((elapsed = Tick() - start) < tout)
+    {
+        if(SIM800xATReadLine(line, sizeof(line), tout - elapsed) < 0)
+            break;
+        if(ATFinalResult(line, &status, errcode))
+            return status;
+        if(plen && !strncmp(line, prefix, plen))
+        {
+            if(resp && size)
+            {
+                strncpy(resp, line, size - 1);
+                resp[size - 1] = 0;
+            }
+            continue;
+        }
+        SIM800xATDispatch(line);
+    }
+    return SIM800X_TIME_OUT;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xATWaitLine(const char* prefix, char* line, uint16_t size, uint32_t tout, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    char buf[CONFIG_AT_LINE_SIZE];
+    uint32_t start = Tick(), elapsed;
+    uint16_t plen = (uint16_t)strlen(prefix);
+    //---------
+    while((elapsed = Tick() - start) < tout)
+    {
+        if(SIM800xATReadLine(buf, sizeof(buf), tout - elapsed) < 0)
+            break;
+        if(!strncmp(buf, prefix, plen))
+        {
+            if(line && size)
+            {
+                strncpy(line, buf, size - 1);
+                line[size - 1] = 0;
+            }
+            return SIM800X_OK;
+        }
+        if(ATFinalResult(buf, &status, errcode) && (status != SIM800X_OK))
+            return status;
+        SIM800xATDispatch(buf);
+    }
+    return SIM800X_TIME_OUT;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xATPoll(void)
+{
+    char line[CONFIG_AT_LINE_SIZE];
+    uint16_t i, n;
+    //---------
+    for(;;)
+    {
+        n = SIM800xSDMRxAvailable();
+        if(n > 0xFF)
+            n = 0xFF;                                                           //!< SIM800xSDMPeek() index range
+        for(i = 0; i < n; i++)
+        {
+            if(SIM800xSDMPeek((uint8_t)i) == '\n')
+                break;
+        }
+        if(i >= n)
+            return;
+        if(SIM800xATReadLine(line, sizeof(line), 10) > 0)
+            SIM800xATDispatch(line);
+    }
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+char* SIM800xATAppendStr(char* dst, const char* src)
+{
+    while(*src)
+        *dst++ = *src++;
+    *dst = 0;
+    return dst;
+}
+//-----------------------------------
+
+//-----------------------------------
+char* SIM800xATAppendUInt(char* dst, uint32_t value)
+{
+    char tmp[10];
+    uint8_t n = 0;
+    //---------
+    do
+    {
+        tmp[n++] = (char)('0' + (value % 10));
+        value /= 10;
+    }while(value);
+    while(n)
+        *dst++ = tmp[--n];
+    *dst = 0;
+    return dst;
+    //---------
+}
+//-----------------------------------
@@ -0,0 +1,197 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_Batch.c
+ * @author          Firmware-Engineers
+ * @brief           Telemetry batching layer
+ * @brief           See SIM800x_Batch.h for more details.
+ ******************************************************************************
+ */
+
+//-----------------------------------
+#include "SIM800x_Batch.h"
+#include "SIM800x_SDM.h"
+#include <string.h>
+//-----------------------------------
+
+//-----------------------------------
+#define BATCH_NONE                          0xFF                                //!< No sealed batch
+#define BATCH_POST                          1                                   //!< SIM800xHTTPAction() POST method
+//-----------------------------------
+
+/**
+  * @brief  Batch buffer type definition
+  */
+typedef struct
+{
+    //---------
+    uint8_t                 data[CONFIG_BATCH_BUFFER_SIZE];
+    uint16_t                len;
+    uint16_t                records;
+    uint32_t                first;                                              //!< Tick of the first record
+    uint8_t                 priority;
+    //---------
+}SIM800xBatchBufferType;
+//-----------------------------------
+
+//-----------------------------------
+static SIM800xBatchBufferType       batchbuf[2];
+static SIM800xBatchStatsType        batchstats;
+static SIM800xHTTPSessionType*      batchsession;
+static SIM800xBatchFormatType       batchformat;
+static uint16_t                     batchsize = CONFIG_BATCH_FLUSH_SIZE;
+static uint32_t                     batchage = CONFIG_BATCH_MAX_AGE;
+static uint8_t                      batchactive;                                //!< Buffer receiving records
+static uint8_t                      batchsealed = BATCH_NONE;                   //!< Buffer in flight
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Seal the active batch and switch buffers
+ * @retval  1 if sealed, 0 if the previous batch is still in flight
+ */
+static uint8_t BatchSeal(void)
+{
+    SIM800xBatchBufferType* buf = &batchbuf[batchactive];
+    //---------
+    if((batchsealed != BATCH_NONE) || !buf->records)
+        return 0;
+    if(batchformat == BATCH_JSON_ARRAY)
+        buf->data[buf->len++] = ']';                                            //!< Room kept by SIM800xBatchAdd()
+    batchsealed = batchactive;
+    batchactive ^= 1;
+    return 1;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static SIM800x_APIStatusType BatchSend(uint32_t tout, uint16_t* statuscode, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    SIM800xBatchBufferType* buf;
+    uint32_t rcnt, latency;
+    uint16_t scode = 0;
+    //---------
+    if(batchsealed == BATCH_NONE)
+        return SIM800X_OK;
+    buf = &batchbuf[batchsealed];
+    status = SIM800xHTTPSessionRequest(batchsession, BATCH_POST, (char*)buf->data, buf->len, &scode, &rcnt, tout, errcode);
+    if(statuscode)
+        *statuscode = scode;
+    if((status == SIM800X_OK) && ((scode < 200) || (scode > 299)))
+        status = SIM800X_ERROR;
+    if(status != SIM800X_OK)
+    {
+        batchstats.failures++;
+        return status;
+    }
+    //---------
+    latency = Tick() - buf->first;
+    batchstats.batches++;
+    batchstats.records += buf->records;
+    batchstats.bytes += buf->len;
+    batchstats.latency += latency;
+    if(buf->records > batchstats.maxrecords)
+        batchstats.maxrecords = buf->records;
+    if(latency > batchstats.maxlatency)
+        batchstats.maxlatency = latency;
+    buf->len = 0;
+    buf->records = 0;
+    buf->priority = 0;
+    batchsealed = BATCH_NONE;
+    return SIM800X_OK;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xBatchInit(SIM800xHTTPSessionType* session, SIM800xBatchFormatType format)
+{
+    batchsession = session;
+    batchformat = format;
+    batchsize = CONFIG_BATCH_FLUSH_SIZE;
+    batchage = CONFIG_BATCH_MAX_AGE;
+    memset(batchbuf, 0, sizeof(batchbuf));
+    memset(&batchstats, 0, sizeof(batchstats));
+    batchactive = 0;
+    batchsealed = BATCH_NONE;
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xBatchSetThresholds(uint16_t size, uint32_t age)
+{
+    batchsize = size;
+    batchage = age;
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xBatchAdd(const void* record, uint16_t len, uint8_t priority)
+{
+    SIM800xBatchBufferType* buf = &batchbuf[batchactive];
+    uint32_t need = (uint32_t)len + 2;                                          //!< '[' or ',' and ']', or the length prefix
+    //---------
+    if(need > CONFIG_BATCH_BUFFER_SIZE)
+        return SIM800X_ERROR;
+    if(((uint32_t)buf->len + need) > CONFIG_BATCH_BUFFER_SIZE)
+    {
+        if(!BatchSeal())
+        {
+            batchstats.dropped++;
+            return SIM800X_BUSY;
+        }
+        buf = &batchbuf[batchactive];
+    }
+    if(!buf->records)
+        buf->first = Tick();
+    if(batchformat == BATCH_JSON_ARRAY)
+        buf->data[buf->len++] = buf->records ? ',' : '[';
+    else
+    {
+        buf->data[buf->len++] = (uint8_t)(len >> 8);
+        buf->data[buf->len++] = (uint8_t)len;
+    }
+    memcpy(&buf->data[buf->len], record, len);
+    buf->len = (uint16_t)(buf->len + len);
+    buf->records++;
+    buf->priority |= priority;
+    return SIM800X_OK;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xBatchPoll(uint32_t tout, uint16_t* statuscode, uint16_t* errcode)
+{
+    SIM800xBatchBufferType* buf = &batchbuf[batchactive];
+    //---------
+    if(buf->records && (buf->priority || (buf->len >= batchsize) || ((Tick() - buf->first) >= batchage)))
+        BatchSeal();
+    return BatchSend(tout, statuscode, errcode);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xBatchFlush(uint32_t tout, uint16_t* statuscode, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    //---------
+    status = BatchSend(tout, statuscode, errcode);                              //!< Older batch first
+    if(status != SIM800X_OK)
+        return status;
+    BatchSeal();
+    return BatchSend(tout, statuscode, errcode);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xBatchGetStats(SIM800xBatchStatsType* stats, uint8_t reset)
+{
+    *stats = batchstats;
+    if(reset)
+        memset(&batchstats, 0, sizeof(batchstats));
+}
+//-----------------------------------
@@ -0,0 +1,134 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_CRC.c
+ * @author          Firmware-Engineers
+ * @brief           API checksum and digest helpers
+ * @brief           See SIM800x_CRC.h for more details.
+ ******************************************************************************
+ */
+
+//-----------------------------------
+#include "SIM800x_CRC.h"
+//-----------------------------------
+
+//-----------------------------------
+static const uint32_t crctable[16] =
+{
+    0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL, 0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+    0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL, 0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+//-----------------------------------
+
+//-----------------------------------
+static const uint32_t md5k[64] =
+{
+    0xD76AA478UL, 0xE8C7B756UL, 0x242070DBUL, 0xC1BDCEEEUL,
+    0xF57C0FAFUL, 0x4787C62AUL, 0xA8304613UL, 0xFD469501UL,
+    0x698098D8UL, 0x8B44F7AFUL, 0xFFFF5BB1UL, 0x895CD7BEUL,
+    0x6B901122UL, 0xFD987193UL, 0xA679438EUL, 0x49B40821UL,
+    0xF61E2562UL, 0xC040B340UL, 0x265E5A51UL, 0xE9B6C7AAUL,
+    0xD62F105DUL, 0x02441453UL, 0xD8A1E681UL, 0xE7D3FBC8UL,
+    0x21E1CDE6UL, 0xC33707D6UL, 0xF4D50D87UL, 0x455A14EDUL,
+    0xA9E3E905UL, 0xFCEFA3F8UL, 0x676F02D9UL, 0x8D2A4C8AUL,
+    0xFFFA3942UL, 0x8771F681UL, 0x6D9D6122UL, 0xFDE5380CUL,
+    0xA4BEEA44UL, 0x4BDECFA9UL, 0xF6BB4B60UL, 0xBEBFBC70UL,
+    0x289B7EC6UL, 0xEAA127FAUL, 0xD4EF3085UL, 0x04881D05UL,
+    0xD9D4D039UL, 0xE6DB99E5UL, 0x1FA27CF8UL, 0xC4AC5665UL,
+    0xF4292244UL, 0x432AFF97UL, 0xAB9423A7UL, 0xFC93A039UL,
+    0x655B59C3UL, 0x8F0CCC92UL, 0xFFEFF47DUL, 0x85845DD1UL,
+    0x6FA87E4FUL, 0xFE2CE6E0UL, 0xA3014314UL, 0x4E0811A1UL,
+    0xF7537E82UL, 0xBD3AF235UL, 0x2AD7D2BBUL, 0xEB86D391UL
+};
+static const uint8_t md5r[16] = {7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21};
+//-----------------------------------
+
+//-----------------------------------
+uint32_t SIM800xCRC32(uint32_t crc, const void* data, uint32_t len)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    //---------
+    crc = ~crc;
+    while(len--)
+    {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ crctable[crc & 0x0F];
+        crc = (crc >> 4) ^ crctable[crc & 0x0F];
+    }
+    return ~crc;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static void MD5Transform(SIM800xMD5Type* ctx)
+{
+    uint32_t m[16], a, b, c, d, f, t;
+    uint8_t i, g;
+    //---------
+    for(i = 0; i < 16; i++)
+    {
+        m[i] = (uint32_t)ctx->block[i * 4] | ((uint32_t)ctx->block[i * 4 + 1] << 8) |
+               ((uint32_t)ctx->block[i * 4 + 2] << 16) | ((uint32_t)ctx->block[i * 4 + 3] << 24);
+    }
+    a = ctx->state[0]; b = ctx->state[1]; c = ctx->state[2]; d = ctx->state[3];
+    for(i = 0; i < 64; i++)
+    {
+        if(i < 16)      { f = (b & c) | (~b & d);   g = i; }
+        else if(i < 32) { f = (d & b) | (~d & c);   g = (uint8_t)((5 * i + 1) & 0x0F); }
+        else if(i < 48) { f = b ^ c ^ d;            g = (uint8_t)((3 * i + 5) & 0x0F); }
+        else            { f = c ^ (b | ~d);         g = (uint8_t)((7 * i) & 0x0F); }
+        t = d;
+        d = c;
+        c = b;
+        f = a + f + md5k[i] + m[g];
+        b = b + ((f << md5r[(i >> 4) * 4 + (i & 3)]) | (f >> (32 - md5r[(i >> 4) * 4 + (i & 3)])));
+        a = t;
+    }
+    ctx->state[0] += a; ctx->state[1] += b; ctx->state[2] += c; ctx->state[3] += d;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xMD5Init(SIM800xMD5Type* ctx)
+{
+    ctx->state[0] = 0x67452301UL;
+    ctx->state[1] = 0xEFCDAB89UL;
+    ctx->state[2] = 0x98BADCFEUL;
+    ctx->state[3] = 0x10325476UL;
+    ctx->count = 0;
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xMD5Update(SIM800xMD5Type* ctx, const uint8_t* data, uint32_t len)
+{
+    while(len--)
+    {
+        ctx->block[ctx->count++ & 0x3F] = *data++;
+        if((ctx->count & 0x3F) == 0)
+            MD5Transform(ctx);
+    }
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xMD5Final(SIM800xMD5Type* ctx, uint8_t* digest)
+{
+    uint32_t bits = ctx->count << 3;
+    uint8_t i, pad = 0x80;
+    //---------
+    SIM800xMD5Update(ctx, &pad, 1);
+    pad = 0;
+    while((ctx->count & 0x3F) != 56)
+        SIM800xMD5Update(ctx, &pad, 1);
+    for(i = 0; i < 8; i++)
+    {
+        pad = (i < 4) ? (uint8_t)(bits >> (8 * i)) : 0;
+        SIM800xMD5Update(ctx, &pad, 1);
+    }
+    for(i = 0; i < 16; i++)
+        digest[i] = (uint8_t)(ctx->state[i >> 2] >> (8 * (i & 3)));
+    //---------
+}
+//-----------------------------------
@@ -0,0 +1,428 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_CoAP.c
+ * @author          Firmware-Engineers
+ * @brief           SIM800 series modems CoAP client (RFC 7252)
+ * @brief           See SIM800x_CoAP.h for more details.
+ ******************************************************************************
+ */
+
+//-----------------------------------
+#include "SIM800x_CoAP.h"
+#include "SIM800x_SDM.h"
+#include <string.h>
+//-----------------------------------
+
+//-----------------------------------
+#define COAP_VERSION                        0x40                                //!< Version 1, in the first header byte
+#define COAP_TYPE_CON                       0x00
+#define COAP_TYPE_NON                       0x10
+#define COAP_TYPE_ACK                       0x20
+#define COAP_TYPE_RST                       0x30
+#define COAP_TOKEN_SIZE                     2                                   //!< The message ID is used as token
+//-----------------------------------
+#define COAP_OPTION_URI_PATH                11
+#define COAP_OPTION_CONTENT_FORMAT          12
+#define COAP_OPTION_BLOCK1                  27
+#define COAP_PAYLOAD_MARKER                 0xFF
+//-----------------------------------
+#define COAP_CODE_CONTINUE                  0x5F                                //!< 2.31 Continue
+#define COAP_ACK_PENDING                    0xFF                                //!< Block-wise acknowledgment states, besides the response code
+#define COAP_ACK_FAILED                     0xFE
+//-----------------------------------
+#define COAP_PATH_MAX_SIZE                  64                                  //!< Maximum resource path length
+#define COAP_MESSAGE_SIZE                   (CONFIG_COAP_BLOCK_SIZE + 4 + COAP_TOKEN_SIZE + (2 * COAP_PATH_MAX_SIZE) + 16)
+#define COAP_SEND_TIME_OUT                  10000                               //!< Datagram send time-out, in milliseconds
+//-----------------------------------
+
+/**
+  * @brief  Pending CON message descriptor
+  */
+typedef struct
+{
+    //---------
+    uint16_t                msgid;
+    uint8_t                 active;
+    uint8_t                 retries;
+    uint32_t                sent;                                               //!< Last transmission tick
+    uint32_t                timeout;                                            //!< Current retransmission time-out, doubled at each attempt
+    uint16_t                len;
+    uint8_t                 msg[COAP_MESSAGE_SIZE];                             //!< Complete message, kept for retransmission
+    //---------
+}SIM800xCoAPPendingType;
+//-----------------------------------
+
+//-----------------------------------
+static SIM800xCoAPResponseCallBack  coapcb;
+static uint8_t                      coapconn;                                   //!< TCP/IP connection number
+static uint16_t                     coapnextid;
+static uint16_t                     coapackid;                                  //!< Message ID of the block being transferred
+static uint8_t                      coapackcode;                                //!< Its acknowledgment code, or COAP_ACK_PENDING/COAP_ACK_FAILED
+//-----------------------------------
+static SIM800xCoAPPendingType       pending[CONFIG_COAP_MAX_PENDING];
+static uint8_t                      coaprxfifo[CONFIG_COAP_RX_FIFO_SIZE];       //!< TCP/IP connection receive buffer
+static uint8_t                      coaprx[COAP_MESSAGE_SIZE];
+static uint8_t                      coaptx[COAP_MESSAGE_SIZE];                  //!< NON messages
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Encode an option delta or length nibble, writing its extended bytes if any
+ */
+static uint8_t CoAPNibble(uint16_t value, uint8_t** ext)
+{
+    if(value < 13)
+        return (uint8_t)value;
+    if(value < 269)
+    {
+        *(*ext)++ = (uint8_t)(value - 13);
+        return 13;
+    }
+    value -= 269;
+    *(*ext)++ = (uint8_t)(value >> 8);
+    *(*ext)++ = (uint8_t)value;
+    return 14;
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Write an option, options must be written in ascending number order
+ */
+static uint8_t* CoAPOption(uint8_t* dst, uint16_t* last, uint16_t num, const uint8_t* value, uint16_t len)
+{
+    uint8_t* hdr = dst++;
+    uint8_t delta;
+    //---------
+    delta = CoAPNibble(num - *last, &dst);                                      //!< Extended delta bytes precede extended length bytes
+    *hdr = (uint8_t)((delta << 4) | CoAPNibble(len, &dst));
+    memcpy(dst, value, len);
+    *last = num;
+    return dst + len;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Write an unsigned integer option, in the minimum number of bytes
+ */
+static uint8_t* CoAPOptionUInt(uint8_t* dst, uint16_t* last, uint16_t num, uint32_t value)
+{
+    uint8_t buf[4], i, n = 0;
+    //---------
+    while((n < 4) && (value >> (8 * n)))
+        n++;
+    for(i = 0; i < n; i++)
+        buf[i] = (uint8_t)(value >> (8 * (n - 1 - i)));
+    return CoAPOption(dst, last, num, buf, n);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Build a request message
+ * @param   block1: Block1 option value, or -1 if not used
+ * @retval  message size in bytes
+ */
+static uint16_t CoAPBuild(uint8_t* msg, uint8_t type, uint8_t code, uint16_t id, const char* path, SIM800xCoAPFormatType format, int32_t block1, const uint8_t* payload, uint16_t len)
+{
+    uint8_t* p = msg;
+    uint16_t last = 0, seg;
+    //---------
+    *p++ = (uint8_t)(COAP_VERSION | type | COAP_TOKEN_SIZE);
+    *p++ = code;
+    *p++ = (uint8_t)(id >> 8);
+    *p++ = (uint8_t)id;
+    *p++ = (uint8_t)(id >> 8);                                                  //!< Token
+    *p++ = (uint8_t)id;
+    while(*path)
+    {
+        if(*path == '/')
+        {
+            path++;
+            continue;
+        }
+        for(seg = 0; path[seg] && (path[seg] != '/'); seg++);
+        p = CoAPOption(p, &last, COAP_OPTION_URI_PATH, (const uint8_t*)path, seg);
+        path += seg;
+    }
+    if(format != COAP_FORMAT_NONE)
+        p = CoAPOptionUInt(p, &last, COAP_OPTION_CONTENT_FORMAT, format);
+    if(block1 >= 0)
+        p = CoAPOptionUInt(p, &last, COAP_OPTION_BLOCK1, (uint32_t)block1);
+    if(len)
+    {
+        *p++ = COAP_PAYLOAD_MARKER;
+        memcpy(p, payload, len);
+        p += len;
+    }
+    return (uint16_t)(p - msg);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Send an empty ACK or RST message
+ */
+static void CoAPSendEmpty(uint8_t type, uint16_t id)
+{
+    uint8_t msg[4];
+    uint16_t errcode;
+    //---------
+    msg[0] = (uint8_t)(COAP_VERSION | type);
+    msg[1] = 0;
+    msg[2] = (uint8_t)(id >> 8);
+    msg[3] = (uint8_t)id;
+    SIM800xTCPIPSend(coapconn, msg, sizeof(msg), COAP_SEND_TIME_OUT, &errcode);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Build and send a request, CON messages are added to the retransmission table
+ */
+static SIM800x_APIStatusType CoAPSend(SIM800xCoAPMsgType type, uint8_t code, const char* path, SIM800xCoAPFormatType format, int32_t block1, const uint8_t* payload, uint16_t len, uint16_t* msgid, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    SIM800xCoAPPendingType* slot = NULL;
+    uint8_t i, *msg = coaptx;
+    uint16_t id, size;
+    //---------
+    if(type == COAP_CON)
+    {
+        for(i = 0; (i < CONFIG_COAP_MAX_PENDING) && !slot; i++)
+        {
+            if(!pending[i].active)
+                slot = &pending[i];
+        }
+        if(!slot)
+            return SIM800X_BUSY;
+        msg = slot->msg;                                                        //!< Built in place, kept for retransmission
+    }
+    id = ++coapnextid;
+    size = CoAPBuild(msg, (type == COAP_CON) ? COAP_TYPE_CON : COAP_TYPE_NON, code, id, path, format, block1, payload, len);
+    status = SIM800xTCPIPSend(coapconn, msg, size, COAP_SEND_TIME_OUT, errcode);
+    if(status != SIM800X_OK)
+        return status;
+    if(slot)
+    {
+        slot->msgid = id;
+        slot->len = size;
+        slot->retries = 0;
+        slot->sent = Tick();
+        slot->timeout = CONFIG_COAP_ACK_TIMEOUT + (slot->sent % (CONFIG_COAP_ACK_TIMEOUT / 2));   //!< ACK_RANDOM_FACTOR 1.5
+        slot->active = 1;
+    }
+    if(msgid)
+        *msgid = id;
+    return SIM800X_OK;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Process a received message
+ */
+static void CoAPProcess(const uint8_t* msg, uint16_t len)
+{
+    uint8_t type, tkl, code, i, delta, ext;
+    uint16_t id, token;
+    uint32_t pos, olen;
+    //---------
+    if((len < 4) || ((msg[0] & 0xC0) != COAP_VERSION))
+        return;
+    type = msg[0] & 0x30;
+    tkl = msg[0] & 0x0F;
+    code = msg[1];
+    id = (uint16_t)((msg[2] << 8) | msg[3]);
+    if((tkl > 8) || (len < (4 + tkl)))
+        return;
+    token = (tkl == COAP_TOKEN_SIZE) ? (uint16_t)((msg[4] << 8) | msg[5]) : 0;
+    //---------
+    pos = 4 + tkl;                                                              //!< Skip the options, up to the payload
+    while((pos < len) && (msg[pos] != COAP_PAYLOAD_MARKER))
+    {
+        delta = msg[pos] >> 4;
+        olen = msg[pos++] & 0x0F;
+        if((delta == 15) || (olen == 15))
+            return;
+        ext = (delta == 13) ? 1 : ((delta == 14) ? 2 : 0);
+        if((pos + ext + ((olen == 13) ? 1 : ((olen == 14) ? 2 : 0))) > len)
+            return;                                                             //!< Extended delta or length past the datagram
+        pos += ext;
+        if(olen == 13)
+            olen = (uint32_t)msg[pos++] + 13;
+        else if(olen == 14)
+        {
+            olen = (uint32_t)((msg[pos] << 8) | msg[pos + 1]) + 269;
+            pos += 2;
+        }
+        pos += olen;
+        if(pos > len)
+            return;                                                             //!< Option value past the datagram
+    }
+    pos = (pos < len) ? (pos + 1) : len;
+    //---------
+    if((type == COAP_TYPE_ACK) || (type == COAP_TYPE_RST))
+    {
+        for(i = 0; i < CONFIG_COAP_MAX_PENDING; i++)
+        {
+            if(pending[i].active && (pending[i].msgid == id))
+                break;
+        }
+        if(i >= CONFIG_COAP_MAX_PENDING)
+            return;                                                             //!< Duplicate or unknown
+        pending[i].active = 0;
+        if((id == coapackid) && (coapackcode == COAP_ACK_PENDING))
+            coapackcode = (type == COAP_TYPE_RST) ? COAP_ACK_FAILED : code;
+        if((type == COAP_TYPE_RST) || (code && (code != COAP_CODE_CONTINUE)))   //!< Piggybacked response, empty ACK means a separate response follows
+        {
+            if(coapcb)
+                coapcb(id, (type == COAP_TYPE_RST) ? 0 : code, (pos < len) ? &msg[pos] : NULL, (uint16_t)(len - pos));
+        }
+        return;
+    }
+    //---------
+    if(!(code & 0xE0) || (tkl != COAP_TOKEN_SIZE))                              //!< Request, ping, or not ours
+    {
+        if(type == COAP_TYPE_CON)
+            CoAPSendEmpty(COAP_TYPE_RST, id);
+        return;
+    }
+    if(type == COAP_TYPE_CON)
+        CoAPSendEmpty(COAP_TYPE_ACK, id);
+    if(coapcb)
+        coapcb(token, code, (pos < len) ? &msg[pos] : NULL, (uint16_t)(len - pos));
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xCoAPSetResponseCallBack(SIM800xCoAPResponseCallBack cb)
+{
+    coapcb = cb;
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xCoAPOpen(uint8_t n, const char* host, uint16_t port, uint32_t tout, uint16_t* errcode)
+{
+    uint8_t i;
+    //---------
+    for(i = 0; i < CONFIG_COAP_MAX_PENDING; i++)
+        pending[i].active = 0;
+    coapconn = n;
+    coapnextid = (uint16_t)Tick();                                              //!< Message IDs should not repeat across restarts
+    return SIM800xTCPIPConnect(n, TCPIP_UDP, host, port, coaprxfifo, sizeof(coaprxfifo), tout, errcode);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xCoAPRequest(SIM800xCoAPMethodType method, const char* path, SIM800xCoAPFormatType format, const uint8_t* payload, uint32_t len, SIM800xCoAPMsgType type, uint16_t* msgid, uint32_t tout, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    uint32_t start = Tick(), off, num;
+    uint16_t blen, id = 0;
+    uint8_t szx, more;
+    //---------
+    if(!path || (strlen(path) > COAP_PATH_MAX_SIZE) || (len && !payload))
+        return SIM800X_ERROR;
+    if(len <= CONFIG_COAP_BLOCK_SIZE)
+        return CoAPSend(type, (uint8_t)method, path, format, -1, payload, (uint16_t)len, msgid, errcode);
+    //---------
+    for(szx = 0; (16U << szx) < CONFIG_COAP_BLOCK_SIZE; szx++);                 //!< Block size exponent
+    for(off = 0, num = 0; off < len; off += blen, num++)
+    {
+        blen = (uint16_t)(((len - off) > CONFIG_COAP_BLOCK_SIZE) ? CONFIG_COAP_BLOCK_SIZE : (len - off));
+        more = (off + blen) < len;
+        while((status = CoAPSend(COAP_CON, (uint8_t)method, path, format, (int32_t)((num << 4) | (more << 3) | szx), &payload[off], blen, &id, errcode)) == SIM800X_BUSY)
+        {
+            if((Tick() - start) >= tout)
+                return SIM800X_TIME_OUT;
+            SIM800xCoAPPoll();
+        }
+        if(status != SIM800X_OK)
+            return status;
+        coapackid = id;
+        coapackcode = COAP_ACK_PENDING;
+        while(coapackcode == COAP_ACK_PENDING)                                  //!< Updated on ACK/RST, or retransmission give-up
+        {
+            if((Tick() - start) >= tout)
+                return SIM800X_TIME_OUT;
+            SIM800xCoAPPoll();
+        }
+        if(coapackcode == COAP_ACK_FAILED)
+            return SIM800X_ERROR;
+        if(more && coapackcode && (coapackcode != COAP_CODE_CONTINUE))
+            return SIM800X_ERROR;                                               //!< Block rejected (ex. 4.13 Request Entity Too Large)
+    }
+    if(msgid)
+        *msgid = id;
+    return SIM800X_OK;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xCoAPPoll(void)
+{
+    uint16_t len, errcode;
+    uint8_t i;
+    //---------
+    while((len = SIM800xTCPIPRead(coapconn, coaprx, sizeof(coaprx))) > 0)
+        CoAPProcess(coaprx, len);
+    //---------
+    for(i = 0; i < CONFIG_COAP_MAX_PENDING; i++)
+    {
+        if(!pending[i].active || ((Tick() - pending[i].sent) < pending[i].timeout))
+            continue;
+        if(pending[i].retries >= CONFIG_COAP_MAX_RETRANSMIT)
+        {
+            pending[i].active = 0;
+            if((pending[i].msgid == coapackid) && (coapackcode == COAP_ACK_PENDING))
+                coapackcode = COAP_ACK_FAILED;
+            if(coapcb)
+                coapcb(pending[i].msgid, 0, NULL, 0);
+            continue;
+        }
+        SIM800xTCPIPSend(coapconn, pending[i].msg, pending[i].len, COAP_SEND_TIME_OUT, &errcode);
+        pending[i].sent = Tick();
+        pending[i].timeout <<= 1;
+        pending[i].retries++;
+    }
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+uint8_t SIM800xCoAPPending(void)
+{
+    uint8_t i, cnt = 0;
+    //---------
+    for(i = 0; i < CONFIG_COAP_MAX_PENDING; i++)
+    {
+        if(pending[i].active)
+            cnt++;
+    }
+    return cnt;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xCoAPClose(uint16_t* errcode)
+{
+    uint8_t i;
+    //---------
+    for(i = 0; i < CONFIG_COAP_MAX_PENDING; i++)
+        pending[i].active = 0;
+    return SIM800xTCPIPClose(coapconn, errcode);
+    //---------
+}
+//-----------------------------------
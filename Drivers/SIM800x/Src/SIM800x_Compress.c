@@ -0,0 +1,303 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_Compress.c
+ * @author          Firmware-Engineers
+ * @brief           Request body compression
+ * @brief           See SIM800x_Compress.h for more details.
+ ******************************************************************************
+ */
+
+//-----------------------------------
+#include "SIM800x_Compress.h"
+#include "SIM800x_HTTPStream.h"
+#include "SIM800x_SDM.h"
+#include <string.h>
+//-----------------------------------
+
+//-----------------------------------
+#define COMPRESS_MIN_MATCH                  3
+#define COMPRESS_MAX_MATCH                  258
+#define COMPRESS_END_OF_BLOCK               256
+#define COMPRESS_ADLER_BASE                 65521UL
+#define COMPRESS_ADLER_NMAX                 5552                                //!< Bytes summed before the 32-bit sums may overflow
+//-----------------------------------
+
+/**
+  * @brief  Compressor stage type definition
+  */
+typedef enum
+{
+    //---------
+    COMPRESS_HEADER                     = 0,                                    //!< zlib header and block header
+    COMPRESS_DATA                       = 1,                                    //!< Literals and matches
+    COMPRESS_TRAILER                    = 2,                                    //!< Adler-32 of the body
+    COMPRESS_DONE                       = 3
+    //---------
+}SIM800xCompressStageType;
+//-----------------------------------
+
+//-----------------------------------
+static const uint16_t lengthbase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t  lengthextra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const uint16_t distbase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static const uint8_t  distextra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+//-----------------------------------
+
+//-----------------------------------
+static uint32_t                     chead[1 << CONFIG_COMPRESS_HASH_BITS];      //!< Last position + 1 of each 3-byte hash, 0 if none
+static uint8_t                      cout[CONFIG_COMPRESS_CHUNK + 8];            //!< Output chunk, room for the last symbol or the trailer
+static uint16_t                     colen;
+static const uint8_t*               csrc;
+static uint32_t                     clen;
+static uint32_t                     cpos;
+static uint32_t                     cbits;                                      //!< Pending output bits, LSB first
+static uint8_t                      cnbits;
+static SIM800xCompressStageType     cstage;
+//-----------------------------------
+
+//-----------------------------------
+static void CompressBits(uint32_t value, uint8_t n)
+{
+    cbits |= value << cnbits;
+    cnbits = (uint8_t)(cnbits + n);
+    while(cnbits >= 8)
+    {
+        cout[colen++] = (uint8_t)cbits;
+        cbits >>= 8;
+        cnbits = (uint8_t)(cnbits - 8);
+    }
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Output a Huffman code, sent MSB first
+ */
+static void CompressCode(uint32_t code, uint8_t n)
+{
+    uint32_t rev = 0;
+    uint8_t i;
+    //---------
+    for(i = 0; i < n; i++, code >>= 1)
+        rev = (rev << 1) | (code & 1);
+    CompressBits(rev, n);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Output a literal/length symbol with the fixed Huffman codes
+ */
+static void CompressSymbol(uint16_t sym)
+{
+    if(sym < 144)
+        CompressCode(0x30UL + sym, 8);
+    else if(sym < 256)
+        CompressCode(0x190UL + sym - 144, 9);
+    else if(sym < 280)
+        CompressCode(sym - 256UL, 7);
+    else
+        CompressCode(0xC0UL + sym - 280, 8);
+}
+//-----------------------------------
+
+//-----------------------------------
+static void CompressMatch(uint16_t len, uint16_t dist)
+{
+    uint8_t i = 28;
+    //---------
+    while(lengthbase[i] > len)
+        i--;
+    CompressSymbol((uint16_t)(257 + i));
+    if(lengthextra[i])
+        CompressBits(len - lengthbase[i], lengthextra[i]);
+    i = 29;
+    while(distbase[i] > dist)
+        i--;
+    CompressCode(i, 5);
+    if(distextra[i])
+        CompressBits(dist - distbase[i], distextra[i]);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static uint32_t CompressHash(uint32_t pos)
+{
+    uint32_t v = ((uint32_t)csrc[pos] << 16) | ((uint32_t)csrc[pos + 1] << 8) | csrc[pos + 2];
+    //---------
+    return (uint32_t)(v * 2654435761UL) >> (32 - CONFIG_COMPRESS_HASH_BITS);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Output a match at the current position if the hash table has one, a literal otherwise
+ */
+static void CompressStep(void)
+{
+    uint32_t h, cand, n, max, i;
+    //---------
+    if((cpos + COMPRESS_MIN_MATCH) <= clen)
+    {
+        h = CompressHash(cpos);
+        cand = chead[h];
+        chead[h] = cpos + 1;
+        if(cand && ((cpos - (cand - 1)) <= CONFIG_COMPRESS_WINDOW))
+        {
+            cand--;
+            max = clen - cpos;
+            if(max > COMPRESS_MAX_MATCH)
+                max = COMPRESS_MAX_MATCH;
+            for(n = 0; (n < max) && (csrc[cand + n] == csrc[cpos + n]); n++);
+            if(n >= COMPRESS_MIN_MATCH)
+            {
+                CompressMatch((uint16_t)n, (uint16_t)(cpos - cand));
+                for(i = 1; (i < n) && ((cpos + i + COMPRESS_MIN_MATCH) <= clen); i++)
+                    chead[CompressHash(cpos + i)] = cpos + i + 1;
+                cpos += n;
+                return;
+            }
+        }
+    }
+    CompressSymbol(csrc[cpos++]);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static uint32_t CompressAdler32(const uint8_t* data, uint32_t len)
+{
+    uint32_t a = 1, b = 0, n;
+    //---------
+    while(len)
+    {
+        n = (len < COMPRESS_ADLER_NMAX) ? len : COMPRESS_ADLER_NMAX;
+        len -= n;
+        while(n--)
+        {
+            a += *data++;
+            b += a;
+        }
+        a %= COMPRESS_ADLER_BASE;
+        b %= COMPRESS_ADLER_BASE;
+    }
+    return (b << 16) | a;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static void CompressBegin(const uint8_t* src, uint32_t len)
+{
+    memset(chead, 0, sizeof(chead));
+    csrc = src;
+    clen = len;
+    cpos = 0;
+    cbits = 0;
+    cnbits = 0;
+    cstage = COMPRESS_HEADER;
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Run the compressor until an output chunk is ready
+ * @retval  Chunk size in bytes, 0 once the stream is complete
+ */
+static uint16_t CompressRun(void)
+{
+    uint32_t adler;
+    //---------
+    colen = 0;
+    while((colen < CONFIG_COMPRESS_CHUNK) && (cstage != COMPRESS_DONE))
+    {
+        switch(cstage)
+        {
+            case COMPRESS_HEADER:
+                cout[colen++] = 0x78;                                           //!< CM = 8 (deflate), CINFO = 7, FLEVEL = 0
+                cout[colen++] = 0x01;
+                CompressBits(3, 3);                                             //!< BFINAL = 1, BTYPE = 01 (fixed Huffman codes)
+                cstage = COMPRESS_DATA;
+                break;
+            case COMPRESS_DATA:
+                if(cpos < clen)
+                    CompressStep();
+                else
+                {
+                    CompressSymbol(COMPRESS_END_OF_BLOCK);
+                    if(cnbits)
+                        CompressBits(0, (uint8_t)(8 - cnbits));
+                    cstage = COMPRESS_TRAILER;
+                }
+                break;
+            default:
+                adler = CompressAdler32(csrc, clen);
+                cout[colen++] = (uint8_t)(adler >> 24);
+                cout[colen++] = (uint8_t)(adler >> 16);
+                cout[colen++] = (uint8_t)(adler >> 8);
+                cout[colen++] = (uint8_t)adler;
+                cstage = COMPRESS_DONE;
+                break;
+        }
+    }
+    return colen;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static uint16_t CompressProducer(const uint8_t** data, uint32_t offset, uint32_t remain)
+{
+    *data = cout;
+    return CompressRun();
+}
+//-----------------------------------
+
+//-----------------------------------
+uint32_t SIM800xCompress(const uint8_t* src, uint32_t len, uint8_t* dst, uint32_t size)
+{
+    uint32_t total = 0;
+    uint16_t n;
+    //---------
+    CompressBegin(src, len);
+    while((n = CompressRun()) != 0)
+    {
+        if((total + n) > size)
+            return 0;
+        memcpy(&dst[total], cout, n);
+        total += n;
+    }
+    return total;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+uint32_t SIM800xCompressSize(const uint8_t* src, uint32_t len)
+{
+    uint32_t total = 0;
+    //---------
+    CompressBegin(src, len);
+    while(cstage != COMPRESS_DONE)
+        total += CompressRun();
+    return total;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xCompressWrite(const uint8_t* src, uint32_t len, uint32_t timeout, uint32_t* size, uint16_t* errcode)
+{
+    uint32_t total;
+    //---------
+    total = SIM800xCompressSize(src, len);
+    if(size)
+        *size = total;
+    CompressBegin(src, len);                                                    //!< Same input, same output
+    return SIM800xHTTPStreamWrite(total, CompressProducer, timeout, errcode);
+    //---------
+}
+//-----------------------------------
@@ -0,0 +1,483 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_FOTA.c
+ * @author          Firmware-Engineers
+ * @brief           Firmware over-the-air update pipeline
+ * @brief           See SIM800x_FOTA.h for more details.
+ ******************************************************************************
+ */
+
+//-----------------------------------
+#include "SIM800x_FOTA.h"
+#include "SIM800x_CRC.h"
+#include "SIM800x_SDM.h"
+#include <string.h>
+//-----------------------------------
+
+//-----------------------------------
+#define FOTA_MAGIC                          0x41544F46UL                        //!< "FOTA"
+#define FOTA_SLOT_SIZE                      ((uint32_t)CONFIG_FOTA_SLOT_SECTORS * CONFIG_FOTA_SECTOR_SIZE)
+#define FOTA_RECORD_OFFSET                  (FOTA_SLOT_SIZE - FOTA_RECORD_SIZE)
+#define FOTA_NOT_INSTALLED                  0xFFFFFFFFUL                        //!< Erased value, programmed to 0 once installed
+#define FOTA_IMAGE_MAX                      ((CONFIG_FOTA_APP_SIZE < FOTA_RECORD_OFFSET) ? CONFIG_FOTA_APP_SIZE : FOTA_RECORD_OFFSET)
+//-----------------------------------
+
+/**
+  * @brief  On-going flash operation type definition
+  */
+typedef enum
+{
+    //---------
+    FOTA_OP_NONE                        = 0,
+    FOTA_OP_PROGRAM                     = 1
+    //---------
+}SIM800xFOTAOpType;
+//-----------------------------------
+
+/**
+  * @brief  Boot record type definition, FOTA_RECORD_SIZE bytes
+  */
+typedef struct
+{
+    //---------
+    uint32_t                magic;
+    uint32_t                size;                                               //!< Image size in bytes
+    uint8_t                 digest[FOTA_DIGEST_SIZE];                           //!< Image MD5 digest
+    uint32_t                installed;
+    uint32_t                reserved;
+    //---------
+}SIM800xFOTARecordType;
+//-----------------------------------
+
+//-----------------------------------
+static const SIM800xFOTAFlashType*  fotaflash;
+static uint8_t                      fotabuf[2][CONFIG_FOTA_BUFFER_SIZE];
+static SIM800xFOTARecordType        fotarecord;
+static uint32_t                     fotasize;                                   //!< Image size
+static uint32_t                     fotareceived;                               //!< Offset of the next byte to receive
+static uint32_t                     fotaprogrammed;                             //!< Number of bytes in flash
+static uint16_t                     fotafill;                                   //!< Bytes in the buffer being filled
+static uint16_t                     fotapending;                                //!< Bytes in the other buffer, waiting to be programmed
+static uint8_t                      fotaactive;                                 //!< Buffer being filled
+static SIM800xFOTAOpType            fotaop;
+static uint8_t                      fotafailed;
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Sector erased by an erase step: the image sectors in order, then the record sector
+ */
+static uint8_t FOTAEraseSector(uint8_t step)
+{
+    uint8_t imagesectors = (uint8_t)((fotasize + CONFIG_FOTA_SECTOR_SIZE - 1) / CONFIG_FOTA_SECTOR_SIZE);
+    //---------
+    return (step < imagesectors) ? step : (uint8_t)(CONFIG_FOTA_SLOT_SECTORS - 1);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Hand the full buffer to the flash, waiting for the previous one if needed
+ */
+static uint8_t FOTAQueue(void)
+{
+    //---------
+    while(fotapending)
+    {
+        if(SIM800xFOTAPoll() == FOTA_FLASH_ERROR)
+            return 0;
+    }
+    while(fotafill & 3)                                                         //!< Word programming
+        fotabuf[fotaactive][fotafill++] = 0xFF;
+    fotapending = fotafill;
+    fotafill = 0;
+    fotaactive ^= 1;
+    return SIM800xFOTAPoll() != FOTA_FLASH_ERROR;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xFOTABegin(const SIM800xFOTAFlashType* flash, uint32_t size, uint32_t offset)
+{
+    SIM800xFOTAFlashStatusType status;
+    uint8_t imagesectors, step, steps;
+    //---------
+    if(!flash || !size || (size > FOTA_IMAGE_MAX) || (offset > size) || (offset % CONFIG_FOTA_BUFFER_SIZE))
+        return SIM800X_ERROR;
+    fotaflash = flash;
+    fotasize = size;
+    fotareceived = offset;
+    fotaprogrammed = offset;
+    fotafill = 0;
+    fotapending = 0;
+    fotaactive = 0;
+    fotaop = FOTA_OP_NONE;
+    fotafailed = 0;
+    imagesectors = (uint8_t)((size + CONFIG_FOTA_SECTOR_SIZE - 1) / CONFIG_FOTA_SECTOR_SIZE);
+    steps = (uint8_t)(imagesectors + (imagesectors < CONFIG_FOTA_SLOT_SECTORS));
+    step = (uint8_t)((offset + CONFIG_FOTA_SECTOR_SIZE - 1) / CONFIG_FOTA_SECTOR_SIZE);  //!< Sectors already holding data are kept
+    for(; step < steps; step++)                                                 //!< Every erase done before any modem data flows
+    {
+        if(!flash->erase(FOTAEraseSector(step)))
+            fotafailed = 1;
+        while((status = flash->status()) == FOTA_FLASH_BUSY);
+        if(fotafailed || (status != FOTA_FLASH_READY))
+        {
+            fotafailed = 1;
+            return SIM800X_ERROR;
+        }
+    }
+    return SIM800X_OK;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+uint8_t SIM800xFOTAWrite(const uint8_t* data, uint16_t len, uint32_t offset)
+{
+    uint32_t skip;
+    uint16_t n;
+    //---------
+    if(fotafailed || !fotaflash || (offset > fotareceived) || ((offset + len) > fotasize))
+        return 0;
+    skip = fotareceived - offset;                                               //!< Range sent again after a retry
+    if(skip >= len)
+        return 1;
+    data += skip;
+    len = (uint16_t)(len - skip);
+    while(len)
+    {
+        n = (uint16_t)(CONFIG_FOTA_BUFFER_SIZE - fotafill);
+        if(n > len)
+            n = len;
+        memcpy(&fotabuf[fotaactive][fotafill], data, n);
+        fotafill = (uint16_t)(fotafill + n);
+        fotareceived += n;
+        data += n;
+        len = (uint16_t)(len - n);
+        if(((fotafill == CONFIG_FOTA_BUFFER_SIZE) || (fotareceived == fotasize)) && !FOTAQueue())
+            return 0;
+    }
+    return SIM800xFOTAPoll() != FOTA_FLASH_ERROR;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800xFOTAFlashStatusType SIM800xFOTAPoll(void)
+{
+    SIM800xFOTAFlashStatusType status;
+    //---------
+    if(fotafailed || !fotaflash)
+        return FOTA_FLASH_ERROR;
+    if(fotaop != FOTA_OP_NONE)
+    {
+        status = fotaflash->status();
+        if(status == FOTA_FLASH_BUSY)
+            return FOTA_FLASH_BUSY;
+        if(status == FOTA_FLASH_ERROR)
+        {
+            fotafailed = 1;
+            return FOTA_FLASH_ERROR;
+        }
+        fotaprogrammed += fotapending;
+        fotapending = 0;
+        fotaop = FOTA_OP_NONE;
+    }
+    //---------
+    if(!fotapending)
+        return FOTA_FLASH_READY;
+    fotaop = FOTA_OP_PROGRAM;                                                   //!< Slot erased by SIM800xFOTABegin()
+    if(!fotaflash->program(fotaprogrammed, fotabuf[fotaactive ^ 1], fotapending))
+        fotafailed = 1;
+    return fotafailed ? FOTA_FLASH_ERROR : FOTA_FLASH_BUSY;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+uint32_t SIM800xFOTASync(void)
+{
+    //---------
+    while(fotapending || (fotaop == FOTA_OP_PROGRAM))
+    {
+        if(SIM800xFOTAPoll() == FOTA_FLASH_ERROR)
+            return 0;
+    }
+    return fotaprogrammed;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xFOTAFinish(const uint8_t* digest)
+{
+    SIM800xMD5Type md5;
+    uint8_t computed[FOTA_DIGEST_SIZE];
+    SIM800xFOTAFlashStatusType status;
+    //---------
+    if(!fotaflash || (fotareceived != fotasize))
+        return SIM800X_ERROR;
+    while((status = SIM800xFOTAPoll()) == FOTA_FLASH_BUSY);                     //!< Remaining programs
+    if(status == FOTA_FLASH_ERROR)
+        return SIM800X_ERROR;
+    SIM800xMD5Init(&md5);
+    SIM800xMD5Update(&md5, fotaflash->slot, fotasize);
+    SIM800xMD5Final(&md5, computed);
+    if(memcmp(computed, digest, FOTA_DIGEST_SIZE))
+        return SIM800X_ERROR;
+    //---------
+    memset(&fotarecord, 0xFF, sizeof(fotarecord));
+    fotarecord.magic = FOTA_MAGIC;
+    fotarecord.size = fotasize;
+    memcpy(fotarecord.digest, computed, FOTA_DIGEST_SIZE);
+    if(!fotaflash->program(FOTA_RECORD_OFFSET + 4, (const uint8_t*)&fotarecord + 4, (uint16_t)(sizeof(fotarecord) - 4)))
+        return SIM800X_ERROR;
+    while((status = fotaflash->status()) == FOTA_FLASH_BUSY);
+    if(status != FOTA_FLASH_READY)
+        return SIM800X_ERROR;
+    if(!fotaflash->program(FOTA_RECORD_OFFSET, (const uint8_t*)&fotarecord.magic, 4))   //!< Magic last, the boot selector ignores a partial record
+        return SIM800X_ERROR;
+    while((status = fotaflash->status()) == FOTA_FLASH_BUSY);
+    return (status == FOTA_FLASH_READY) ? SIM800X_OK : SIM800X_ERROR;
+    //---------
+}
+//-----------------------------------
+
+#if defined(HAL_FLASH_MODULE_ENABLED)
+//-----------------------------------
+#define FOTA_HAL_ERRORS                     (FLASH_SR_WRPERR | FLASH_SR_PGAERR | FLASH_SR_PGPERR | FLASH_SR_PGSERR)
+//-----------------------------------
+
+//-----------------------------------
+static volatile SIM800xFOTAFlashStatusType halstatus = FOTA_FLASH_READY;
+static const uint8_t*               haldata;                                    //!< Next word to program
+static uint32_t                     haladdress;                                 //!< Its flash address
+static uint16_t                     halleft;                                    //!< Bytes left to program, from haldata
+static uint8_t                      halprogram;                                 //!< Programming on-going
+//-----------------------------------
+
+//-----------------------------------
+static uint8_t FOTAHALErase(uint8_t sector)
+{
+    FLASH_EraseInitTypeDef erase;
+    //---------
+    erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+    erase.Banks = FLASH_BANK_1;
+    erase.Sector = CONFIG_FOTA_SLOT_FIRST_SECTOR + sector;
+    erase.NbSectors = 1;
+    erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+    HAL_NVIC_SetPriority(FLASH_IRQn, 15, 0);
+    HAL_NVIC_EnableIRQ(FLASH_IRQn);
+    HAL_FLASH_Unlock();
+    halstatus = FOTA_FLASH_BUSY;
+    if(HAL_FLASHEx_Erase_IT(&erase) != HAL_OK)
+    {
+        halstatus = FOTA_FLASH_ERROR;
+        return 0;
+    }
+    return 1;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Start programming the next word, without waiting for it
+ */
+static void FOTAHALProgramWord(void)
+{
+    uint32_t word;
+    //---------
+    memcpy(&word, haldata, 4);
+    FLASH->CR = (FLASH->CR & ~(FLASH_CR_PSIZE | FLASH_CR_SER | FLASH_CR_SNB)) | FLASH_PSIZE_WORD | FLASH_CR_PG;
+    *(volatile uint32_t*)haladdress = word;
+    haldata += 4;
+    haladdress += 4;
+    halleft = (uint16_t)(halleft - 4);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Only starts programming: one word (16 us) is programmed at each FOTAHALStatus() poll,
+ *          so the CPU never waits more than one word for the flash.
+ */
+static uint8_t FOTAHALProgram(uint32_t offset, const uint8_t* data, uint16_t len)
+{
+    //---------
+    if(!len)
+        return 0;
+    HAL_FLASH_Unlock();
+    FLASH->SR = FLASH_SR_EOP | FOTA_HAL_ERRORS;
+    haldata = data;
+    haladdress = CONFIG_FOTA_SLOT_ADDRESS + offset;
+    halleft = len;
+    halprogram = 1;
+    halstatus = FOTA_FLASH_BUSY;
+    FOTAHALProgramWord();
+    return 1;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static SIM800xFOTAFlashStatusType FOTAHALStatus(void)
+{
+    //---------
+    if(halprogram && !(FLASH->SR & FLASH_SR_BSY))
+    {
+        if(FLASH->SR & FOTA_HAL_ERRORS)
+        {
+            halleft = 0;
+            halstatus = FOTA_FLASH_ERROR;
+        }
+        if(halleft)
+            FOTAHALProgramWord();
+        else
+        {
+            FLASH->CR &= ~FLASH_CR_PG;
+            halprogram = 0;
+            if(halstatus == FOTA_FLASH_BUSY)
+                halstatus = FOTA_FLASH_READY;
+        }
+    }
+    if(halstatus != FOTA_FLASH_BUSY)
+        HAL_FLASH_Lock();
+    return halstatus;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+void HAL_FLASH_EndOfOperationCallback(uint32_t ReturnValue)
+{
+    if(ReturnValue == 0xFFFFFFFFUL)                                             //!< Sector erase procedure completed
+        halstatus = FOTA_FLASH_READY;
+}
+//-----------------------------------
+
+//-----------------------------------
+void HAL_FLASH_OperationErrorCallback(uint32_t ReturnValue)
+{
+    halstatus = FOTA_FLASH_ERROR;
+}
+//-----------------------------------
+
+//-----------------------------------
+const SIM800xFOTAFlashType SIM800xFOTAHALFlash =
+{
+    FOTAHALErase,
+    FOTAHALProgram,
+    FOTAHALStatus,
+    (const uint8_t*)CONFIG_FOTA_SLOT_ADDRESS
+};
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Reset, from the boot sector
+ * @note    Inlined, even at -O0: the boot sector calls nothing outside itself.
+ */
+__attribute__((always_inline, noreturn)) static inline void FOTABootReset(void)
+{
+    //---------
+    __DSB();
+    SCB->AIRCR = (uint32_t)((0x5FAUL << SCB_AIRCR_VECTKEY_Pos) | (SCB->AIRCR & SCB_AIRCR_PRIGROUP_Msk) | SCB_AIRCR_SYSRESETREQ_Msk);
+    __DSB();
+    for(;;);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Boot sector fault handler, retries from reset
+ */
+__attribute__((section(".fotaboot"), noreturn)) static void FOTABootFault(void)
+{
+    FOTABootReset();
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Copy the update slot over the running firmware, then reset
+ * @note    Runs from the boot sector, which is never erased, with registers and stack only.
+ *          installed is only cleared once the copy is read back: any failure or power loss
+ *          before that restarts the copy at the next reset.
+ */
+__attribute__((section(".fotaboot"), noinline, noreturn)) static void FOTAInstall(uint32_t size, volatile uint32_t* installed)
+{
+    const uint32_t* src = (const uint32_t*)CONFIG_FOTA_SLOT_ADDRESS;
+    volatile uint32_t* dst = (volatile uint32_t*)CONFIG_FOTA_APP_ADDRESS;
+    uint32_t i, words = (size + 3) >> 2;
+    //---------
+    FLASH->KEYR = FLASH_KEY1;
+    FLASH->KEYR = FLASH_KEY2;
+    FLASH->SR = FLASH_SR_EOP | FLASH_SR_SOP | FLASH_SR_WRPERR | FLASH_SR_PGAERR | FLASH_SR_PGPERR | FLASH_SR_PGSERR;
+    for(i = CONFIG_FOTA_APP_FIRST_SECTOR; i < (CONFIG_FOTA_APP_FIRST_SECTOR + CONFIG_FOTA_APP_SECTORS); i++)
+    {
+        while(FLASH->SR & FLASH_SR_BSY);
+        FLASH->CR = FLASH_PSIZE_WORD | FLASH_CR_SER | (i << FLASH_CR_SNB_Pos);
+        FLASH->CR |= FLASH_CR_STRT;
+    }
+    while(FLASH->SR & FLASH_SR_BSY);
+    FLASH->CR = FLASH_PSIZE_WORD | FLASH_CR_PG;
+    for(i = 0; i < words; i++)
+    {
+        dst[i] = src[i];
+        while(FLASH->SR & FLASH_SR_BSY);
+    }
+    for(i = 0; i < words; i++)                                                  //!< Read back
+    {
+        if(dst[i] != src[i])
+            break;
+    }
+    if(!(FLASH->SR & (FLASH_SR_WRPERR | FLASH_SR_PGAERR | FLASH_SR_PGPERR | FLASH_SR_PGSERR)) && (i == words))
+    {
+        *installed = 0;
+        while(FLASH->SR & FLASH_SR_BSY);
+    }
+    FLASH->CR = FLASH_CR_LOCK;
+    FOTABootReset();
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+__attribute__((section(".fotaboot"), noreturn)) void SIM800xFOTABoot(void)
+{
+    SIM800xFOTARecordType* record = (SIM800xFOTARecordType*)(CONFIG_FOTA_SLOT_ADDRESS + FOTA_RECORD_OFFSET);
+    const uint32_t* app = (const uint32_t*)CONFIG_FOTA_APP_ADDRESS;
+    uint32_t entry;
+    //---------
+    if((record->magic == FOTA_MAGIC) && (record->installed == FOTA_NOT_INSTALLED) && record->size && (record->size <= FOTA_IMAGE_MAX))
+        FOTAInstall(record->size, &record->installed);                          //!< Digest checked by SIM800xFOTAFinish(), before the record was written
+    entry = app[1];
+    SCB->VTOR = CONFIG_FOTA_APP_ADDRESS;
+    __set_MSP(app[0]);
+    ((void (*)(void))entry)();
+    for(;;);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+extern uint32_t _estack;                                                        //!< STM32F407VGTX_FLASH.ld
+
+/**
+ * @brief   Boot sector vector table: the firmware one is at CONFIG_FOTA_APP_ADDRESS
+ */
+__attribute__((section(".fotaboot_vector"), used)) static void (* const fotabootvector[4])(void) =
+{
+    (void (*)(void))&_estack,
+    SIM800xFOTABoot,
+    FOTABootFault,                                                              //!< NMI
+    FOTABootFault                                                               //!< HardFault
+};
+//-----------------------------------
+#endif
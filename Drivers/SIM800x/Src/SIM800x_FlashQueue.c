@@ -0,0 +1,379 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_FlashQueue.c
+ * @author          Firmware-Engineers
+ * @brief           Flash-backed store-and-forward queue
+ * @brief           See SIM800x_FlashQueue.h for more details.
+ ******************************************************************************
+ */
+
+//-----------------------------------
+#include "SIM800x_FlashQueue.h"
+#include "SIM800x_CRC.h"
+#include "SIM800x_SDM.h"
+#include <string.h>
+//-----------------------------------
+
+//-----------------------------------
+#define FLASHQUEUE_MAGIC                    0x51485346UL                        //!< "FSHQ"
+#define FLASHQUEUE_HEADER_SIZE              8                                   //!< Sector header: magic, sequence number
+#define FLASHQUEUE_FRAME_SIZE               12                                  //!< Record framing: length, CRC-32, consumed
+#define FLASHQUEUE_ERASED                   0xFFFFFFFFUL
+#define FLASHQUEUE_SS                       CONFIG_FLASHQUEUE_SECTOR_SIZE
+//-----------------------------------
+
+//-----------------------------------
+static const SIM800xFlashQueueFlashType*    fqflash;
+static SIM800xFlashQueueStatsType           fqstats;
+static uint8_t                              fqwsector;                          //!< Tail, next record position
+static uint32_t                             fqwoffset;
+static uint8_t                              fqhsector;                          //!< Head, oldest record not consumed
+static uint32_t                             fqhoffset;
+static uint8_t                              fqdsector;                          //!< Drain producer position
+static uint32_t                             fqdoffset;
+static uint16_t                             fqdcount;                           //!< Records selected for the drain
+static uint16_t                             fqdhanded;
+static uint32_t                             fqdbytes;
+//-----------------------------------
+
+//-----------------------------------
+static uint32_t FlashQueueWord(uint8_t sector, uint32_t offset)
+{
+    uint32_t word;
+    //---------
+    memcpy(&word, &fqflash->base[(uint32_t)sector * FLASHQUEUE_SS + offset], 4);
+    return word;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static uint8_t FlashQueueProgram(uint8_t sector, uint32_t offset, uint32_t word)
+{
+    return fqflash->program((uint32_t)sector * FLASHQUEUE_SS + offset, word);
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Size of the record frame at a position
+ * @retval  0 at the end of the sector records (erased, torn length word or end of sector)
+ */
+static uint32_t FlashQueueRecordSize(uint8_t sector, uint32_t offset)
+{
+    uint32_t word, len, size;
+    //---------
+    if((offset + FLASHQUEUE_FRAME_SIZE) > FLASHQUEUE_SS)
+        return 0;
+    word = FlashQueueWord(sector, offset);
+    len = word & 0xFFFF;
+    if(!len || ((word >> 16) != (~len & 0xFFFF)))
+        return 0;
+    size = FLASHQUEUE_FRAME_SIZE + ((len + 3) & ~3UL);
+    return ((offset + size) > FLASHQUEUE_SS) ? 0 : size;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Move a position to the next record not consumed with a good CRC
+ * @retval  1 if found, 0 if the tail is reached
+ */
+static uint8_t FlashQueueSeek(uint8_t* sector, uint32_t* offset, uint32_t* corrupted)
+{
+    uint32_t size, len;
+    //---------
+    while((*sector != fqwsector) || (*offset < fqwoffset))
+    {
+        size = FlashQueueRecordSize(*sector, *offset);
+        if(!size)
+        {
+            if(*sector == fqwsector)
+                return 0;
+            *sector = (uint8_t)((*sector + 1) % CONFIG_FLASHQUEUE_SECTORS);
+            *offset = FLASHQUEUE_HEADER_SIZE;
+            continue;
+        }
+        if(FlashQueueWord(*sector, *offset + 8) == FLASHQUEUE_ERASED)
+        {
+            len = FlashQueueWord(*sector, *offset) & 0xFFFF;
+            if(FlashQueueWord(*sector, *offset + 4) == SIM800xCRC32(0, &fqflash->base[(uint32_t)*sector * FLASHQUEUE_SS + *offset + FLASHQUEUE_FRAME_SIZE], len))
+                return 1;
+            if(corrupted)                                                       //!< Torn by a reset
+                (*corrupted)++;
+        }
+        *offset += size;
+    }
+    return 0;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static void FlashQueueAdvanceHead(void)
+{
+    if(!FlashQueueSeek(&fqhsector, &fqhoffset, NULL))
+    {
+        fqhsector = fqwsector;
+        fqhoffset = fqwoffset;
+    }
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Erase and format a sector with a sequence number
+ */
+static uint8_t FlashQueueFormat(uint8_t sector, uint32_t seq)
+{
+    //---------
+    fqstats.erases++;
+    if(!fqflash->erase(sector))
+        return 0;
+    return FlashQueueProgram(sector, 4, seq) && FlashQueueProgram(sector, 0, FLASHQUEUE_MAGIC);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Move the tail to the next sector, dropping its records if any
+ */
+static uint8_t FlashQueueNextSector(void)
+{
+    uint8_t next = (uint8_t)((fqwsector + 1) % CONFIG_FLASHQUEUE_SECTORS), s;
+    uint32_t o, seq = FlashQueueWord(fqwsector, 4);
+    uint8_t reclaim = (fqhsector == next) && (fqhsector != fqwsector);
+    //---------
+    if(reclaim)
+    {
+        s = fqhsector;
+        o = fqhoffset;
+        while(FlashQueueSeek(&s, &o, NULL) && (s == next))
+        {
+            fqstats.records--;
+            fqstats.bytes -= FlashQueueWord(s, o) & 0xFFFF;
+            fqstats.dropped++;
+            o += FlashQueueRecordSize(s, o);
+        }
+    }
+    if(!FlashQueueFormat(next, seq + 1))
+        return 0;
+    fqwsector = next;
+    fqwoffset = FLASHQUEUE_HEADER_SIZE;
+    if(reclaim)
+    {
+        fqhsector = (uint8_t)((next + 1) % CONFIG_FLASHQUEUE_SECTORS);
+        fqhoffset = FLASHQUEUE_HEADER_SIZE;
+    }
+    FlashQueueAdvanceHead();
+    return 1;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xFlashQueueInit(const SIM800xFlashQueueFlashType* flash)
+{
+    uint8_t s, i, found = 0;
+    uint32_t seq = 0, size;
+    //---------
+    fqflash = flash;
+    memset(&fqstats, 0, sizeof(fqstats));
+    fqdcount = 0;
+    for(s = 0; s < CONFIG_FLASHQUEUE_SECTORS; s++)                             //!< Newest sector
+    {
+        if((FlashQueueWord(s, 0) == FLASHQUEUE_MAGIC) && (!found || (FlashQueueWord(s, 4) > seq)))
+        {
+            seq = FlashQueueWord(s, 4);
+            fqwsector = s;
+            found = 1;
+        }
+    }
+    if(!found)
+    {
+        for(s = 1; s < CONFIG_FLASHQUEUE_SECTORS; s++)
+        {
+            fqstats.erases++;
+            if(!fqflash->erase(s))
+                return SIM800X_ERROR;
+        }
+        if(!FlashQueueFormat(0, 1))
+            return SIM800X_ERROR;
+        fqwsector = 0;
+    }
+    //---------
+    fqwoffset = FLASHQUEUE_HEADER_SIZE;                                         //!< Tail
+    while((size = FlashQueueRecordSize(fqwsector, fqwoffset)) != 0)
+        fqwoffset += size;
+    if(((fqwoffset + 4) <= FLASHQUEUE_SS) && (FlashQueueWord(fqwsector, fqwoffset) != FLASHQUEUE_ERASED))
+        fqwoffset = FLASHQUEUE_SS;                                              //!< Torn length word, sector closed
+    //---------
+    for(i = 1; i <= CONFIG_FLASHQUEUE_SECTORS; i++)                             //!< Head, in the oldest sector
+    {
+        fqhsector = (uint8_t)((fqwsector + i) % CONFIG_FLASHQUEUE_SECTORS);
+        if(FlashQueueWord(fqhsector, 0) == FLASHQUEUE_MAGIC)
+            break;
+    }
+    fqhoffset = FLASHQUEUE_HEADER_SIZE;
+    FlashQueueAdvanceHead();
+    s = fqhsector;
+    size = fqhoffset;
+    while(FlashQueueSeek(&s, &size, &fqstats.corrupted))
+    {
+        fqstats.records++;
+        fqstats.bytes += FlashQueueWord(s, size) & 0xFFFF;
+        size += FlashQueueRecordSize(s, size);
+    }
+    return SIM800X_OK;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xFlashQueuePush(const void* data, uint16_t len)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    uint32_t size = FLASHQUEUE_FRAME_SIZE + ((len + 3UL) & ~3UL), i, word;
+    uint8_t ok;
+    //---------
+    if(!fqflash || !len || (size > (FLASHQUEUE_SS - FLASHQUEUE_HEADER_SIZE)))
+        return SIM800X_ERROR;
+    if(((fqwoffset + size) > FLASHQUEUE_SS) && !FlashQueueNextSector())
+        return SIM800X_ERROR;
+    ok = FlashQueueProgram(fqwsector, fqwoffset, (uint32_t)len | ((~(uint32_t)len & 0xFFFF) << 16));
+    for(i = 0; ok && (i < len); i += 4)
+    {
+        word = FLASHQUEUE_ERASED;
+        memcpy(&word, &p[i], ((len - i) < 4) ? (len - i) : 4);
+        ok = FlashQueueProgram(fqwsector, fqwoffset + FLASHQUEUE_FRAME_SIZE + i, word);
+    }
+    if(ok)                                                                      //!< Record valid once its CRC is written
+        ok = FlashQueueProgram(fqwsector, fqwoffset + 4, SIM800xCRC32(0, data, len));
+    if(!ok)
+    {
+        fqwoffset = FLASHQUEUE_SS;                                              //!< Sector closed, the next record goes to the next sector
+        fqstats.dropped++;
+        return SIM800X_ERROR;
+    }
+    fqwoffset += size;
+    fqstats.records++;
+    fqstats.bytes += len;
+    return SIM800X_OK;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+uint16_t SIM800xFlashQueueDrainBegin(uint32_t maxsize, uint32_t* size)
+{
+    uint8_t s = fqhsector;
+    uint32_t o = fqhoffset, len;
+    //---------
+    fqdcount = 0;
+    fqdbytes = 0;
+    while(fqflash && FlashQueueSeek(&s, &o, NULL))
+    {
+        len = FlashQueueWord(s, o) & 0xFFFF;
+        if(fqdcount && ((fqdbytes + len) > maxsize))
+            break;
+        fqdbytes += len;
+        fqdcount++;
+        o += FlashQueueRecordSize(s, o);
+    }
+    fqdsector = fqhsector;
+    fqdoffset = fqhoffset;
+    fqdhanded = 0;
+    *size = fqdbytes;
+    return fqdcount;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+uint16_t SIM800xFlashQueueProducer(const uint8_t** data, uint32_t offset, uint32_t remain)
+{
+    uint16_t len;
+    //---------
+    if((fqdhanded >= fqdcount) || !FlashQueueSeek(&fqdsector, &fqdoffset, NULL))
+        return 0;
+    len = (uint16_t)(FlashQueueWord(fqdsector, fqdoffset) & 0xFFFF);
+    *data = &fqflash->base[(uint32_t)fqdsector * FLASHQUEUE_SS + fqdoffset + FLASHQUEUE_FRAME_SIZE];
+    fqdoffset += FlashQueueRecordSize(fqdsector, fqdoffset);
+    fqdhanded++;
+    return len;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xFlashQueueDrainCommit(void)
+{
+    //---------
+    while(fqdcount && FlashQueueSeek(&fqhsector, &fqhoffset, NULL))
+    {
+        if(!FlashQueueProgram(fqhsector, fqhoffset + 8, 0))
+            return SIM800X_ERROR;
+        fqstats.records--;
+        fqstats.bytes -= FlashQueueWord(fqhsector, fqhoffset) & 0xFFFF;
+        fqhoffset += FlashQueueRecordSize(fqhsector, fqhoffset);
+        fqdcount--;
+    }
+    fqdcount = 0;
+    FlashQueueAdvanceHead();
+    return SIM800X_OK;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xFlashQueueGetStats(SIM800xFlashQueueStatsType* stats)
+{
+    *stats = fqstats;
+}
+//-----------------------------------
+
+#if defined(HAL_FLASH_MODULE_ENABLED)
+//-----------------------------------
+static uint8_t FlashQueueHALErase(uint8_t sector)
+{
+    FLASH_EraseInitTypeDef erase;
+    HAL_StatusTypeDef status;
+    uint32_t error;
+    //---------
+    erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+    erase.Banks = FLASH_BANK_1;
+    erase.Sector = CONFIG_FLASHQUEUE_FIRST_SECTOR + sector;
+    erase.NbSectors = 1;
+    erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+    HAL_FLASH_Unlock();
+    status = HAL_FLASHEx_Erase(&erase, &error);
+    HAL_FLASH_Lock();
+    return status == HAL_OK;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static uint8_t FlashQueueHALProgram(uint32_t offset, uint32_t word)
+{
+    HAL_StatusTypeDef status;
+    //---------
+    HAL_FLASH_Unlock();
+    status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, CONFIG_FLASHQUEUE_ADDRESS + offset, word);
+    HAL_FLASH_Lock();
+    return status == HAL_OK;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+const SIM800xFlashQueueFlashType SIM800xFlashQueueHALFlash =
+{
+    FlashQueueHALErase,
+    FlashQueueHALProgram,
+    (const uint8_t*)CONFIG_FLASHQUEUE_ADDRESS
+};
+//-----------------------------------
+#endif
@@ -0,0 +1,197 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_HTTPCache.c
+ * @author          Firmware-Engineers
+ * @brief           SIM800 series modems HTTP parameters shadow cache
+ * @brief           See SIM800x_HTTPCache.h for more details.
+ ******************************************************************************
+ */
+
+//-----------------------------------
+#include "SIM800x_HTTPCache.h"
+#include "SIM800x_HTTP.h"
+#include "SIM800x_AT.h"
+#include <string.h>
+//-----------------------------------
+
+//-----------------------------------
+#define HTTPCACHE_FNV_OFFSET                2166136261UL                        //!< FNV-1a 32-bit parameters
+#define HTTPCACHE_FNV_PRIME                 16777619UL
+//-----------------------------------
+
+/**
+  * @brief  Cached parameter index type definition
+  */
+typedef enum
+{
+    //---------
+    HTTPCACHE_CID                       = 0,
+    HTTPCACHE_URL                       = 1,
+    HTTPCACHE_UA                        = 2,
+    HTTPCACHE_CONTENT                   = 3,
+    HTTPCACHE_USERDATA                  = 4,
+    HTTPCACHE_COUNT                     = 5
+    //---------
+}SIM800xHTTPCacheParamType;
+//-----------------------------------
+
+/**
+  * @brief  Cached parameter value
+  */
+typedef struct
+{
+    //---------
+    uint32_t                hash;
+    uint16_t                len;
+    uint8_t                 valid;
+    //---------
+}SIM800xHTTPCacheEntryType;
+//-----------------------------------
+
+//-----------------------------------
+static SIM800xHTTPCacheEntryType    cache[HTTPCACHE_COUNT];
+static uint32_t                     cachehits;
+static uint32_t                     cachemisses;
+//-----------------------------------
+
+//-----------------------------------
+static uint32_t HTTPCacheHash(const uint8_t* data, uint16_t len)
+{
+    uint32_t hash = HTTPCACHE_FNV_OFFSET;
+    //---------
+    while(len--)
+    {
+        hash ^= *data++;
+        hash *= HTTPCACHE_FNV_PRIME;
+    }
+    return hash;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static uint8_t HTTPCacheURC(const char* line)
+{
+    if(strcmp(line, "RDY"))                                                     //!< Modem restarted
+        return 0;
+    SIM800xHTTPCacheInvalidate();
+    return 1;
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Look up a parameter value
+ * @retval  1 if the modem already holds the value, 0 otherwise (entry updated to the new value, not yet valid)
+ */
+static uint8_t HTTPCacheLookup(SIM800xHTTPCacheParamType param, const void* value, uint16_t len)
+{
+    SIM800xHTTPCacheEntryType* entry = &cache[param];
+    uint32_t hash;
+    //---------
+    SIM800xATRegisterURC(HTTPCacheURC);
+    SIM800xATPoll();                                                            //!< Catch a reset notification first
+    hash = HTTPCacheHash((const uint8_t*)value, len);
+    if(entry->valid && (entry->hash == hash) && (entry->len == len))
+    {
+        cachehits++;
+        return 1;
+    }
+    cachemisses++;
+    entry->valid = 0;
+    entry->hash = hash;
+    entry->len = len;
+    return 0;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static SIM800x_APIStatusType HTTPCacheUpdate(SIM800xHTTPCacheParamType param, SIM800x_APIStatusType status)
+{
+    cache[param].valid = (status == SIM800X_OK);                               //!< Modem value unknown after a failure
+    return status;
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPCacheInit(uint16_t* errcode)
+{
+    SIM800xHTTPCacheInvalidate();
+    return SIM800xHTTPInit(errcode);
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPCacheTerminate(uint16_t* errcode)
+{
+    SIM800xHTTPCacheInvalidate();
+    return SIM800xHTTPTerminate(errcode);
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xHTTPCacheInvalidate(void)
+{
+    uint8_t i;
+    //---------
+    for(i = 0; i < HTTPCACHE_COUNT; i++)
+        cache[i].valid = 0;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPCacheSetCID(uint8_t cid, uint16_t* errcode)
+{
+    if(HTTPCacheLookup(HTTPCACHE_CID, &cid, 1))
+        return SIM800X_OK;
+    return HTTPCacheUpdate(HTTPCACHE_CID, SIM800xHTTPSetCID(cid, errcode));
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPCacheSetURL(const char* url, uint16_t* errcode)
+{
+    if(HTTPCacheLookup(HTTPCACHE_URL, url, (uint16_t)strlen(url)))
+        return SIM800X_OK;
+    return HTTPCacheUpdate(HTTPCACHE_URL, SIM800xHTTPSetURL(url, errcode));
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPCacheSetUA(const char* ua, uint16_t* errcode)
+{
+    if(HTTPCacheLookup(HTTPCACHE_UA, ua, (uint16_t)strlen(ua)))
+        return SIM800X_OK;
+    return HTTPCacheUpdate(HTTPCACHE_UA, SIM800xHTTPSetUA(ua, errcode));
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPCacheSetContent(const char* content, uint16_t* errcode)
+{
+    if(HTTPCacheLookup(HTTPCACHE_CONTENT, content, (uint16_t)strlen(content)))
+        return SIM800X_OK;
+    return HTTPCacheUpdate(HTTPCACHE_CONTENT, SIM800xHTTPSetContent(content, errcode));
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPCacheSetUserData(const char* userdata, uint16_t* errcode)
+{
+    if(HTTPCacheLookup(HTTPCACHE_USERDATA, userdata, (uint16_t)strlen(userdata)))
+        return SIM800X_OK;
+    return HTTPCacheUpdate(HTTPCACHE_USERDATA, SIM800xHTTPSetUserData(userdata, errcode));
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xHTTPCacheGetStats(uint32_t* hits, uint32_t* misses)
+{
+    if(hits)
+        *hits = cachehits;
+    if(misses)
+        *misses = cachemisses;
+}
+//-----------------------------------
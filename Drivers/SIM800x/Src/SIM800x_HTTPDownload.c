@@ -0,0 +1,129 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_HTTPDownload.c
+ * @author          Firmware-Engineers
+ * @brief           SIM800 series modems resumable HTTP downloads
+ * @brief           See SIM800x_HTTPDownload.h for more details.
+ ******************************************************************************
+ */
+
+//-----------------------------------
+#include "SIM800x_HTTPDownload.h"
+#include "SIM800x_HTTP.h"
+#include "SIM800x_CRC.h"
+#include "SIM800x_SDM.h"
+#include <string.h>
+//-----------------------------------
+
+//-----------------------------------
+#define HTTPDOWNLOAD_GET                    0                                   //!< SIM800xHTTPAction() GET method
+//-----------------------------------
+
+//-----------------------------------
+static uint8_t                      rangebuf[CONFIG_HTTP_DOWNLOAD_RANGE];       //!< Range being received, held back from the sink until verified
+static uint32_t                     rangecrc;                                   //!< CRC-32 of the range received so far
+static uint8_t                      sinkabort;
+//-----------------------------------
+
+//-----------------------------------
+static uint8_t HTTPDownloadSink(const uint8_t* data, uint16_t len, uint32_t offset)
+{
+    //---------
+    if((offset + len) > sizeof(rangebuf))
+        return 0;
+    memcpy(&rangebuf[offset], data, len);
+    rangecrc = SIM800xCRC32(rangecrc, data, len);
+    return 1;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Fetch and verify one range, starting at dl->progress.offset
+ */
+static SIM800x_APIStatusType HTTPDownloadRange(SIM800xHTTPDownloadType* dl, uint32_t len, uint32_t tout, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    uint32_t offset = dl->progress.offset, rcnt, cnt;
+    uint16_t scode;
+    //---------
+    status = SIM800xHTTPSessionOpen(dl->session, errcode);
+    if(status != SIM800X_OK)
+        return status;
+    status = SIM800xHTTPSetBreak(offset, errcode);                             //!< Not kept by the modem across an HTTP service restart
+    if(status == SIM800X_OK)
+        status = SIM800xHTTPSetBreakEnd(offset + len - 1, errcode);
+    if(status != SIM800X_OK)
+    {
+        SIM800xHTTPSessionInvalidate(dl->session, HTTP_SESSION_SERVICE);
+        return status;
+    }
+    status = SIM800xHTTPSessionRequest(dl->session, HTTPDOWNLOAD_GET, NULL, 0, &scode, &rcnt, tout, errcode);
+    if(status != SIM800X_OK)
+        return status;
+    if(((scode != HTTP_PARTIAL_CONTENT) && ((scode != HTTP_OK) || offset)) || (rcnt != len))
+        return SIM800X_ERROR;                                                   //!< Server ignored the range, or the resource changed
+    //---------
+    rangecrc = 0;
+    status = SIM800xHTTPStreamRead(0, len, HTTPDownloadSink, &cnt, errcode);
+    if(status != SIM800X_OK)
+        return status;
+    if((cnt != len) || (dl->crcs[offset / CONFIG_HTTP_DOWNLOAD_RANGE] != rangecrc))
+        return SIM800X_ERROR;                                                   //!< Dropped, the sink never sees a corrupted range
+    if(!dl->sink(rangebuf, (uint16_t)len, offset))
+        sinkabort = 1;
+    return SIM800X_OK;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xHTTPDownloadInit(SIM800xHTTPDownloadType* dl, SIM800xHTTPSessionType* session, uint32_t size, const uint32_t* crcs, SIM800xHTTPStreamCallBack sink, SIM800xHTTPDownloadSaveCallBack save, const SIM800xHTTPDownloadProgressType* resume)
+{
+    dl->session = session;
+    dl->size = size;
+    dl->crcs = crcs;
+    dl->sink = sink;
+    dl->save = save;
+    dl->progress.offset = 0;
+    if(resume && (resume->offset <= size) && !(resume->offset % CONFIG_HTTP_DOWNLOAD_RANGE))
+        dl->progress = *resume;                                                 //!< The sink data is not read back, See SIM800x_HTTPDownload.h
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPDownloadRun(SIM800xHTTPDownloadType* dl, uint8_t retries, uint32_t tout, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    uint32_t len;
+    uint8_t failures = 0;
+    //---------
+    sinkabort = 0;
+    if(!dl->crcs)
+        return SIM800X_ERROR;
+    while(dl->progress.offset < dl->size)
+    {
+        len = dl->size - dl->progress.offset;
+        if(len > CONFIG_HTTP_DOWNLOAD_RANGE)
+            len = CONFIG_HTTP_DOWNLOAD_RANGE;
+        status = HTTPDownloadRange(dl, len, tout, errcode);
+        if(sinkabort)
+            return SIM800X_ERROR;
+        if(status != SIM800X_OK)
+        {
+            if(++failures > retries)
+                return status;
+            continue;                                                           //!< Fetch the same range again, the session restores the lost parts
+        }
+        failures = 0;
+        dl->progress.offset += len;
+        if(dl->save && !dl->save(&dl->progress))
+            return SIM800X_ERROR;
+    }
+    //---------
+    SIM800xHTTPSessionInvalidate(dl->session, HTTP_SESSION_SERVICE);            //!< Drop the range parameters before the next request
+    return SIM800X_OK;
+    //---------
+}
+//-----------------------------------
@@ -0,0 +1,81 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_HTTPS.c
+ * @author          Firmware-Engineers
+ * @brief           SIM800 series modems HTTPS functions
+ * @brief           See SIM800x_HTTPS.h for more details.
+ ******************************************************************************
+ */
+
+//-----------------------------------
+#include "SIM800x_HTTPS.h"
+#include "SIM800x_AT.h"
+#include "SIM800x_SDM.h"
+#include <string.h>
+//-----------------------------------
+
+//-----------------------------------
+#define HTTPS_CMD_TIME_OUT                  5000                                //!< Command response time-out, in milliseconds
+#define HTTPS_CERT_TIME_OUT                 10000                               //!< Certificate loading time-out, in milliseconds
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPSSetSSL(uint8_t enable, uint16_t* errcode)
+{
+    return SIM800xATCommand(enable ? "AT+HTTPSSL=1" : "AT+HTTPSSL=0", NULL, NULL, 0, HTTPS_CMD_TIME_OUT, errcode);
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPSGetSSL(uint8_t* enable, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    char resp[16];
+    //---------
+    status = SIM800xATCommand("AT+HTTPSSL?", "+HTTPSSL:", resp, sizeof(resp), HTTPS_CMD_TIME_OUT, errcode);
+    if(status == SIM800X_OK)
+        *enable = (uint8_t)(resp[10] == '1');                                   //!< "+HTTPSSL: <n>"
+    return status;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPSSetOption(SIM800xHTTPSOptionType option, uint8_t enable, uint16_t* errcode)
+{
+    char cmd[20], *p;
+    //---------
+    p = SIM800xATAppendStr(cmd, "AT+SSLOPT=");
+    p = SIM800xATAppendUInt(p, (uint32_t)option);
+    SIM800xATAppendStr(p, enable ? ",1" : ",0");
+    return SIM800xATCommand(cmd, NULL, NULL, 0, HTTPS_CMD_TIME_OUT, errcode);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPSSetCert(const char* file, const char* password, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    char line[CONFIG_AT_LINE_SIZE], *p;
+    //---------
+    if((strlen(file) + (password ? strlen(password) : 0) + 22) > sizeof(line))
+        return SIM800X_ERROR;
+    p = SIM800xATAppendStr(line, "AT+SSLSETCERT=\"");
+    p = SIM800xATAppendStr(p, file);
+    if(password)
+    {
+        p = SIM800xATAppendStr(p, "\",\"");
+        p = SIM800xATAppendStr(p, password);
+    }
+    SIM800xATAppendStr(p, "\"");
+    status = SIM800xATCommand(line, NULL, NULL, 0, HTTPS_CMD_TIME_OUT, errcode);
+    if(status != SIM800X_OK)
+        return status;
+    status = SIM800xATWaitLine("+SSLSETCERT:", line, sizeof(line), HTTPS_CERT_TIME_OUT, errcode);
+    if(status != SIM800X_OK)
+        return status;
+    return (line[13] == '0') ? SIM800X_OK : SIM800X_ERROR;                      //!< "+SSLSETCERT: <n>", 0: success
+    //---------
+}
+//-----------------------------------
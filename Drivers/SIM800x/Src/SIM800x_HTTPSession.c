@@ -0,0 +1,227 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_HTTPSession.c
+ * @author          Firmware-Engineers
+ * @brief           SIM800 series modems managed HTTP session
+ * @brief           See SIM800x_HTTPSession.h for more details.
+ ******************************************************************************
+ */
+
+//-----------------------------------
+#include "SIM800x_HTTPSession.h"
+#include "SIM800x_HTTP.h"
+#include "SIM800x_HTTPCache.h"
+#include "SIM800x_HTTPS.h"
+#include "SIM800x_IP.h"
+#include "SIM800x_AT.h"
+#include <string.h>
+//-----------------------------------
+
+//-----------------------------------
+#define HTTPSESSION_INPUT_TIME_OUT          5000                                //!< HTTP data input time-out, in milliseconds, increased with the data size
+#define HTTPSESSION_CONTENT_DEFAULT         "text/plain"                        //!< Modem default "CONTENT" parameter
+//-----------------------------------
+
+//-----------------------------------
+static SIM800xHTTPSessionType* urcsession;                                      //!< Session invalidated by the bearer URC
+//-----------------------------------
+
+//-----------------------------------
+static uint8_t HTTPSessionURC(const char* line)
+{
+    //---------
+    if(strncmp(line, "+SAPBR ", 7) || strcmp(&line[8], ": DEACT"))              //!< "+SAPBR <cid>: DEACT"
+        return 0;
+    if(urcsession && (urcsession->cid == (uint8_t)(line[7] - '0')))
+        SIM800xHTTPSessionInvalidate(urcsession, HTTP_SESSION_BEARER);
+    return 1;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static uint8_t HTTPSessionIsSSL(const char* url)
+{
+    return url && !strncmp(url, "https://", 8);
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xHTTPSessionInit(SIM800xHTTPSessionType* session, uint8_t cid, const char* apn, const char* url, const char* content)
+{
+    session->cid = cid;
+    session->apn = apn;
+    session->url = url;
+    session->content = content;
+    session->userdata = NULL;
+    session->cert = NULL;
+    session->certpw = NULL;
+    session->ssl = HTTPSessionIsSSL(url);
+    session->live = 0;
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xHTTPSessionSetURL(SIM800xHTTPSessionType* session, const char* url)
+{
+    if(HTTPSessionIsSSL(url) != session->ssl)                                   //!< SSL is set per HTTP service
+        SIM800xHTTPSessionInvalidate(session, HTTP_SESSION_SERVICE);
+    else if(!session->url || strcmp(session->url, url))
+        SIM800xHTTPSessionInvalidate(session, HTTP_SESSION_PARAMS);
+    session->url = url;
+    session->ssl = HTTPSessionIsSSL(url);
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xHTTPSessionSetUserData(SIM800xHTTPSessionType* session, const char* userdata)
+{
+    if((session->userdata != userdata) && (!session->userdata || !userdata || strcmp(session->userdata, userdata)))
+        SIM800xHTTPSessionInvalidate(session, HTTP_SESSION_PARAMS);
+    session->userdata = userdata;
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xHTTPSessionSetCert(SIM800xHTTPSessionType* session, const char* cert, const char* password)
+{
+    if((session->cert != cert) || (session->certpw != password))
+    {
+        if(session->ssl)
+            SIM800xHTTPSessionInvalidate(session, HTTP_SESSION_SERVICE);
+    }
+    session->cert = cert;
+    session->certpw = password;
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xHTTPSessionInvalidate(SIM800xHTTPSessionType* session, uint8_t parts)
+{
+    if(parts & HTTP_SESSION_BEARER)                                             //!< Dependent parts are invalidated too
+        parts |= HTTP_SESSION_SERVICE;
+    if(parts & HTTP_SESSION_SERVICE)
+        parts |= HTTP_SESSION_PARAMS;
+    session->live &= (uint8_t)~parts;
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPSessionOpen(SIM800xHTTPSessionType* session, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    char ip[20];
+    //---------
+    SIM800xATRegisterURC(HTTPSessionURC);
+    urcsession = session;
+    if(!(session->live & HTTP_SESSION_BEARER))
+    {
+        if(SIM800xIPGetState(session->cid, ip) != IP_CONNECTED)
+        {
+            status = SIM800xIPSetConnectionType(session->cid, "GPRS");
+            if(status != SIM800X_OK)
+                return status;
+            status = SIM800xIPSetAPN(session->cid, session->apn);
+            if(status != SIM800X_OK)
+                return status;
+            status = SIM800xIPOpen(session->cid);
+            if(status != SIM800X_OK)
+                return status;
+        }
+        session->live |= HTTP_SESSION_BEARER;
+    }
+    //---------
+    if(!(session->live & HTTP_SESSION_SERVICE))
+    {
+        status = SIM800xHTTPCacheInit(errcode);
+        if(status != SIM800X_OK)                                                //!< Service left initialized by a previous session
+        {
+            SIM800xHTTPCacheTerminate(errcode);
+            status = SIM800xHTTPCacheInit(errcode);
+            if(status != SIM800X_OK)
+                return status;
+        }
+        if(session->ssl)                                                        //!< SSL context kept until the service is terminated
+        {
+            if(session->cert)
+                status = SIM800xHTTPSSetCert(session->cert, session->certpw, errcode);
+            if(status == SIM800X_OK)
+                status = SIM800xHTTPSSetOption(HTTPS_OPT_CLIENT_AUTH, session->cert != NULL, errcode);
+            if(status == SIM800X_OK)
+                status = SIM800xHTTPSSetSSL(1, errcode);
+            if(status != SIM800X_OK)
+                return status;
+        }
+        session->live |= HTTP_SESSION_SERVICE;
+    }
+    //---------
+    if(!(session->live & HTTP_SESSION_PARAMS))
+    {
+        status = SIM800xHTTPCacheSetCID(session->cid, errcode);                //!< Only the changed parameters are sent
+        if(status == SIM800X_OK)
+            status = SIM800xHTTPCacheSetURL(session->url, errcode);
+        if(status == SIM800X_OK)                                                //!< NULL puts the default back, the previous value would stay in force
+            status = SIM800xHTTPCacheSetContent(session->content ? session->content : HTTPSESSION_CONTENT_DEFAULT, errcode);
+        if(status == SIM800X_OK)
+            status = SIM800xHTTPCacheSetUserData(session->userdata ? session->userdata : "", errcode);
+        if(status != SIM800X_OK)
+            return status;
+        session->live |= HTTP_SESSION_PARAMS;
+    }
+    return SIM800X_OK;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPSessionRequest(SIM800xHTTPSessionType* session, uint8_t method, char* data, uint32_t cnt, uint16_t* statuscode, uint32_t* rcnt, uint32_t tout, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    uint32_t itout;
+    //---------
+    SIM800xATPoll();                                                            //!< Catch the URCs received since the last request
+    status = SIM800xHTTPSessionOpen(session, errcode);
+    if(status != SIM800X_OK)
+        return status;
+    if(data && cnt)
+    {
+        itout = HTTPSESSION_INPUT_TIME_OUT + cnt;
+        status = SIM800xHTTPInputData(data, cnt, (itout > 120000) ? 120000 : itout, errcode);
+        if(status != SIM800X_OK)
+        {
+            SIM800xHTTPSessionInvalidate(session, HTTP_SESSION_SERVICE);
+            return status;
+        }
+    }
+    //---------
+    status = SIM800xHTTPAction(method, statuscode, rcnt, tout, errcode);
+    if(status != SIM800X_OK)
+        SIM800xHTTPSessionInvalidate(session, HTTP_SESSION_SERVICE);
+    else if(*statuscode == HTTP_NETWORK_ERROR)
+        SIM800xHTTPSessionInvalidate(session, HTTP_SESSION_BEARER);
+    else if(*statuscode == HTTP_STACK_BUSY)
+        SIM800xHTTPSessionInvalidate(session, HTTP_SESSION_SERVICE);
+    return status;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPSessionClose(SIM800xHTTPSessionType* session, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status = SIM800X_OK;
+    //---------
+    if(session->live & HTTP_SESSION_SERVICE)
+        status = SIM800xHTTPCacheTerminate(errcode);
+    if(session->live & HTTP_SESSION_BEARER)
+    {
+        if(SIM800xIPClose(session->cid) != SIM800X_OK)
+            status = SIM800X_ERROR;
+    }
+    session->live = 0;
+    if(urcsession == session)
+        urcsession = NULL;
+    return status;
+    //---------
+}
+//-----------------------------------
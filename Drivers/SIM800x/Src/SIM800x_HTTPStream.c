@@ -0,0 +1,166 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_HTTPStream.c
+ * @author          Firmware-Engineers
+ * @brief           SIM800 series modems HTTP streaming
+ * @brief           See SIM800x_HTTPStream.h for more details.
+ ******************************************************************************
+ */
+
+//-----------------------------------
+#include "SIM800x_HTTPStream.h"
+#include "SIM800x_AT.h"
+#include "SIM800x_SDM.h"
+#include <string.h>
+#include <stdlib.h>
+//-----------------------------------
+
+//-----------------------------------
+#define HTTPSTREAM_CMD_TIME_OUT             5000                                //!< Command response time-out, in milliseconds
+#define HTTPSTREAM_MAX_SIZE                 319488UL                            //!< Maximum AT+HTTPDATA size, in bytes
+//-----------------------------------
+
+//-----------------------------------
+static uint8_t chunk[CONFIG_HTTP_STREAM_CHUNK];
+static const SIM800xHTTPStreamSegmentType*  segment;                            //!< Segment list state, for HTTPStreamSegmentProducer()
+static uint8_t                              segmentcnt;
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Read one AT+HTTPREAD window
+ * @param   len: number of bytes actually returned by the modem
+ * @param   abort: set when the call-back aborts, the remaining window data is then drained
+ */
+static SIM800x_APIStatusType HTTPStreamWindow(uint32_t start, uint16_t size, SIM800xHTTPStreamCallBack cb, uint16_t* len, uint8_t* abort, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    char line[CONFIG_AT_LINE_SIZE], *p;
+    uint16_t n, got, done = 0;
+    //---------
+    p = SIM800xATAppendStr(line, "AT+HTTPREAD=");
+    p = SIM800xATAppendUInt(p, start);
+    *p++ = ',';
+    p = SIM800xATAppendUInt(p, size);
+    SIM800xATAppendStr(p, "\r");
+    SIM800xATPoll();
+    SIM800xSDMPrint(line);
+    *len = 0;
+    status = SIM800xATWaitLine("+HTTPREAD:", line, sizeof(line), HTTPSTREAM_CMD_TIME_OUT, errcode);
+    if(status != SIM800X_OK)
+        return status;
+    *len = (uint16_t)strtoul(&line[10], NULL, 10);                             //!< "+HTTPREAD: <len>", followed by the data
+    //---------
+    while(done < *len)
+    {
+        n = (uint16_t)(*len - done);
+        if(n > CONFIG_HTTP_STREAM_CHUNK)
+            n = CONFIG_HTTP_STREAM_CHUNK;
+        got = SIM800xSDMReadBytes(chunk, n, 1000 + n);
+        if(got < n)
+            return SIM800X_TIME_OUT;
+        if(!*abort && !cb(chunk, n, start + done))
+            *abort = 1;
+        done += n;
+    }
+    return SIM800xATWaitLine("OK", NULL, 0, HTTPSTREAM_CMD_TIME_OUT, errcode);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPStreamRead(uint32_t start, uint32_t size, SIM800xHTTPStreamCallBack cb, uint32_t* cnt, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status = SIM800X_OK;
+    uint32_t total = 0;
+    uint16_t win, len;
+    uint8_t abort = 0;
+    //---------
+    if(!cb)
+        return SIM800X_ERROR;
+    while(total < size)
+    {
+        win = (uint16_t)(((size - total) > CONFIG_HTTP_STREAM_WINDOW) ? CONFIG_HTTP_STREAM_WINDOW : (size - total));
+        status = HTTPStreamWindow(start + total, win, cb, &len, &abort, errcode);
+        if(!abort)
+            total += len;
+        if((status != SIM800X_OK) || abort || !len)                             //!< No more data
+            break;
+    }
+    if(cnt)
+        *cnt = total;
+    return abort ? SIM800X_ERROR : status;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static uint16_t HTTPStreamSegmentProducer(const uint8_t** data, uint32_t offset, uint32_t remain)
+{
+    //---------
+    while(segmentcnt && !segment->len)
+    {
+        segment++;
+        segmentcnt--;
+    }
+    if(!segmentcnt)
+        return 0;
+    *data = segment->data;
+    segmentcnt--;
+    return (segment++)->len;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPStreamWrite(uint32_t size, SIM800xHTTPStreamProducer producer, uint32_t timeout, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    char line[CONFIG_AT_LINE_SIZE], *p;
+    const uint8_t* data;
+    uint32_t done = 0;
+    uint16_t n;
+    //---------
+    if(!producer || !size || (size > HTTPSTREAM_MAX_SIZE) || (timeout < 1000) || (timeout > 120000))
+        return SIM800X_ERROR;
+    p = SIM800xATAppendStr(line, "AT+HTTPDATA=");
+    p = SIM800xATAppendUInt(p, size);
+    *p++ = ',';
+    p = SIM800xATAppendUInt(p, timeout);
+    SIM800xATAppendStr(p, "\r");
+    SIM800xATPoll();
+    SIM800xSDMPrint(line);
+    status = SIM800xATWaitLine("DOWNLOAD", NULL, 0, HTTPSTREAM_CMD_TIME_OUT, errcode);
+    if(status != SIM800X_OK)
+        return status;
+    //---------
+    while(done < size)
+    {
+        n = producer(&data, done, size - done);
+        if(!n || (n > (size - done)))                                           //!< Aborted, the modem closes the input on time-out
+            break;
+        SIM800xSDMSendBytes((uint8_t*)data, n);
+        done += n;
+    }
+    status = SIM800xATWaitLine("OK", NULL, 0, (done < size) ? (timeout + HTTPSTREAM_CMD_TIME_OUT) : HTTPSTREAM_CMD_TIME_OUT, errcode);
+    if(done < size)
+        return SIM800X_ERROR;
+    return status;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xHTTPStreamWriteSegments(const SIM800xHTTPStreamSegmentType* segments, uint8_t count, uint32_t timeout, uint16_t* errcode)
+{
+    uint32_t size = 0;
+    uint8_t i;
+    //---------
+    for(i = 0; i < count; i++)
+        size += segments[i].len;
+    segment = segments;
+    segmentcnt = count;
+    return SIM800xHTTPStreamWrite(size, HTTPStreamSegmentProducer, timeout, errcode);
+    //---------
+}
+//-----------------------------------
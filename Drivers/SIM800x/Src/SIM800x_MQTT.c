@@ -0,0 +1,642 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_MQTT.c
+ * @author          Firmware-Engineers
+ * @brief           SIM800 series modems MQTT 3.1.1 client
+ * @brief           See SIM800x_MQTT.h for more details.
+ ******************************************************************************
+ */
+
+//-----------------------------------
+#include "SIM800x_MQTT.h"
+#include "SIM800x_SDM.h"
+#include <string.h>
+//-----------------------------------
+
+//-----------------------------------
+#define MQTT_CONNECT                        0x10                                //!< Control packet types (fixed header first byte)
+#define MQTT_CONNACK                        0x20
+#define MQTT_PUBLISH                        0x30
+#define MQTT_PUBACK                         0x40
+#define MQTT_SUBSCRIBE                      0x82
+#define MQTT_SUBACK                         0x90
+#define MQTT_UNSUBSCRIBE                    0xA2
+#define MQTT_UNSUBACK                       0xB0
+#define MQTT_PINGREQ                        0xC0
+#define MQTT_PINGRESP                       0xD0
+#define MQTT_DISCONNECT                     0xE0
+#define MQTT_DUP_FLAG                       0x08
+//-----------------------------------
+#define MQTT_SEND_TIME_OUT                  10000                               //!< Packet send time-out, in milliseconds
+//-----------------------------------
+
+/**
+  * @brief  Incoming packet parser state type definition
+  */
+typedef enum
+{
+    //---------
+    MQTT_RX_HEADER                      = 0,                                    //!< Reading the first two fixed header bytes
+    MQTT_RX_LENGTH                      = 1,                                    //!< Reading the remaining length continuation bytes
+    MQTT_RX_BODY                        = 2,                                    //!< Reading the packet body
+    MQTT_RX_DISCARD                     = 3                                     //!< Skipping a packet too large for the buffer
+    //---------
+}SIM800xMQTTRxStateType;
+//-----------------------------------
+
+/**
+  * @brief  QoS 1 inflight message descriptor
+  */
+typedef struct
+{
+    //---------
+    uint16_t                id;                                                 //!< Packet identifier, 0 when the slot is free
+    uint16_t                len;
+    uint32_t                sent;                                               //!< Last transmission tick
+    uint8_t                 pkt[CONFIG_MQTT_PACKET_SIZE];                       //!< Complete PUBLISH packet, kept for retransmission
+    //---------
+}SIM800xMQTTInflightType;
+//-----------------------------------
+
+//-----------------------------------
+static SIM800xMQTTStateType         mqttstate = MQTT_DISCONNECTED;
+static SIM800xMQTTMessageCallBack   mqttcb;
+static uint8_t                      mqttconn;                                   //!< TCP/IP connection number
+static uint16_t                     mqttkeepalive;
+static uint16_t                     mqttnextid;
+static uint32_t                     mqttlastsent;
+static uint32_t                     mqttpingsent;
+static uint8_t                      mqttpingpending;
+static uint16_t                     mqttackid;                                  //!< Packet identifier of the pending SUBSCRIBE/UNSUBSCRIBE
+static uint8_t                      mqttackrc;                                  //!< Its acknowledgment return code, 0xFF while pending
+//-----------------------------------
+static SIM800xMQTTRxStateType       rxstate;
+static uint8_t                      rxtype;
+static uint32_t                     rxlen;
+static uint8_t                      rxshift;
+static uint32_t                     rxpos;
+static uint8_t                      rxpkt[CONFIG_MQTT_PACKET_SIZE];
+static uint8_t                      rxfifo[CONFIG_MQTT_RX_FIFO_SIZE];           //!< TCP/IP connection receive buffer
+//-----------------------------------
+static uint8_t                      txpkt[CONFIG_MQTT_PACKET_SIZE];             //!< QoS 0 and control packets
+static SIM800xMQTTInflightType      inflight[CONFIG_MQTT_MAX_INFLIGHT];
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Write the fixed header of a packet, encoding the remaining length
+ * @retval  fixed header size in bytes
+ */
+static uint8_t MQTTFixedHeader(uint8_t* dst, uint8_t type, uint32_t len)
+{
+    uint8_t n = 1;
+    //---------
+    dst[0] = type;
+    do
+    {
+        dst[n] = (uint8_t)(len & 0x7F);
+        len >>= 7;
+        if(len)
+            dst[n] |= 0x80;
+        n++;
+    }while(len);
+    return n;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Get the fixed header size for a given remaining length
+ */
+static uint8_t MQTTFixedHeaderSize(uint32_t len)
+{
+    return (len < 128) ? 2 : ((len < 16384) ? 3 : 4);
+}
+//-----------------------------------
+
+//-----------------------------------
+static uint8_t* MQTTPutU16(uint8_t* dst, uint16_t value)
+{
+    *dst++ = (uint8_t)(value >> 8);
+    *dst++ = (uint8_t)value;
+    return dst;
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Write a length prefixed UTF-8 string
+ */
+static uint8_t* MQTTPutStr(uint8_t* dst, const char* str, uint16_t len)
+{
+    dst = MQTTPutU16(dst, len);
+    memcpy(dst, str, len);
+    return dst + len;
+}
+//-----------------------------------
+
+//-----------------------------------
+static uint16_t MQTTNextId(void)
+{
+    if(!++mqttnextid)
+        mqttnextid = 1;
+    return mqttnextid;
+}
+//-----------------------------------
+
+//-----------------------------------
+static void MQTTDrop(void)
+{
+    uint8_t i;
+    //---------
+    mqttstate = MQTT_DISCONNECTED;
+    for(i = 0; i < CONFIG_MQTT_MAX_INFLIGHT; i++)
+        inflight[i].id = 0;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static SIM800x_APIStatusType MQTTSend(const uint8_t* pkt, uint16_t len, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    //---------
+    status = SIM800xTCPIPSend(mqttconn, pkt, len, MQTT_SEND_TIME_OUT, errcode);
+    if(status == SIM800X_OK)
+        mqttlastsent = Tick();
+    else if(SIM800xTCPIPGetState(mqttconn) != TCPIP_CONNECTED)
+        MQTTDrop();
+    return status;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Send a two-byte packet identifier acknowledgment (PUBACK)
+ */
+static void MQTTSendAck(uint8_t type, uint16_t id)
+{
+    uint8_t pkt[4];
+    uint16_t errcode;
+    //---------
+    pkt[0] = type;
+    pkt[1] = 2;
+    MQTTPutU16(&pkt[2], id);
+    MQTTSend(pkt, sizeof(pkt), &errcode);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Process a complete incoming packet (rxtype, rxpkt[0...rxlen-1])
+ */
+static void MQTTProcess(void)
+{
+    uint16_t id, tlen, off;
+    uint8_t i, qos;
+    //---------
+    id = (rxlen >= 2) ? (uint16_t)((rxpkt[0] << 8) | rxpkt[1]) : 0;
+    switch(rxtype & 0xF0)
+    {
+        case MQTT_CONNACK:
+            if(mqttstate == MQTT_CONNECTING)
+                mqttstate = ((rxlen >= 2) && !rxpkt[1]) ? MQTT_CONNECTED : MQTT_DISCONNECTED;
+            break;
+        case MQTT_PUBLISH:
+            qos = (rxtype >> 1) & 0x03;
+            tlen = id;                                                          //!< Topic name length
+            off = 2 + tlen;
+            if(qos)
+            {
+                if(rxlen < (uint32_t)(off + 2))
+                    break;
+                id = (uint16_t)((rxpkt[off] << 8) | rxpkt[off + 1]);
+                off += 2;
+            }
+            if(rxlen < off)
+                break;
+            if(mqttcb)
+                mqttcb((const char*)&rxpkt[2], tlen, &rxpkt[off], (uint16_t)(rxlen - off));
+            if(qos == 1)
+                MQTTSendAck(MQTT_PUBACK, id);
+            break;
+        case MQTT_PUBACK:
+            for(i = 0; i < CONFIG_MQTT_MAX_INFLIGHT; i++)
+            {
+                if(inflight[i].id == id)
+                    inflight[i].id = 0;
+            }
+            break;
+        case MQTT_SUBACK:
+            if((id == mqttackid) && (rxlen >= 3))
+                mqttackrc = rxpkt[2];
+            break;
+        case MQTT_UNSUBACK:
+            if(id == mqttackid)
+                mqttackrc = 0;
+            break;
+        case MQTT_PINGRESP:
+            mqttpingpending = 0;
+            break;
+        default:
+            break;
+    }
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Acknowledge a QoS 1 PUBLISH dropped for being larger than the packet buffer,
+ *          so that the broker does not deliver it again
+ * @retval  1 if its packet identifier is not within the buffer, 0 otherwise
+ */
+static uint8_t MQTTDiscarded(void)
+{
+    uint32_t off;
+    //---------
+    if(((rxtype & 0xF0) != MQTT_PUBLISH) || (((rxtype >> 1) & 0x03) != 1))
+        return 0;
+    off = 2 + (uint32_t)((rxpkt[0] << 8) | rxpkt[1]);                           //!< Topic name, then packet identifier
+    if((off + 2) > sizeof(rxpkt))
+        return 1;
+    MQTTSendAck(MQTT_PUBACK, (uint16_t)((rxpkt[off] << 8) | rxpkt[off + 1]));
+    return 0;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Parse the received data, reading it in place into the packet buffer
+ */
+static void MQTTReceive(void)
+{
+    uint16_t got;
+    uint8_t tmp[16];
+    //---------
+    for(;;)
+    {
+        switch(rxstate)
+        {
+            case MQTT_RX_HEADER:                                                //!< Type and first length byte, the minimum packet
+                got = SIM800xTCPIPRead(mqttconn, &rxpkt[rxpos], (uint16_t)(2 - rxpos));
+                rxpos += got;
+                if(rxpos < 2)
+                    return;
+                rxtype = rxpkt[0];
+                rxlen = rxpkt[1] & 0x7F;
+                rxshift = 7;
+                if(rxpkt[1] & 0x80)
+                {
+                    rxstate = MQTT_RX_LENGTH;
+                    continue;
+                }
+                break;
+            case MQTT_RX_LENGTH:
+                if(!SIM800xTCPIPRead(mqttconn, tmp, 1))
+                    return;
+                rxlen |= (uint32_t)(tmp[0] & 0x7F) << rxshift;
+                rxshift += 7;
+                if(tmp[0] & 0x80)
+                {
+                    if(rxshift > 21)                                            //!< Malformed remaining length
+                    {
+                        SIM800xTCPIPClose(mqttconn, &got);
+                        MQTTDrop();
+                        return;
+                    }
+                    continue;
+                }
+                break;
+            case MQTT_RX_BODY:
+                got = SIM800xTCPIPRead(mqttconn, &rxpkt[rxpos], (uint16_t)(rxlen - rxpos));
+                rxpos += got;
+                if(rxpos < rxlen)
+                    return;
+                MQTTProcess();
+                rxstate = MQTT_RX_HEADER;
+                rxpos = 0;
+                continue;
+            case MQTT_RX_DISCARD:                                               //!< Packet larger than the buffer, its head is kept
+                if(rxpos < sizeof(rxpkt))
+                    got = SIM800xTCPIPRead(mqttconn, &rxpkt[rxpos], (uint16_t)(sizeof(rxpkt) - rxpos));
+                else
+                    got = SIM800xTCPIPRead(mqttconn, tmp, (uint16_t)(((rxlen - rxpos) > sizeof(tmp)) ? sizeof(tmp) : (rxlen - rxpos)));
+                rxpos += got;
+                if(rxpos < rxlen)
+                {
+                    if(!got)
+                        return;
+                    continue;
+                }
+                if(MQTTDiscarded())
+                {
+                    SIM800xTCPIPClose(mqttconn, &got);
+                    MQTTDrop();
+                    return;
+                }
+                rxstate = MQTT_RX_HEADER;
+                rxpos = 0;
+                continue;
+        }
+        //---------
+        rxpos = 0;                                                              //!< Remaining length complete
+        if(!rxlen)
+        {
+            MQTTProcess();
+            rxstate = MQTT_RX_HEADER;
+        }
+        else
+            rxstate = (rxlen > sizeof(rxpkt)) ? MQTT_RX_DISCARD : MQTT_RX_BODY;
+    }
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Poll until the pending SUBSCRIBE/UNSUBSCRIBE is acknowledged
+ */
+static SIM800x_APIStatusType MQTTWaitAck(uint32_t tout)
+{
+    uint32_t start = Tick();
+    //---------
+    while(mqttackrc == 0xFF)
+    {
+        if(SIM800xMQTTPoll() != MQTT_CONNECTED)
+            return SIM800X_ERROR;
+        if((Tick() - start) >= tout)
+            return SIM800X_TIME_OUT;
+    }
+    return (mqttackrc & 0x80) ? SIM800X_ERROR : SIM800X_OK;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xMQTTSetMessageCallBack(SIM800xMQTTMessageCallBack cb)
+{
+    mqttcb = cb;
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xMQTTConnect(uint8_t n, const char* host, uint16_t port, const char* clientid, const char* user, const char* pw, uint16_t keepalive, uint32_t tout, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    uint16_t idlen, ulen = 0, plen = 0;
+    uint32_t len, start = Tick();
+    uint8_t* p;
+    //---------
+    if(!clientid)
+        return SIM800X_ERROR;
+    idlen = (uint16_t)strlen(clientid);
+    if(user)
+        ulen = (uint16_t)strlen(user);
+    if(pw)
+        plen = (uint16_t)strlen(pw);
+    len = 10 + 2 + idlen + (user ? (2 + ulen) : 0) + (pw ? (2 + plen) : 0);
+    if((len + MQTTFixedHeaderSize(len)) > sizeof(txpkt))
+        return SIM800X_ERROR;
+    //---------
+    MQTTDrop();
+    status = SIM800xTCPIPConnect(n, TCPIP_TCP, host, port, rxfifo, sizeof(rxfifo), tout, errcode);
+    if(status != SIM800X_OK)
+        return status;
+    mqttconn = n;
+    mqttkeepalive = keepalive;
+    mqttpingpending = 0;
+    rxstate = MQTT_RX_HEADER;
+    rxpos = 0;
+    //---------
+    p = &txpkt[MQTTFixedHeader(txpkt, MQTT_CONNECT, len)];
+    p = MQTTPutStr(p, "MQTT", 4);
+    *p++ = 4;                                                                   //!< Protocol level 3.1.1
+    *p++ = (uint8_t)(0x02 | (user ? 0x80 : 0) | (pw ? 0x40 : 0));               //!< Clean session, user name and password flags
+    p = MQTTPutU16(p, keepalive);
+    p = MQTTPutStr(p, clientid, idlen);
+    if(user)
+        p = MQTTPutStr(p, user, ulen);
+    if(pw)
+        p = MQTTPutStr(p, pw, plen);
+    mqttstate = MQTT_CONNECTING;
+    status = MQTTSend(txpkt, (uint16_t)(p - txpkt), errcode);
+    if(status != SIM800X_OK)
+    {
+        mqttstate = MQTT_DISCONNECTED;
+        SIM800xTCPIPClose(n, errcode);
+        return status;
+    }
+    //---------
+    while(mqttstate == MQTT_CONNECTING)                                         //!< Updated on CONNACK
+    {
+        if((Tick() - start) >= tout)
+        {
+            status = SIM800X_TIME_OUT;
+            break;
+        }
+        MQTTReceive();
+    }
+    if(mqttstate != MQTT_CONNECTED)
+    {
+        mqttstate = MQTT_DISCONNECTED;
+        SIM800xTCPIPClose(n, errcode);
+        return (status == SIM800X_TIME_OUT) ? status : SIM800X_ERROR;
+    }
+    return SIM800X_OK;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xMQTTPublish(const char* topic, const uint8_t* payload, uint16_t len, uint8_t qos, uint8_t retain, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    SIM800xMQTTInflightType* slot = NULL;
+    uint16_t tlen;
+    uint32_t rlen;
+    uint8_t i, *pkt, *p;
+    //---------
+    if((mqttstate != MQTT_CONNECTED) || !topic || (qos > 1))
+        return SIM800X_ERROR;
+    tlen = (uint16_t)strlen(topic);
+    rlen = 2 + tlen + (qos ? 2 : 0) + len;
+    if((rlen + MQTTFixedHeaderSize(rlen)) > CONFIG_MQTT_PACKET_SIZE)
+        return SIM800X_ERROR;
+    pkt = txpkt;
+    if(qos)
+    {
+        for(i = 0; (i < CONFIG_MQTT_MAX_INFLIGHT) && !slot; i++)
+        {
+            if(!inflight[i].id)
+                slot = &inflight[i];
+        }
+        if(!slot)
+            return SIM800X_BUSY;
+        pkt = slot->pkt;                                                        //!< Built in place, kept for retransmission
+    }
+    //---------
+    p = &pkt[MQTTFixedHeader(pkt, (uint8_t)(MQTT_PUBLISH | (qos << 1) | (retain ? 1 : 0)), rlen)];
+    p = MQTTPutStr(p, topic, tlen);
+    if(qos)
+        p = MQTTPutU16(p, MQTTNextId());
+    if(len)
+        memcpy(p, payload, len);
+    p += len;
+    status = MQTTSend(pkt, (uint16_t)(p - pkt), errcode);
+    if(slot && (status == SIM800X_OK))
+    {
+        slot->id = mqttnextid;
+        slot->len = (uint16_t)(p - pkt);
+        slot->sent = mqttlastsent;
+    }
+    return status;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xMQTTSubscribe(const char* topic, uint8_t qos, uint32_t tout, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    uint16_t tlen;
+    uint32_t rlen;
+    uint8_t* p;
+    //---------
+    if((mqttstate != MQTT_CONNECTED) || !topic || (qos > 1))
+        return SIM800X_ERROR;
+    tlen = (uint16_t)strlen(topic);
+    rlen = 2 + 2 + tlen + 1;
+    if((rlen + MQTTFixedHeaderSize(rlen)) > sizeof(txpkt))
+        return SIM800X_ERROR;
+    p = &txpkt[MQTTFixedHeader(txpkt, MQTT_SUBSCRIBE, rlen)];
+    mqttackid = MQTTNextId();
+    mqttackrc = 0xFF;
+    p = MQTTPutU16(p, mqttackid);
+    p = MQTTPutStr(p, topic, tlen);
+    *p++ = qos;
+    status = MQTTSend(txpkt, (uint16_t)(p - txpkt), errcode);
+    if(status != SIM800X_OK)
+        return status;
+    return MQTTWaitAck(tout);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xMQTTUnsubscribe(const char* topic, uint32_t tout, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    uint16_t tlen;
+    uint32_t rlen;
+    uint8_t* p;
+    //---------
+    if((mqttstate != MQTT_CONNECTED) || !topic)
+        return SIM800X_ERROR;
+    tlen = (uint16_t)strlen(topic);
+    rlen = 2 + 2 + tlen;
+    if((rlen + MQTTFixedHeaderSize(rlen)) > sizeof(txpkt))
+        return SIM800X_ERROR;
+    p = &txpkt[MQTTFixedHeader(txpkt, MQTT_UNSUBSCRIBE, rlen)];
+    mqttackid = MQTTNextId();
+    mqttackrc = 0xFF;
+    p = MQTTPutU16(p, mqttackid);
+    p = MQTTPutStr(p, topic, tlen);
+    status = MQTTSend(txpkt, (uint16_t)(p - txpkt), errcode);
+    if(status != SIM800X_OK)
+        return status;
+    return MQTTWaitAck(tout);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800xMQTTStateType SIM800xMQTTPoll(void)
+{
+    uint16_t errcode;
+    uint8_t i, pkt[2];
+    //---------
+    if(mqttstate == MQTT_DISCONNECTED)
+        return mqttstate;
+    MQTTReceive();
+    if(SIM800xTCPIPGetState(mqttconn) != TCPIP_CONNECTED)
+        MQTTDrop();
+    if(mqttstate != MQTT_CONNECTED)
+        return mqttstate;
+    //---------
+    for(i = 0; i < CONFIG_MQTT_MAX_INFLIGHT; i++)
+    {
+        if(inflight[i].id && ((Tick() - inflight[i].sent) >= CONFIG_MQTT_RETRY_TIME))
+        {
+            inflight[i].pkt[0] |= MQTT_DUP_FLAG;
+            if(MQTTSend(inflight[i].pkt, inflight[i].len, &errcode) != SIM800X_OK)
+                return mqttstate;
+            inflight[i].sent = mqttlastsent;
+        }
+    }
+    //---------
+    if(mqttpingpending)
+    {
+        if((Tick() - mqttpingsent) >= CONFIG_MQTT_RETRY_TIME)                   //!< Broker unreachable
+        {
+            SIM800xTCPIPClose(mqttconn, &errcode);
+            MQTTDrop();
+        }
+    }
+    else if(mqttkeepalive && ((Tick() - mqttlastsent) >= (mqttkeepalive * 1000UL)))
+    {
+        pkt[0] = MQTT_PINGREQ;
+        pkt[1] = 0;
+        if(MQTTSend(pkt, sizeof(pkt), &errcode) == SIM800X_OK)
+        {
+            mqttpingpending = 1;
+            mqttpingsent = mqttlastsent;
+        }
+    }
+    return mqttstate;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+uint8_t SIM800xMQTTInflight(void)
+{
+    uint8_t i, cnt = 0;
+    //---------
+    for(i = 0; i < CONFIG_MQTT_MAX_INFLIGHT; i++)
+    {
+        if(inflight[i].id)
+            cnt++;
+    }
+    return cnt;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xMQTTDisconnect(uint16_t* errcode)
+{
+    uint8_t pkt[2];
+    //---------
+    if(mqttstate != MQTT_DISCONNECTED)
+    {
+        pkt[0] = MQTT_DISCONNECT;
+        pkt[1] = 0;
+        MQTTSend(pkt, sizeof(pkt), errcode);
+    }
+    MQTTDrop();
+    return SIM800xTCPIPClose(mqttconn, errcode);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800xMQTTStateType SIM800xMQTTGetState(void)
+{
+    return mqttstate;
+}
+//-----------------------------------
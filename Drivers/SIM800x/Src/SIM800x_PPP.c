@@ -0,0 +1,951 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_PPP.c
+ * @author          Firmware-Engineers
+ * @brief           SIM800 series modems PPP client (RFC 1661/1662/1332/1334/1994)
+ * @brief           See SIM800x_PPP.h for more details.
+ ******************************************************************************
+ */
+
+//-----------------------------------
+#include "SIM800x_PPP.h"
+#include "SIM800x_SDM.h"
+#include "SIM800x_GPRS.h"
+#include "SIM800x_CRC.h"
+#include <string.h>
+//-----------------------------------
+
+//-----------------------------------
+#define PPP_FLAG                            0x7E                                //!< HDLC frame delimiter
+#define PPP_ESC                             0x7D                                //!< HDLC control escape
+#define PPP_TRANS                           0x20                                //!< HDLC escape XOR mask
+#define PPP_ALLSTATIONS                     0xFF                                //!< HDLC address field
+#define PPP_UI                              0x03                                //!< HDLC control field
+#define PPP_FCS_INIT                        0xFFFF                              //!< Initial FCS value
+#define PPP_FCS_GOOD                        0xF0B8                              //!< Good final FCS value
+
+#define PPP_PROTO_IP                        0x0021                              //!< Internet Protocol
+#define PPP_PROTO_IPCP                      0x8021                              //!< IP Control Protocol
+#define PPP_PROTO_LCP                       0xC021                              //!< Link Control Protocol
+#define PPP_PROTO_PAP                       0xC023                              //!< Password Authentication Protocol
+#define PPP_PROTO_CHAP                      0xC223                              //!< Challenge Handshake Authentication Protocol
+
+#define CP_CONF_REQ                         1                                   //!< Configure-Request
+#define CP_CONF_ACK                         2                                   //!< Configure-Ack
+#define CP_CONF_NAK                         3                                   //!< Configure-Nak
+#define CP_CONF_REJ                         4                                   //!< Configure-Reject
+#define CP_TERM_REQ                         5                                   //!< Terminate-Request
+#define CP_TERM_ACK                         6                                   //!< Terminate-Ack
+#define CP_CODE_REJ                         7                                   //!< Code-Reject
+#define LCP_PROTO_REJ                       8                                   //!< Protocol-Reject
+#define LCP_ECHO_REQ                        9                                   //!< Echo-Request
+#define LCP_ECHO_REP                        10                                  //!< Echo-Reply
+#define LCP_DISCARD_REQ                     11                                  //!< Discard-Request
+
+#define LCP_OPT_MRU                         1                                   //!< Maximum-Receive-Unit
+#define LCP_OPT_ACCM                        2                                   //!< Async-Control-Character-Map
+#define LCP_OPT_AUTH                        3                                   //!< Authentication-Protocol
+#define LCP_OPT_MAGIC                       5                                   //!< Magic-Number
+#define LCP_OPT_PFC                         7                                   //!< Protocol-Field-Compression
+#define LCP_OPT_ACFC                        8                                   //!< Address-and-Control-Field-Compression
+
+#define IPCP_OPT_ADDR                       3                                   //!< IP-Address
+#define IPCP_OPT_DNS1                       129                                 //!< Primary DNS server address
+#define IPCP_OPT_DNS2                       131                                 //!< Secondary DNS server address
+
+#define PAP_AUTH_REQ                        1                                   //!< Authenticate-Request
+#define PAP_AUTH_ACK                        2                                   //!< Authenticate-Ack
+#define PAP_AUTH_NAK                        3                                   //!< Authenticate-Nak
+
+#define CHAP_CHALLENGE                      1                                   //!< Challenge
+#define CHAP_RESPONSE                       2                                   //!< Response
+#define CHAP_SUCCESS                        3                                   //!< Success
+#define CHAP_FAILURE                        4                                   //!< Failure
+#define CHAP_MD5                            5                                   //!< MD5 algorithm
+
+#define PPP_OPT_BIT(x)                      (((x) < 16) ? (1UL << (x)) : (((x) >= 128) && ((x) < 144)) ? (1UL << ((x) - 112)) : 0UL)  //!< Requested option mask bit: options 0-15, and 128-143 (DNS) on bits 16-31
+#define PPP_HDR_SIZE                        4                                   //!< Control packet header size (code, id, length)
+//-----------------------------------
+
+/**
+  * @brief  Control protocol (LCP/IPCP/PAP) negotiation state
+  */
+typedef struct
+{
+    //---------
+    uint8_t     id;                                                             //!< Identifier of the last request sent
+    uint8_t     ackRcvd;                                                        //!< Our request has been acknowledged
+    uint8_t     ackSent;                                                        //!< The peer request has been acknowledged
+    uint8_t     retries;                                                        //!< Number of requests sent
+    uint32_t    opts;                                                           //!< Options still being requested
+    uint32_t    timer;                                                          //!< Tick of the last request
+    //---------
+}SIM800xPPPCPType;
+//-----------------------------------
+
+//-----------------------------------
+static const uint16_t PPPFcsTable[256] =
+{
+    0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF,
+    0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7,
+    0x1081, 0x0108, 0x3393, 0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E,
+    0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876,
+    0x2102, 0x308B, 0x0210, 0x1399, 0x6726, 0x76AF, 0x4434, 0x55BD,
+    0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5,
+    0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C,
+    0xBDCB, 0xAC42, 0x9ED9, 0x8F50, 0xFBEF, 0xEA66, 0xD8FD, 0xC974,
+    0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB,
+    0xCE4C, 0xDFC5, 0xED5E, 0xFCD7, 0x8868, 0x99E1, 0xAB7A, 0xBAF3,
+    0x5285, 0x430C, 0x7197, 0x601E, 0x14A1, 0x0528, 0x37B3, 0x263A,
+    0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB, 0xAA72,
+    0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9,
+    0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5, 0xA96A, 0xB8E3, 0x8A78, 0x9BF1,
+    0x7387, 0x620E, 0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738,
+    0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70,
+    0x8408, 0x9581, 0xA71A, 0xB693, 0xC22C, 0xD3A5, 0xE13E, 0xF0B7,
+    0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF,
+    0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036,
+    0x18C1, 0x0948, 0x3BD3, 0x2A5A, 0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E,
+    0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5,
+    0x2942, 0x38CB, 0x0A50, 0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD,
+    0xB58B, 0xA402, 0x9699, 0x8710, 0xF3AF, 0xE226, 0xD0BD, 0xC134,
+    0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E, 0x5CF5, 0x4D7C,
+    0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3,
+    0x4A44, 0x5BCD, 0x6956, 0x78DF, 0x0C60, 0x1DE9, 0x2F72, 0x3EFB,
+    0xD68D, 0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232,
+    0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A,
+    0xE70E, 0xF687, 0xC41C, 0xD595, 0xA12A, 0xB0A3, 0x8238, 0x93B1,
+    0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9,
+    0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9, 0x8330,
+    0x7BC7, 0x6A4E, 0x58D5, 0x495C, 0x3DE3, 0x2C6A, 0x1EF1, 0x0F78
+};
+//-----------------------------------
+
+//-----------------------------------
+static SIM800xPPPPhaseType phase = PPP_DEAD;
+static SIM800xPPPInputCallBack inputcb = NULL;
+static SIM800xPPPCPType lcp, ipcp, auth;
+static uint16_t authproto = 0;                                                  //!< Authentication protocol acknowledged to the peer
+static uint8_t authdone = 0;
+static uint8_t failed = 0;
+static uint8_t rejid = 0;                                                       //!< Identifier of the last Code-Reject or Protocol-Reject sent
+static const char* authuser = NULL;
+static const char* authpw = NULL;
+static uint32_t magic = 0;
+static uint32_t txaccm = 0xFFFFFFFFUL;                                          //!< Control characters the peer wants escaped
+static uint16_t peermru = 1500;
+static uint8_t peerpfc = 0, peeracfc = 0;
+static uint8_t ipaddr[4], dnsaddr1[4], dnsaddr2[4];
+//-----------------------------------
+static uint8_t rxbuf[CONFIG_PPP_MRU + 8];                                       //!< Address, control, protocol, information and FCS
+static uint16_t rxlen = 0;
+static uint16_t rxfcs = PPP_FCS_INIT;
+static uint8_t rxesc = 0, rxdrop = 0;
+//-----------------------------------
+static uint8_t txbuf[32];
+static uint8_t txcnt = 0;
+static uint16_t txfcs = PPP_FCS_INIT;
+//-----------------------------------
+
+//-----------------------------------
+static void PPPTxFlush(void)
+{
+    if(txcnt)
+    {
+        SIM800xSDMSendBytes(txbuf, txcnt);
+        txcnt = 0;
+    }
+}
+//-----------------------------------
+
+//-----------------------------------
+static void PPPTxRaw(uint8_t b)
+{
+    txbuf[txcnt++] = b;
+    if(txcnt == sizeof(txbuf))
+        PPPTxFlush();
+}
+//-----------------------------------
+
+//-----------------------------------
+static void PPPTxEscaped(uint8_t b, uint32_t accm)
+{
+    if((b == PPP_FLAG) || (b == PPP_ESC) || ((b < 0x20) && (accm & (1UL << b))))
+    {
+        PPPTxRaw(PPP_ESC);
+        PPPTxRaw(b ^ PPP_TRANS);
+    }else
+    {
+        PPPTxRaw(b);
+    }
+}
+//-----------------------------------
+
+//-----------------------------------
+static void PPPTxByte(uint8_t b, uint32_t accm)
+{
+    txfcs = (txfcs >> 8) ^ PPPFcsTable[(txfcs ^ b) & 0xFF];
+    PPPTxEscaped(b, accm);
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Start a frame. LCP frames are always sent uncompressed, with every
+ *          control character escaped (RFC 1662, section 7.1).
+ */
+static uint32_t PPPTxBegin(uint16_t proto)
+{
+    uint32_t accm = (proto == PPP_PROTO_LCP) ? 0xFFFFFFFFUL : txaccm;
+    //---------
+    txcnt = 0;
+    txfcs = PPP_FCS_INIT;
+    PPPTxRaw(PPP_FLAG);
+    if((proto == PPP_PROTO_LCP) || !peeracfc)
+    {
+        PPPTxByte(PPP_ALLSTATIONS, accm);
+        PPPTxByte(PPP_UI, accm);
+    }
+    if((proto == PPP_PROTO_LCP) || !peerpfc || (proto > 0xFF))
+        PPPTxByte((uint8_t)(proto >> 8), accm);
+    PPPTxByte((uint8_t)proto, accm);
+    return accm;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static void PPPTxEnd(uint32_t accm)
+{
+    uint16_t fcs = ~txfcs;
+    //---------
+    PPPTxEscaped((uint8_t)fcs, accm);
+    PPPTxEscaped((uint8_t)(fcs >> 8), accm);
+    PPPTxRaw(PPP_FLAG);
+    PPPTxFlush();
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Send a control packet made of a header and up to two data segments
+ */
+static void PPPSendCP(uint16_t proto, uint8_t code, uint8_t id, const uint8_t* d1, uint16_t l1, const uint8_t* d2, uint16_t l2)
+{
+    uint16_t len = PPP_HDR_SIZE + l1 + l2;
+    uint32_t accm = PPPTxBegin(proto);
+    //---------
+    PPPTxByte(code, accm);
+    PPPTxByte(id, accm);
+    PPPTxByte((uint8_t)(len >> 8), accm);
+    PPPTxByte((uint8_t)len, accm);
+    while(l1--)
+        PPPTxByte(*d1++, accm);
+    while(l2--)
+        PPPTxByte(*d2++, accm);
+    PPPTxEnd(accm);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static void PPPPut32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+//-----------------------------------
+
+//-----------------------------------
+static uint32_t PPPGet32(const uint8_t* p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+//-----------------------------------
+
+//-----------------------------------
+static void PPPLcpSendRequest(void)
+{
+    uint8_t opts[12], n = 0;
+    //---------
+    if(lcp.opts & PPP_OPT_BIT(LCP_OPT_ACCM))
+    {
+        opts[n++] = LCP_OPT_ACCM;                                               //!< No control character escaping needed on the downlink
+        opts[n++] = 6;
+        PPPPut32(&opts[n], 0);
+        n += 4;
+    }
+    if(lcp.opts & PPP_OPT_BIT(LCP_OPT_MAGIC))
+    {
+        opts[n++] = LCP_OPT_MAGIC;
+        opts[n++] = 6;
+        PPPPut32(&opts[n], magic);
+        n += 4;
+    }
+    lcp.id++;
+    lcp.retries++;
+    lcp.timer = Tick();
+    PPPSendCP(PPP_PROTO_LCP, CP_CONF_REQ, lcp.id, opts, n, NULL, 0);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static void PPPIpcpSendRequest(void)
+{
+    uint8_t opts[18], n = 0;
+    //---------
+    if(ipcp.opts & PPP_OPT_BIT(IPCP_OPT_ADDR))
+    {
+        opts[n++] = IPCP_OPT_ADDR;
+        opts[n++] = 6;
+        memcpy(&opts[n], ipaddr, 4);
+        n += 4;
+    }
+    if(ipcp.opts & PPP_OPT_BIT(IPCP_OPT_DNS1))
+    {
+        opts[n++] = IPCP_OPT_DNS1;
+        opts[n++] = 6;
+        memcpy(&opts[n], dnsaddr1, 4);
+        n += 4;
+    }
+    if(ipcp.opts & PPP_OPT_BIT(IPCP_OPT_DNS2))
+    {
+        opts[n++] = IPCP_OPT_DNS2;
+        opts[n++] = 6;
+        memcpy(&opts[n], dnsaddr2, 4);
+        n += 4;
+    }
+    ipcp.id++;
+    ipcp.retries++;
+    ipcp.timer = Tick();
+    PPPSendCP(PPP_PROTO_IPCP, CP_CONF_REQ, ipcp.id, opts, n, NULL, 0);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static void PPPPapSendRequest(void)
+{
+    uint8_t ulen = (uint8_t)(authuser ? strlen(authuser) : 0);
+    uint8_t plen = (uint8_t)(authpw ? strlen(authpw) : 0);
+    uint16_t len = PPP_HDR_SIZE + 2 + ulen + plen;
+    uint32_t accm;
+    uint8_t i;
+    //---------
+    auth.id++;
+    auth.retries++;
+    auth.timer = Tick();
+    accm = PPPTxBegin(PPP_PROTO_PAP);
+    PPPTxByte(PAP_AUTH_REQ, accm);
+    PPPTxByte(auth.id, accm);
+    PPPTxByte((uint8_t)(len >> 8), accm);
+    PPPTxByte((uint8_t)len, accm);
+    PPPTxByte(ulen, accm);
+    for(i = 0; i < ulen; i++)
+        PPPTxByte((uint8_t)authuser[i], accm);
+    PPPTxByte(plen, accm);
+    for(i = 0; i < plen; i++)
+        PPPTxByte((uint8_t)authpw[i], accm);
+    PPPTxEnd(accm);
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static void PPPEnterNetworkPhase(void)
+{
+    phase = PPP_NETWORK;
+    memset(&ipcp, 0, sizeof(ipcp));
+    ipcp.opts = PPP_OPT_BIT(IPCP_OPT_ADDR) | PPP_OPT_BIT(IPCP_OPT_DNS1) | PPP_OPT_BIT(IPCP_OPT_DNS2);
+    memset(ipaddr, 0, 4);
+    memset(dnsaddr1, 0, 4);
+    memset(dnsaddr2, 0, 4);
+    PPPIpcpSendRequest();
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Move to the next phase once both directions of a negotiation are done
+ */
+static void PPPUpdatePhase(void)
+{
+    if((phase == PPP_ESTABLISH) && lcp.ackRcvd && lcp.ackSent)
+    {
+        memset(&auth, 0, sizeof(auth));
+        authdone = 0;
+        if(authproto == PPP_PROTO_PAP)
+        {
+            phase = PPP_AUTHENTICATE;
+            PPPPapSendRequest();
+        }else if(authproto == PPP_PROTO_CHAP)
+        {
+            phase = PPP_AUTHENTICATE;                                           //!< Wait for the peer challenge
+            auth.timer = Tick();
+        }else
+        {
+            PPPEnterNetworkPhase();
+        }
+    }
+    if((phase == PPP_AUTHENTICATE) && authdone)
+        PPPEnterNetworkPhase();
+    if((phase == PPP_NETWORK) && ipcp.ackRcvd && ipcp.ackSent)
+        phase = PPP_RUNNING;
+}
+//-----------------------------------
+
+//-----------------------------------
+static void PPPRestartLcp(void)
+{
+    phase = PPP_ESTABLISH;
+    lcp.ackRcvd = 0;
+    lcp.ackSent = 0;
+    lcp.retries = 0;
+    lcp.opts = PPP_OPT_BIT(LCP_OPT_ACCM) | PPP_OPT_BIT(LCP_OPT_MAGIC);
+    txaccm = 0xFFFFFFFFUL;
+    peerpfc = 0;
+    peeracfc = 0;
+    authproto = 0;
+    PPPLcpSendRequest();
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Answer the peer LCP configure request. Rejected options are compacted
+ *          in place, at the start of the option list.
+ */
+static void PPPLcpConfRequest(uint8_t id, uint8_t* opts, uint16_t len)
+{
+    static const uint8_t nakpap[4] = {LCP_OPT_AUTH, 4, (uint8_t)(PPP_PROTO_PAP >> 8), (uint8_t)PPP_PROTO_PAP};
+    uint16_t i, rej = 0, proto = 0;
+    uint8_t nak = 0, olen;
+    //---------
+    if(phase == PPP_TERMINATE)
+        return;
+    if(phase != PPP_ESTABLISH)
+        PPPRestartLcp();                                                        //!< Peer renegotiating the link
+    for(i = 0; i < len; i += olen)
+    {
+        olen = ((len - i) >= 2) ? opts[i + 1] : 0;
+        if((olen < 2) || (olen > (len - i)))
+            return;
+        switch(opts[i])
+        {
+            case LCP_OPT_MRU:
+            case LCP_OPT_ACCM:
+            case LCP_OPT_MAGIC:
+                if(olen != ((opts[i] == LCP_OPT_MRU) ? 4 : 6))
+                    break;
+                continue;
+            case LCP_OPT_PFC:
+            case LCP_OPT_ACFC:
+                if(olen != 2)
+                    break;
+                continue;
+            case LCP_OPT_AUTH:
+                if(olen < 4)
+                    break;
+                proto = (uint16_t)((opts[i + 2] << 8) | opts[i + 3]);
+                if(!((proto == PPP_PROTO_PAP) && (olen == 4)) &&
+                   !((proto == PPP_PROTO_CHAP) && (olen == 5) && (opts[i + 4] == CHAP_MD5)))
+                    nak = 1;
+                continue;
+            default:
+                break;
+        }
+        memmove(&opts[rej], &opts[i], olen);
+        rej += olen;
+    }
+    //---------
+    if(rej)
+    {
+        PPPSendCP(PPP_PROTO_LCP, CP_CONF_REJ, id, opts, rej, NULL, 0);
+        return;
+    }
+    if(nak)
+    {
+        PPPSendCP(PPP_PROTO_LCP, CP_CONF_NAK, id, nakpap, sizeof(nakpap), NULL, 0);
+        return;
+    }
+    //---------
+    authproto = 0;
+    for(i = 0; i < len; i += opts[i + 1])
+    {
+        switch(opts[i])
+        {
+            case LCP_OPT_MRU:   peermru = (uint16_t)((opts[i + 2] << 8) | opts[i + 3]); break;
+            case LCP_OPT_ACCM:  txaccm = PPPGet32(&opts[i + 2]); break;
+            case LCP_OPT_AUTH:  authproto = (uint16_t)((opts[i + 2] << 8) | opts[i + 3]); break;
+            case LCP_OPT_PFC:   peerpfc = 1; break;
+            case LCP_OPT_ACFC:  peeracfc = 1; break;
+            default:            break;
+        }
+    }
+    if(peermru > CONFIG_PPP_MRU)
+        peermru = CONFIG_PPP_MRU;
+    PPPSendCP(PPP_PROTO_LCP, CP_CONF_ACK, id, opts, len, NULL, 0);
+    lcp.ackSent = 1;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static void PPPLcpInput(uint8_t* pkt, uint16_t len)
+{
+    uint8_t code = pkt[0], id = pkt[1];
+    uint8_t* data = &pkt[PPP_HDR_SIZE];
+    uint16_t i, dlen = len - PPP_HDR_SIZE;
+    //---------
+    switch(code)
+    {
+        case CP_CONF_REQ:
+            PPPLcpConfRequest(id, data, dlen);
+            break;
+        case CP_CONF_ACK:
+            if((phase == PPP_ESTABLISH) && (id == lcp.id))
+                lcp.ackRcvd = 1;
+            break;
+        case CP_CONF_NAK:
+        case CP_CONF_REJ:
+            if((phase != PPP_ESTABLISH) || (id != lcp.id))
+                break;
+            for(i = 0; (i + 1) < dlen && data[i + 1] >= 2; i += data[i + 1])
+            {
+                if((code == CP_CONF_NAK) && (data[i] == LCP_OPT_MAGIC))
+                    magic = magic * 1103515245UL + 12345UL;                     //!< Magic number clash, pick a new one
+                else
+                    lcp.opts &= ~PPP_OPT_BIT(data[i]);
+            }
+            PPPLcpSendRequest();
+            break;
+        case CP_TERM_REQ:
+            PPPSendCP(PPP_PROTO_LCP, CP_TERM_ACK, id, NULL, 0, NULL, 0);
+            phase = PPP_DEAD;
+            break;
+        case CP_TERM_ACK:
+            if(phase == PPP_TERMINATE)
+                phase = PPP_DEAD;
+            break;
+        case LCP_ECHO_REQ:
+            if((phase >= PPP_AUTHENTICATE) && (dlen >= 4))
+            {
+                PPPPut32(data, magic);
+                PPPSendCP(PPP_PROTO_LCP, LCP_ECHO_REP, id, data, dlen, NULL, 0);
+            }
+            break;
+        case LCP_PROTO_REJ:
+            if((dlen >= 2) && (((data[0] << 8) | data[1]) == PPP_PROTO_IPCP))
+                failed = 1;
+            break;
+        case CP_CODE_REJ:
+        case LCP_ECHO_REP:
+        case LCP_DISCARD_REQ:
+            break;
+        default:
+            PPPSendCP(PPP_PROTO_LCP, CP_CODE_REJ, ++rejid, pkt, (len > (peermru - PPP_HDR_SIZE)) ? (peermru - PPP_HDR_SIZE) : len, NULL, 0);
+            break;
+    }
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static void PPPIpcpInput(uint8_t* pkt, uint16_t len)
+{
+    uint8_t code = pkt[0], id = pkt[1];
+    uint8_t* data = &pkt[PPP_HDR_SIZE];
+    uint16_t i, rej = 0, dlen = len - PPP_HDR_SIZE;
+    uint8_t olen;
+    //---------
+    if(phase < PPP_NETWORK)
+        return;
+    switch(code)
+    {
+        case CP_CONF_REQ:
+            for(i = 0; i < dlen; i += olen)
+            {
+                olen = ((dlen - i) >= 2) ? data[i + 1] : 0;
+                if((olen < 2) || (olen > (dlen - i)))
+                    return;
+                if((data[i] == IPCP_OPT_ADDR) && (olen == 6))
+                    continue;                                                   //!< Peer address, accepted as is
+                memmove(&data[rej], &data[i], olen);
+                rej += olen;
+            }
+            if(rej)
+            {
+                PPPSendCP(PPP_PROTO_IPCP, CP_CONF_REJ, id, data, rej, NULL, 0);
+            }else
+            {
+                PPPSendCP(PPP_PROTO_IPCP, CP_CONF_ACK, id, data, dlen, NULL, 0);
+                ipcp.ackSent = 1;
+            }
+            break;
+        case CP_CONF_ACK:
+            if(id == ipcp.id)
+                ipcp.ackRcvd = 1;
+            break;
+        case CP_CONF_NAK:
+        case CP_CONF_REJ:
+            if(id != ipcp.id)
+                break;
+            for(i = 0; (i + 1) < dlen && data[i + 1] >= 2; i += data[i + 1])
+            {
+                if(code == CP_CONF_REJ)
+                {
+                    if(data[i] == IPCP_OPT_ADDR)
+                        failed = 1;                                             //!< No address, no IP link
+                    ipcp.opts &= ~PPP_OPT_BIT(data[i]);
+                }else if(data[i + 1] == 6)
+                {
+                    if(data[i] == IPCP_OPT_ADDR)        memcpy(ipaddr, &data[i + 2], 4);
+                    else if(data[i] == IPCP_OPT_DNS1)   memcpy(dnsaddr1, &data[i + 2], 4);
+                    else if(data[i] == IPCP_OPT_DNS2)   memcpy(dnsaddr2, &data[i + 2], 4);
+                }
+            }
+            ipcp.retries = 0;
+            PPPIpcpSendRequest();
+            break;
+        case CP_TERM_REQ:
+            PPPSendCP(PPP_PROTO_IPCP, CP_TERM_ACK, id, NULL, 0, NULL, 0);
+            ipcp.ackRcvd = 0;
+            ipcp.ackSent = 0;
+            if(phase == PPP_RUNNING)
+                phase = PPP_NETWORK;
+            break;
+        default:
+            break;
+    }
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static void PPPPapInput(uint8_t* pkt, uint16_t len)
+{
+    if((phase != PPP_AUTHENTICATE) || (authproto != PPP_PROTO_PAP) || (pkt[1] != auth.id))
+        return;
+    if(pkt[0] == PAP_AUTH_ACK)
+        authdone = 1;
+    else if(pkt[0] == PAP_AUTH_NAK)
+        failed = 1;
+}
+//-----------------------------------
+
+//-----------------------------------
+static void PPPChapInput(uint8_t* pkt, uint16_t len)
+{
+    SIM800xMD5Type md5;
+    uint8_t resp[17];
+    uint8_t vlen;
+    //---------
+    if((phase != PPP_AUTHENTICATE) || (authproto != PPP_PROTO_CHAP))
+        return;
+    switch(pkt[0])
+    {
+        case CHAP_CHALLENGE:
+            vlen = (len > PPP_HDR_SIZE) ? pkt[PPP_HDR_SIZE] : 0;
+            if(!vlen || ((PPP_HDR_SIZE + 1 + vlen) > len))
+                return;
+            SIM800xMD5Init(&md5);
+            SIM800xMD5Update(&md5, &pkt[1], 1);
+            if(authpw)
+                SIM800xMD5Update(&md5, (const uint8_t*)authpw, strlen(authpw));
+            SIM800xMD5Update(&md5, &pkt[PPP_HDR_SIZE + 1], vlen);
+            resp[0] = 16;
+            SIM800xMD5Final(&md5, &resp[1]);
+            auth.id = pkt[1];
+            auth.timer = Tick();
+            PPPSendCP(PPP_PROTO_CHAP, CHAP_RESPONSE, pkt[1], resp, sizeof(resp),
+                      (const uint8_t*)authuser, (uint16_t)(authuser ? strlen(authuser) : 0));
+            break;
+        case CHAP_SUCCESS:
+            authdone = 1;
+            break;
+        case CHAP_FAILURE:
+            failed = 1;
+            break;
+        default:
+            break;
+    }
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Dispatch a received frame (FCS removed). Address/control and protocol
+ *          fields are accepted both compressed and uncompressed.
+ */
+static void PPPInput(uint8_t* frame, uint16_t len)
+{
+    uint16_t proto, i = 0, plen;
+    //---------
+    if((len >= 2) && (frame[0] == PPP_ALLSTATIONS) && (frame[1] == PPP_UI))
+        i = 2;
+    if(i >= len)
+        return;
+    proto = frame[i++];
+    if(!(proto & 0x01))
+    {
+        if(i >= len)
+            return;
+        proto = (uint16_t)((proto << 8) | frame[i++]);
+    }
+    frame += i;
+    len -= i;
+    //---------
+    if(proto == PPP_PROTO_IP)
+    {
+        if((phase == PPP_RUNNING) && inputcb)
+            inputcb(frame, len);
+        return;
+    }
+    if(len < PPP_HDR_SIZE)
+        return;
+    plen = (uint16_t)((frame[2] << 8) | frame[3]);
+    if((plen < PPP_HDR_SIZE) || (plen > len))
+        return;
+    //---------
+    switch(proto)
+    {
+        case PPP_PROTO_LCP:     PPPLcpInput(frame, plen); break;
+        case PPP_PROTO_IPCP:    PPPIpcpInput(frame, plen); break;
+        case PPP_PROTO_PAP:     PPPPapInput(frame, plen); break;
+        case PPP_PROTO_CHAP:    PPPChapInput(frame, plen); break;
+        default:
+            if(phase > PPP_ESTABLISH)                                           //!< ex. IPv6CP or CCP, not supported
+            {
+                uint8_t p[2] = {(uint8_t)(proto >> 8), (uint8_t)proto};
+                PPPSendCP(PPP_PROTO_LCP, LCP_PROTO_REJ, ++rejid, p, 2, frame,
+                          (len > (peermru - PPP_HDR_SIZE - 2)) ? (peermru - PPP_HDR_SIZE - 2) : len);
+            }
+            break;
+    }
+    PPPUpdatePhase();
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Retransmit unacknowledged requests, give up after CONFIG_PPP_MAX_CONFIGURE attempts
+ */
+static void PPPTimers(void)
+{
+    SIM800xPPPCPType* cp = NULL;
+    //---------
+    if(phase == PPP_ESTABLISH && !lcp.ackRcvd)
+        cp = &lcp;
+    else if(phase == PPP_AUTHENTICATE && !authdone)
+        cp = &auth;
+    else if(phase == PPP_NETWORK && !ipcp.ackRcvd)
+        cp = &ipcp;
+    if(!cp || ((Tick() - cp->timer) < CONFIG_PPP_RESTART_TIME))
+        return;
+    //---------
+    if(cp->retries >= CONFIG_PPP_MAX_CONFIGURE)
+    {
+        failed = 1;
+        return;
+    }
+    if(cp == &lcp)
+        PPPLcpSendRequest();
+    else if(cp == &ipcp)
+        PPPIpcpSendRequest();
+    else if(authproto == PPP_PROTO_PAP)
+        PPPPapSendRequest();
+    else
+    {
+        auth.retries++;                                                         //!< CHAP: the peer drives retransmissions
+        auth.timer = Tick();
+    }
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Leave data mode and hang up the call
+ */
+static void PPPHangUp(void)
+{
+    wait(1100);                                                                 //!< Escape sequence guard time
+    SIM800xSDMPrint("+++");
+    wait(1100);
+    SIM800xSDMPrint("ATH\r\n");
+    wait(500);
+    SIM800xSDMFlush();
+    phase = PPP_DEAD;
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xPPPSetInputCallBack(SIM800xPPPInputCallBack cb)
+{
+    inputcb = cb;
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xPPPOpen(uint8_t cid, const char* user, const char* pw, uint32_t tout, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    uint32_t start;
+    //---------
+    status = SIM800xGPRSSetDataMode(cid, errcode);
+    if(status != SIM800X_OK)
+        return status;
+    //---------
+    authuser = user;
+    authpw = pw;
+    failed = 0;
+    rxlen = 0;
+    rxfcs = PPP_FCS_INIT;
+    rxesc = 0;
+    rxdrop = 0;
+    peermru = CONFIG_PPP_MRU;
+    magic ^= Tick() * 2654435761UL;
+    if(!magic)
+        magic = 0x5A5A0001UL;
+    memset(&lcp, 0, sizeof(lcp));
+    memset(&ipcp, 0, sizeof(ipcp));
+    PPPRestartLcp();
+    //---------
+    status = SIM800X_TIME_OUT;
+    start = Tick();
+    while((Tick() - start) < tout)
+    {
+        if(SIM800xPPPPoll() == PPP_RUNNING)
+        {
+            status = SIM800X_OK;
+            break;
+        }
+        if(failed || (phase == PPP_DEAD))
+        {
+            status = SIM800X_ERROR;
+            break;
+        }
+    }
+    authuser = NULL;
+    authpw = NULL;
+    if(status != SIM800X_OK)
+        PPPHangUp();
+    return status;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800xPPPPhaseType SIM800xPPPPoll(void)
+{
+    uint8_t c;
+    //---------
+    if(phase == PPP_DEAD)
+        return phase;
+    while(SIM800xSDMRxAvailable())
+    {
+        c = SIM800xSDMReadByte();
+        if(c == PPP_FLAG)
+        {
+            if(!rxdrop && (rxlen > 2) && (rxfcs == PPP_FCS_GOOD))
+                PPPInput(rxbuf, rxlen - 2);
+            rxlen = 0;
+            rxfcs = PPP_FCS_INIT;
+            rxesc = 0;
+            rxdrop = 0;
+            continue;
+        }
+        if(c == PPP_ESC)
+        {
+            rxesc = 1;
+            continue;
+        }
+        if(rxesc)
+        {
+            c ^= PPP_TRANS;
+            rxesc = 0;
+        }
+        if(rxlen < sizeof(rxbuf))
+        {
+            rxbuf[rxlen++] = c;
+            rxfcs = (rxfcs >> 8) ^ PPPFcsTable[(rxfcs ^ c) & 0xFF];
+        }else
+        {
+            rxdrop = 1;                                                         //!< Frame larger than the MRU
+        }
+    }
+    PPPTimers();
+    return phase;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xPPPSend(const uint8_t* pkt, uint16_t len)
+{
+    uint32_t accm;
+    //---------
+    if((phase != PPP_RUNNING) || !len || (len > peermru))
+        return SIM800X_ERROR;
+    accm = PPPTxBegin(PPP_PROTO_IP);
+    while(len--)
+        PPPTxByte(*pkt++, accm);
+    PPPTxEnd(accm);
+    return SIM800X_OK;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xPPPClose(void)
+{
+    SIM800x_APIStatusType status = SIM800X_OK;
+    uint32_t start;
+    //---------
+    if(phase != PPP_DEAD)
+    {
+        phase = PPP_TERMINATE;
+        PPPSendCP(PPP_PROTO_LCP, CP_TERM_REQ, ++lcp.id, NULL, 0, NULL, 0);
+        start = Tick();
+        while(SIM800xPPPPoll() != PPP_DEAD)
+        {
+            if((Tick() - start) >= CONFIG_PPP_RESTART_TIME)
+            {
+                status = SIM800X_TIME_OUT;
+                break;
+            }
+        }
+    }
+    PPPHangUp();
+    return status;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800xPPPPhaseType SIM800xPPPGetPhase(void)
+{
+    return phase;
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xPPPGetAddress(uint8_t* ip, uint8_t* dns1, uint8_t* dns2)
+{
+    if(phase != PPP_RUNNING)
+        return SIM800X_ERROR;
+    if(ip)
+        memcpy(ip, ipaddr, 4);
+    if(dns1)
+        memcpy(dns1, dnsaddr1, 4);
+    if(dns2)
+        memcpy(dns2, dnsaddr2, 4);
+    return SIM800X_OK;
+}
+//-----------------------------------
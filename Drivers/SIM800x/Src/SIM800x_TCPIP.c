@@ -0,0 +1,548 @@
+/**
+ ******************************************************************************
+ * @file            SIM800x_TCPIP.c
+ * @author          Firmware-Engineers
+ * @brief           SIM800 series modems TCP/IP application toolkit (AT+CIPMUX=1)
+ * @brief           See SIM800x_TCPIP.h for more details.
+ ******************************************************************************
+ */
+
+//-----------------------------------
+#include "SIM800x_TCPIP.h"
+#include "SIM800x_AT.h"
+#include "SIM800x_SDM.h"
+#include <string.h>
+#include <stdlib.h>
+//-----------------------------------
+
+//-----------------------------------
+#define TCPIP_HOST_MAX_SIZE                 64                                  //!< Maximum remote host name length
+#define TCPIP_CMD_TIME_OUT                  2000                                //!< Command response time-out, in milliseconds
+#define TCPIP_UDP_MAX_SIZE                  1460                                //!< Largest datagram returned by AT+CIPRXGET=2
+#define TCPIP_CIICR_TIME_OUT                85000                               //!< Wireless connection bring-up time-out, in milliseconds
+#define TCPIP_CIPSHUT_TIME_OUT              65000                               //!< Wireless connection shut down time-out, in milliseconds
+//-----------------------------------
+
+/**
+  * @brief  TCP/IP connection descriptor
+  */
+typedef struct
+{
+    //---------
+    SIM800xTCPIPStateType   state;
+    SIM800xTCPIPModeType    mode;
+    uint8_t*                rxbuf;                                              //!< Caller receive buffer, used as a FIFO (UDP: datagrams prefixed by their 16-bit length)
+    uint16_t                rxsize;
+    uint16_t                rxhead;                                             //!< Write index
+    uint16_t                rxtail;                                             //!< Read index
+    uint16_t                rxcount;
+    uint8_t                 rxpending;                                          //!< Data waiting in the modem buffer (manual receive mode)
+    //---------
+}SIM800xTCPIPConnType;
+//-----------------------------------
+
+//-----------------------------------
+static SIM800xTCPIPConnType conns[CONFIG_TCPIP_MAX_CONNECTIONS];
+//-----------------------------------
+
+//-----------------------------------
+/**
+ * @brief   Get the connection number of a "<n>, <event>" line
+ * @retval  connection number, or -1 if the line does not match
+ */
+static int TCPIPEventId(const char* line, const char* event)
+{
+    if((line[0] < '0') || (line[0] >= ('0' + CONFIG_TCPIP_MAX_CONNECTIONS)) || (line[1] != ',') || (line[2] != ' '))
+        return -1;
+    if(event && strcmp(&line[3], event))
+        return -1;
+    return line[0] - '0';
+}
+//-----------------------------------
+
+//-----------------------------------
+static void TCPIPPut(SIM800xTCPIPConnType* conn, uint8_t data)
+{
+    conn->rxbuf[conn->rxhead] = data;
+    conn->rxhead = (uint16_t)((conn->rxhead + 1) % conn->rxsize);
+    conn->rxcount++;
+}
+//-----------------------------------
+
+#if !CONFIG_TCPIP_MANUAL_RECEIVE
+//-----------------------------------
+static uint8_t TCPIPGet(SIM800xTCPIPConnType* conn)
+{
+    uint8_t data = conn->rxbuf[conn->rxtail];
+    //---------
+    conn->rxtail = (uint16_t)((conn->rxtail + 1) % conn->rxsize);
+    conn->rxcount--;
+    return data;
+    //---------
+}
+//-----------------------------------
+#endif
+
+//-----------------------------------
+/**
+ * @brief   Move "cnt" payload bytes from the SDM receive FIFO to a connection receive buffer
+ */
+static void TCPIPReceive(SIM800xTCPIPConnType* conn, uint16_t cnt)
+{
+    uint16_t chunk, got, keep, space;
+    uint32_t tout = 1000 + cnt;                                                 //!< ~1ms per byte at 9600bps
+    uint8_t discard;
+    //---------
+    space = conn->rxbuf ? (uint16_t)(conn->rxsize - conn->rxcount) : 0;
+    if(conn->mode == TCPIP_UDP)
+    {
+        keep = (space >= ((uint32_t)cnt + 2)) ? cnt : 0;                       //!< Datagrams are kept whole, or dropped
+        if(keep)
+        {
+            TCPIPPut(conn, (uint8_t)(cnt >> 8));
+            TCPIPPut(conn, (uint8_t)cnt);
+        }
+    }
+    else
+        keep = (cnt > space) ? space : cnt;
+    cnt -= keep;
+    //---------
+    while(keep)
+    {
+        chunk = conn->rxsize - conn->rxhead;                                    //!< Contiguous space up to the buffer end
+        if(chunk > keep)
+            chunk = keep;
+        got = SIM800xSDMReadBytes(&conn->rxbuf[conn->rxhead], chunk, tout);
+        conn->rxhead = (uint16_t)((conn->rxhead + got) % conn->rxsize);
+        conn->rxcount += got;
+        keep -= got;
+        if(got < chunk)
+        {
+            while((conn->mode == TCPIP_UDP) && keep--)                          //!< Keep the datagram length consistent
+                TCPIPPut(conn, 0);
+            return;
+        }
+    }
+    while(cnt--)
+    {
+        if(!SIM800xSDMReadBytes(&discard, 1, tout))                             //!< No room left, data dropped
+            return;
+    }
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static uint8_t TCPIPURC(const char* line)
+{
+    char* end;
+    uint8_t i;
+    int n;
+    uint16_t cnt;
+    //---------
+    if(!strncmp(line, "+RECEIVE,", 9))
+    {
+        n = (int)strtoul(&line[9], &end, 10);
+        if((*end != ',') || (n >= CONFIG_TCPIP_MAX_CONNECTIONS))
+            return 0;
+        cnt = (uint16_t)strtoul(end + 1, NULL, 10);
+        TCPIPReceive(&conns[n], cnt);
+        return 1;
+    }
+    if(!strncmp(line, "+CIPRXGET: 1,", 13))                                     //!< Data arrival notification, manual receive mode
+    {
+        n = (int)strtoul(&line[13], NULL, 10);
+        if(n >= CONFIG_TCPIP_MAX_CONNECTIONS)
+            return 0;
+        conns[n].rxpending = 1;
+        return 1;
+    }
+    if(!strcmp(line, "+PDP: DEACT"))
+    {
+        for(i = 0; i < CONFIG_TCPIP_MAX_CONNECTIONS; i++)
+            conns[i].state = TCPIP_CLOSED;
+        return 1;
+    }
+    if(((n = TCPIPEventId(line, "CLOSED")) >= 0) || ((n = TCPIPEventId(line, "CLOSE OK")) >= 0) ||
+       ((n = TCPIPEventId(line, "CONNECT FAIL")) >= 0))
+    {
+        conns[n].state = TCPIP_CLOSED;
+        return 1;
+    }
+    if(((n = TCPIPEventId(line, "CONNECT OK")) >= 0) || ((n = TCPIPEventId(line, "ALREADY CONNECT")) >= 0))
+    {
+        conns[n].state = TCPIP_CONNECTED;
+        return 1;
+    }
+    return 0;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+static char* TCPIPAppendQuoted(char* dst, const char* str)
+{
+    *dst++ = '"';
+    dst = SIM800xATAppendStr(dst, str ? str : "");
+    *dst++ = '"';
+    *dst = 0;
+    return dst;
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xTCPIPInit(const char* apn, const char* user, const char* pw, char* ip, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    char cmd[CONFIG_AT_LINE_SIZE + 32], *p;
+    uint32_t start;
+    //---------
+    if(!apn || ((strlen(apn) + (user ? strlen(user) : 0) + (pw ? strlen(pw) : 0)) > CONFIG_AT_LINE_SIZE))
+        return SIM800X_ERROR;
+    SIM800xATRegisterURC(TCPIPURC);
+    SIM800xTCPIPShut(errcode);
+    status = SIM800xATCommand("AT+CIPMUX=1", NULL, NULL, 0, TCPIP_CMD_TIME_OUT, errcode);
+    if(status != SIM800X_OK)
+        return status;
+#if CONFIG_TCPIP_QUICK_SEND
+    status = SIM800xATCommand("AT+CIPQSEND=1", NULL, NULL, 0, TCPIP_CMD_TIME_OUT, errcode);
+    if(status != SIM800X_OK)
+        return status;
+#endif
+#if CONFIG_TCPIP_MANUAL_RECEIVE
+    status = SIM800xATCommand("AT+CIPRXGET=1", NULL, NULL, 0, TCPIP_CMD_TIME_OUT, errcode);
+    if(status != SIM800X_OK)
+        return status;
+#endif
+    //---------
+    p = SIM800xATAppendStr(cmd, "AT+CSTT=");
+    p = TCPIPAppendQuoted(p, apn);
+    *p++ = ',';
+    p = TCPIPAppendQuoted(p, user);
+    *p++ = ',';
+    TCPIPAppendQuoted(p, pw);
+    status = SIM800xATCommand(cmd, NULL, NULL, 0, TCPIP_CMD_TIME_OUT, errcode);
+    if(status != SIM800X_OK)
+        return status;
+    status = SIM800xATCommand("AT+CIICR", NULL, NULL, 0, TCPIP_CIICR_TIME_OUT, errcode);
+    if(status != SIM800X_OK)
+        return status;
+    //---------
+    SIM800xSDMPrint("AT+CIFSR\r");                                              //!< Answers with the address only, no final result code
+    start = Tick();
+    while((Tick() - start) < TCPIP_CMD_TIME_OUT)
+    {
+        if(SIM800xATReadLine(cmd, sizeof(cmd), TCPIP_CMD_TIME_OUT) < 0)
+            break;
+        if((cmd[0] >= '0') && (cmd[0] <= '9') && strchr(cmd, '.'))
+        {
+            if(ip)
+            {
+                strncpy(ip, cmd, 15);
+                ip[15] = 0;
+            }
+            return SIM800X_OK;
+        }
+        if(!strcmp(cmd, "ERROR"))
+            return SIM800X_ERROR;
+        SIM800xATDispatch(cmd);
+    }
+    return SIM800X_TIME_OUT;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xTCPIPShut(uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    uint8_t i;
+    //---------
+    SIM800xATPoll();
+    SIM800xSDMPrint("AT+CIPSHUT\r");
+    status = SIM800xATWaitLine("SHUT OK", NULL, 0, TCPIP_CIPSHUT_TIME_OUT, errcode);
+    for(i = 0; i < CONFIG_TCPIP_MAX_CONNECTIONS; i++)
+        conns[i].state = TCPIP_CLOSED;
+    return status;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xTCPIPConnect(uint8_t n, SIM800xTCPIPModeType mode, const char* host, uint16_t port, uint8_t* rxbuf, uint16_t rxsize, uint32_t tout, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    SIM800xTCPIPConnType* conn;
+    char cmd[TCPIP_HOST_MAX_SIZE + 32], *p;
+    uint32_t start;
+    //---------
+    if((n >= CONFIG_TCPIP_MAX_CONNECTIONS) || !host || (strlen(host) > TCPIP_HOST_MAX_SIZE))
+        return SIM800X_ERROR;
+#if !CONFIG_TCPIP_MANUAL_RECEIVE
+    if(!rxbuf || !rxsize)
+        return SIM800X_ERROR;
+#endif
+    SIM800xATRegisterURC(TCPIPURC);
+    conn = &conns[n];
+    conn->rxbuf = rxbuf;
+    conn->rxsize = rxsize;
+    conn->rxhead = 0;
+    conn->rxtail = 0;
+    conn->rxcount = 0;
+    conn->rxpending = 0;
+    conn->mode = mode;
+    conn->state = TCPIP_CONNECTING;
+    //---------
+    p = SIM800xATAppendStr(cmd, "AT+CIPSTART=");
+    p = SIM800xATAppendUInt(p, n);
+    p = SIM800xATAppendStr(p, (mode == TCPIP_UDP) ? ",\"UDP\"," : ",\"TCP\",");
+    p = TCPIPAppendQuoted(p, host);
+    *p++ = ',';
+    SIM800xATAppendUInt(p, port);
+    status = SIM800xATCommand(cmd, NULL, NULL, 0, TCPIP_CMD_TIME_OUT, errcode);
+    if(status != SIM800X_OK)
+    {
+        conn->state = TCPIP_CLOSED;
+        return status;
+    }
+    //---------
+    start = Tick();
+    while(conn->state == TCPIP_CONNECTING)                                      //!< Updated by the "<n>, CONNECT OK/FAIL" URC
+    {
+        if((Tick() - start) >= tout)
+            return SIM800X_TIME_OUT;
+        if(SIM800xATReadLine(cmd, sizeof(cmd), tout - (Tick() - start)) > 0)
+            SIM800xATDispatch(cmd);
+    }
+    return (conn->state == TCPIP_CONNECTED) ? SIM800X_OK : SIM800X_ERROR;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xTCPIPSend(uint8_t n, const uint8_t* data, uint16_t cnt, uint32_t tout, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    char cmd[32], *p;
+    //---------
+    if((n >= CONFIG_TCPIP_MAX_CONNECTIONS) || (conns[n].state != TCPIP_CONNECTED) || !cnt)
+        return SIM800X_ERROR;
+    p = SIM800xATAppendStr(cmd, "AT+CIPSEND=");
+    p = SIM800xATAppendUInt(p, n);
+    *p++ = ',';
+    p = SIM800xATAppendUInt(p, cnt);
+    SIM800xATAppendStr(p, "\r");
+    SIM800xATPoll();
+    SIM800xSDMPrint(cmd);
+    status = SIM800xATWaitLine(">", NULL, 0, TCPIP_CMD_TIME_OUT, errcode);
+    if(status != SIM800X_OK)
+        return status;
+    SIM800xSDMSendBytes((uint8_t*)data, cnt);                                   //!< Streamed from the caller buffer
+    //---------
+#if CONFIG_TCPIP_QUICK_SEND
+    status = SIM800xATWaitLine("DATA ACCEPT:", cmd, sizeof(cmd), tout, errcode);   //!< "DATA ACCEPT:<n>,<length>", data buffered by the modem
+    if((status == SIM800X_OK) && ((cmd[12] != (char)('0' + n)) || (strtoul(&cmd[14], NULL, 10) != cnt)))
+        status = SIM800X_ERROR;
+#else
+    cmd[0] = (char)('0' + n);
+    SIM800xATAppendStr(&cmd[1], ", SEND ");
+    status = SIM800xATWaitLine(cmd, cmd, sizeof(cmd), tout, errcode);
+    if((status == SIM800X_OK) && strcmp(&cmd[8], "OK"))
+        status = SIM800X_ERROR;                                                 //!< "<n>, SEND FAIL"
+#endif
+    return status;
+    //---------
+}
+//-----------------------------------
+
+#if CONFIG_TCPIP_MANUAL_RECEIVE
+//-----------------------------------
+/**
+ * @brief   Pull up to "max" bytes kept by the modem (AT+CIPRXGET=2), the first "size" ones
+ *          straight into "data", the others dropped
+ * @retval  number of bytes read
+ */
+static uint16_t TCPIPReceiveGet(uint8_t n, uint8_t* data, uint16_t size, uint16_t max)
+{
+    char line[CONFIG_AT_LINE_SIZE], *p;
+    uint16_t req, cnf, got = 0, skip, part;
+    //---------
+    p = SIM800xATAppendStr(line, "AT+CIPRXGET=2,");
+    p = SIM800xATAppendUInt(p, n);
+    *p++ = ',';
+    p = SIM800xATAppendUInt(p, max);
+    SIM800xATAppendStr(p, "\r");
+    SIM800xATPoll();
+    SIM800xSDMPrint(line);
+    if(SIM800xATWaitLine("+CIPRXGET: 2,", line, sizeof(line), TCPIP_CMD_TIME_OUT, NULL) != SIM800X_OK)
+        return 0;
+    p = strchr(&line[13], ',');                                                 //!< "+CIPRXGET: 2,<n>,<reqlength>,<cnflength>"
+    if(!p)
+        return 0;
+    req = (uint16_t)strtoul(p + 1, &p, 10);
+    cnf = (uint16_t)((*p == ',') ? strtoul(p + 1, NULL, 10) : 0);
+    skip = (req > size) ? (req - size) : 0;
+    if(req - skip)
+        got = SIM800xSDMReadBytes(data, req - skip, 1000 + req);                //!< Payload follows the response line
+    while(skip)                                                                 //!< Rest of a datagram larger than "size"
+    {
+        part = (skip > sizeof(line)) ? sizeof(line) : skip;
+        if(SIM800xSDMReadBytes((uint8_t*)line, part, 1000 + part) != part)
+            break;
+        skip -= part;
+    }
+    SIM800xATWaitLine("OK", NULL, 0, TCPIP_CMD_TIME_OUT, NULL);
+    if(!cnf)
+        conns[n].rxpending = 0;                                                 //!< Next arrival is notified by "+CIPRXGET: 1,<n>"
+    return got;
+    //---------
+}
+//-----------------------------------
+#endif
+
+//-----------------------------------
+uint16_t SIM800xTCPIPRead(uint8_t n, uint8_t* data, uint16_t size)
+{
+#if CONFIG_TCPIP_MANUAL_RECEIVE
+    uint16_t cnt = 0, chunk, got;
+    //---------
+    if(n >= CONFIG_TCPIP_MAX_CONNECTIONS)
+        return 0;
+    SIM800xATPoll();
+    if(conns[n].mode == TCPIP_UDP)
+    {
+        if(!size || !conns[n].rxpending)
+            return 0;
+        return TCPIPReceiveGet(n, data, size, TCPIP_UDP_MAX_SIZE);              //!< A request returns one datagram, read whole
+    }
+    while(size && conns[n].rxpending)
+    {
+        chunk = (size > CONFIG_TCPIP_RXGET_CHUNK) ? CONFIG_TCPIP_RXGET_CHUNK : size;
+        got = TCPIPReceiveGet(n, &data[cnt], chunk, chunk);
+        if(!got)
+            break;
+        cnt += got;
+        size -= got;
+    }
+    return cnt;
+    //---------
+#else
+    SIM800xTCPIPConnType* conn;
+    uint16_t cnt = 0, chunk, len, skip = 0;
+    //---------
+    if(n >= CONFIG_TCPIP_MAX_CONNECTIONS)
+        return 0;
+    SIM800xATPoll();
+    conn = &conns[n];
+    if(conn->mode == TCPIP_UDP)
+    {
+        if(conn->rxcount < 2)
+            return 0;
+        len = (uint16_t)(TCPIPGet(conn) << 8);
+        len |= TCPIPGet(conn);
+        if(len > size)
+            skip = len - size;                                                  //!< Datagram truncated
+        size = len - skip;
+    }
+    while(size && conn->rxcount)
+    {
+        chunk = conn->rxsize - conn->rxtail;
+        if(chunk > conn->rxcount)
+            chunk = conn->rxcount;
+        if(chunk > size)
+            chunk = size;
+        memcpy(&data[cnt], &conn->rxbuf[conn->rxtail], chunk);
+        conn->rxtail = (uint16_t)((conn->rxtail + chunk) % conn->rxsize);
+        conn->rxcount -= chunk;
+        cnt += chunk;
+        size -= chunk;
+    }
+    while(skip--)
+        TCPIPGet(conn);
+    return cnt;
+    //---------
+#endif
+}
+//-----------------------------------
+
+//-----------------------------------
+uint16_t SIM800xTCPIPAvailable(uint8_t n)
+{
+#if CONFIG_TCPIP_MANUAL_RECEIVE
+    char line[CONFIG_AT_LINE_SIZE], *p;
+    uint32_t cnt;
+    //---------
+    if(n >= CONFIG_TCPIP_MAX_CONNECTIONS)
+        return 0;
+    SIM800xATPoll();
+    if(!conns[n].rxpending)
+        return 0;                                                               //!< Nothing notified, no need to query the modem
+    p = SIM800xATAppendStr(line, "AT+CIPRXGET=4,");
+    SIM800xATAppendUInt(p, n);
+    if(SIM800xATCommand(line, "+CIPRXGET: 4,", line, sizeof(line), TCPIP_CMD_TIME_OUT, NULL) != SIM800X_OK)
+        return 0;
+    p = strchr(&line[13], ',');                                                 //!< "+CIPRXGET: 4,<n>,<cnflength>"
+    cnt = p ? strtoul(p + 1, NULL, 10) : 0;
+    if(!cnt)
+        conns[n].rxpending = 0;
+    return (uint16_t)((cnt > 0xFFFF) ? 0xFFFF : cnt);
+    //---------
+#else
+    SIM800xTCPIPConnType* conn;
+    //---------
+    if(n >= CONFIG_TCPIP_MAX_CONNECTIONS)
+        return 0;
+    SIM800xATPoll();
+    conn = &conns[n];
+    if(conn->mode == TCPIP_UDP)
+    {
+        if(conn->rxcount < 2)
+            return 0;
+        return (uint16_t)((conn->rxbuf[conn->rxtail] << 8) | conn->rxbuf[(conn->rxtail + 1) % conn->rxsize]);
+    }
+    return conn->rxcount;
+    //---------
+#endif
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800x_APIStatusType SIM800xTCPIPClose(uint8_t n, uint16_t* errcode)
+{
+    SIM800x_APIStatusType status;
+    char cmd[24], *p;
+    //---------
+    if(n >= CONFIG_TCPIP_MAX_CONNECTIONS)
+        return SIM800X_ERROR;
+    if(conns[n].state == TCPIP_CLOSED)
+        return SIM800X_OK;
+    conns[n].state = TCPIP_CLOSING;
+    p = SIM800xATAppendStr(cmd, "AT+CIPCLOSE=");
+    p = SIM800xATAppendUInt(p, n);
+    SIM800xATAppendStr(p, ",1\r");                                              //!< Quick close
+    SIM800xATPoll();
+    SIM800xSDMPrint(cmd);
+    cmd[0] = (char)('0' + n);
+    SIM800xATAppendStr(&cmd[1], ", CLOSE OK");
+    status = SIM800xATWaitLine(cmd, NULL, 0, TCPIP_CMD_TIME_OUT, errcode);
+    conns[n].state = TCPIP_CLOSED;
+    return status;
+    //---------
+}
+//-----------------------------------
+
+//-----------------------------------
+SIM800xTCPIPStateType SIM800xTCPIPGetState(uint8_t n)
+{
+    if(n >= CONFIG_TCPIP_MAX_CONNECTIONS)
+        return TCPIP_CLOSED;
+    return conns[n].state;
+}
+//-----------------------------------
+
+//-----------------------------------
+void SIM800xTCPIPPoll(void)
+{
+    SIM800xATPoll();
+}
+//-----------------------------------
@@ -0,0 +1,74 @@
+/**
+*************************************************************************
+*  	@file: Bench.h
+*
+*  	@brief: Header file for the host micro-benchmark harness
+*  	@brief: This file provide the timing helpers shared by the host benchmarks.
+*
+*	@note	The benchmarks build the driver sources with the host compiler (See Makefile),
+*			they are the baseline every performance change is measured against:
+*			- make bench, from this directory
+*			- compare the figures before and after the change, same machine, same flags
+*
+*	@note	Each measure repeats the code under test for at least BENCH_MIN_TIME
+*			nanoseconds and reports the mean time per run.
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+#ifndef __BENCH_H
+#define __BENCH_H
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+//==========================================================================//
+
+//==========================================================================//
+//								Bench constants								//
+//==========================================================================//
+#ifndef BENCH_MIN_TIME
+#define BENCH_MIN_TIME			200000000.0	//!< Minimum measure time, in nanoseconds
+#endif
+//==========================================================================//
+
+//===================================
+/**
+* @brief				: Monotonic time
+* @retval  				: Time in nanoseconds
+*/
+static inline double BenchNow(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (double)t.tv_sec * 1e9 + (double)t.tv_nsec;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Run a statement repeatedly for at least BENCH_MIN_TIME
+* @param	ns			: double receiving the mean time per run, in nanoseconds
+* @param	stmt		: Statement under test
+*/
+#define BENCH_RUN(ns, stmt)															\
+	do																				\
+	{																				\
+		double bench_start = BenchNow(), bench_elapsed;								\
+		uint32_t bench_runs = 0;													\
+		do																			\
+		{																			\
+			stmt;																	\
+			bench_runs++;															\
+		}while((bench_elapsed = BenchNow() - bench_start) < BENCH_MIN_TIME);		\
+		(ns) = bench_elapsed / bench_runs;											\
+	}while(0)
+//===================================
+
+#endif	/* __BENCH_H */
@@ -0,0 +1,110 @@
+/**
+*************************************************************************
+*  	@file: CompressBench.c
+*
+*  	@brief: Request body compression benchmark
+*  	@brief: Compression ratio and speed of SIM800xCompress() on recorded payloads.
+*
+*	@note	Usage: CompressBench file... (See Payloads/, request bodies of the example and
+*			of the batching layer). The speed is given in nanoseconds and, on x86, in
+*			time-stamp counter cycles per input byte.
+*
+*	@note	SIM800xCompressWrite() is not measured: its AT+HTTPDATA transfer is bound
+*			by the UART, the compressor it runs is the one measured here.
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "SIM800x_Compress.h"
+#include "SIM800x_HTTPStream.h"
+#include "Bench.h"
+#include <stdlib.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+//==========================================================================//
+
+//==========================================================================//
+//								Bench constants								//
+//==========================================================================//
+#define COMPRESS_BENCH_SIZE		65536		//!< Largest payload
+//==========================================================================//
+
+//===================================
+static uint8_t src[COMPRESS_BENCH_SIZE];
+static uint8_t dst[COMPRESS_BENCH_SIZE + COMPRESS_BENCH_SIZE / 8 + 64];
+static volatile uint32_t sink;				//!< Keeps the results alive
+//===================================
+
+//===================================
+/**
+* @brief				: Not used by SIM800xCompress(), linked for SIM800xCompressWrite()
+*/
+SIM800x_APIStatusType SIM800xHTTPStreamWrite(uint32_t size, SIM800xHTTPStreamProducer producer, uint32_t timeout, uint16_t* errcode)
+{
+	(void)size;
+	(void)producer;
+	(void)timeout;
+	(void)errcode;
+	return SIM800X_ERROR;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Time-stamp counter cycles per run of SIM800xCompress()
+* @retval  				: Cycles, 0 when not available
+*/
+static double CompressBenchCycles(uint32_t len)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	uint64_t start = __rdtsc();
+	uint32_t runs;
+
+	for(runs = 0; runs < 1000; runs++)
+		sink += SIM800xCompress(src, len, dst, sizeof(dst));
+	return (double)(__rdtsc() - start) / runs;
+#else
+	(void)len;
+	return 0;
+#endif
+}
+//===================================
+
+//===================================
+int main(int argc, char** argv)
+{
+	double ns, cycles;
+	uint32_t len, out;
+	FILE* f;
+	int i;
+
+	printf("%-24s %7s %7s %7s %9s %11s\n", "payload", "bytes", "zlib", "ratio", "ns/byte", "cycles/byte");
+	for(i = 1; i < argc; i++)
+	{
+		f = fopen(argv[i], "rb");
+		if(!f)
+		{
+			printf("%s: cannot open\n", argv[i]);
+			return EXIT_FAILURE;
+		}
+		len = (uint32_t)fread(src, 1, sizeof(src), f);
+		fclose(f);
+		out = SIM800xCompress(src, len, dst, sizeof(dst));
+		if(!len || !out || (out != SIM800xCompressSize(src, len)))
+		{
+			printf("%s: compression failed\n", argv[i]);
+			return EXIT_FAILURE;
+		}
+		BENCH_RUN(ns, sink += SIM800xCompress(src, len, dst, sizeof(dst)));
+		cycles = CompressBenchCycles(len);
+		printf("%-24s %7u %7u %6.1f%% %9.2f %11.1f\n", argv[i], len, out, 100.0 * out / len, ns / len, cycles / len);
+	}
+	return EXIT_SUCCESS;
+}
+//===================================
@@ -0,0 +1,173 @@
+/**
+*************************************************************************
+*  	@file: JSONBench.c
+*
+*  	@brief: JSON parser library benchmark
+*  	@brief: Build, lookup and iteration times of JSON.h, on payloads of 100 bytes to 64 Kbytes.
+*
+*	@note	Arrays hold a telemetry-like mix of numbers, strings and small objects.
+*			Objects hold at most 255 entries (GetEntryFromJsonObject() index), their
+*			values grow with the payload. Every item looked up is checked against the
+*			value it was built from: the program fails on a mismatch.
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "JSON.h"
+#include "Bench.h"
+#include <stdlib.h>
+//==========================================================================//
+
+//==========================================================================//
+//								Bench constants								//
+//==========================================================================//
+#define JSON_BENCH_SIZE			65535		//!< Largest payload, JSON.h positions are 16-bit
+#define JSON_BENCH_ITEMS		8192		//!< Maximum number of items
+#define JSON_BENCH_ITEM_SIZE	1024		//!< Maximum item size
+#define JSON_BENCH_ENTRIES		255			//!< Maximum number of object entries
+//==========================================================================//
+
+//===================================
+static const uint32_t sizes[] = {100, 1024, 8192, 65000};
+static char payload[JSON_BENCH_SIZE + 1];
+static char item[JSON_BENCH_SIZE + 1];
+static char value[JSON_BENCH_SIZE + 1];
+static char values[JSON_BENCH_ITEMS][JSON_BENCH_ITEM_SIZE];
+static char keys[JSON_BENCH_ENTRIES][8];
+static volatile uint32_t sink;				//!< Keeps the results alive
+//===================================
+
+//===================================
+/**
+* @brief				: Fill values[] with a telemetry-like mix, the strings padded to at least pad characters
+*/
+static void JsonBenchValues(uint16_t count, uint16_t pad)
+{
+	uint16_t i;
+	int n;
+
+	for(i = 0; i < count; i++)
+	{
+		switch(i % 4)
+		{
+			case 0:	n = snprintf(values[i], JSON_BENCH_ITEM_SIZE, "%u", (unsigned)(i * 37u));					break;
+			case 1:	n = snprintf(values[i], JSON_BENCH_ITEM_SIZE, "-%u.%02u", (unsigned)i, (unsigned)(i % 100));	break;
+			case 2:	n = snprintf(values[i], JSON_BENCH_ITEM_SIZE, "\"sensor, [%u]\"", (unsigned)i);				break;
+			default:n = snprintf(values[i], JSON_BENCH_ITEM_SIZE, "{\"t\":%u,\"ok\":true}", (unsigned)i);			break;
+		}
+		if((i % 4) == 2)
+		{
+			while((n < pad) && (n < (JSON_BENCH_ITEM_SIZE - 1)))						//!< Pad inside the string
+			{
+				values[i][n - 1] = 'x';
+				values[i][n++] = '"';
+			}
+			values[i][n] = '\0';
+		}
+	}
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Build an array of the first values up to size bytes
+* @retval  				: Number of items
+*/
+static uint16_t JsonBenchArray(uint32_t size)
+{
+	uint16_t pos = 0, i;
+
+	for(i = 0; (i < JSON_BENCH_ITEMS) && ((pos + strlen(values[i]) + 2) < size); i++)
+		AddValueToJsonArray(payload, values[i], &pos);
+	return i;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Build an object of the first values up to size bytes
+* @retval  				: Number of entries
+*/
+static uint16_t JsonBenchObject(uint32_t size)
+{
+	uint16_t pos = 0, i;
+
+	for(i = 0; (i < JSON_BENCH_ENTRIES) && ((pos + strlen(keys[i]) + strlen(values[i]) + 5) < size); i++)
+		AddEntryToJsonObject(payload, keys[i], values[i], &pos);
+	return i;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Check every item of the payload
+* @retval  	0			: Items match the values they were built from
+* @retval	1			: Mismatch
+*/
+static uint8_t JsonBenchCheck(uint16_t count, uint8_t object)
+{
+	char key[8];
+	uint16_t i;
+
+	for(i = 0; i < count; i++)
+	{
+		if(object)
+		{
+			if(GetEntryFromJsonObject(payload, item, (uint8_t)i) || GetKeyFromJsonEntry(item, key) || strcmp(key, keys[i]) ||
+			   GetValueFromJsonEntry(item, value))
+				return 1;
+		}else if(GetValueFromJsonArray(payload, value, i))
+			return 1;
+		if(strcmp(value, values[i]))
+			return 1;
+	}
+	return (object ? GetEntryFromJsonObject(payload, item, (uint8_t)count) : GetValueFromJsonArray(payload, item, count)) == 0;
+}
+//===================================
+
+//===================================
+int main(void)
+{
+	double build, lookup, iterate;
+	uint16_t count, i, pad;
+	uint8_t s, object;
+
+	for(i = 0; i < JSON_BENCH_ENTRIES; i++)
+		snprintf(keys[i], sizeof(keys[i]), "k%u", (unsigned)i);
+	printf("%-6s %6s %6s %12s %12s %14s\n", "type", "bytes", "items", "build(us)", "last(us)", "iterate(us)");
+	for(object = 0; object < 2; object++)
+	{
+		for(s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+		{
+			pad = object ? (uint16_t)(sizes[s] * 4 / JSON_BENCH_ENTRIES) : 0;			//!< One value in four is padded
+			JsonBenchValues(JSON_BENCH_ITEMS, pad);
+			if(object)
+			{
+				BENCH_RUN(build, sink += JsonBenchObject(sizes[s]));
+				count = JsonBenchObject(sizes[s]);
+				BENCH_RUN(lookup, sink += GetEntryFromJsonObject(payload, item, (uint8_t)(count - 1)));
+				BENCH_RUN(iterate, for(i = 0; i < count; i++) sink += GetEntryFromJsonObject(payload, item, (uint8_t)i));
+			}else
+			{
+				BENCH_RUN(build, sink += JsonBenchArray(sizes[s]));
+				count = JsonBenchArray(sizes[s]);
+				BENCH_RUN(lookup, sink += GetValueFromJsonArray(payload, item, (uint16_t)(count - 1)));
+				BENCH_RUN(iterate, for(i = 0; i < count; i++) sink += GetValueFromJsonArray(payload, item, i));
+			}
+			if(JsonBenchCheck(count, object))
+			{
+				printf("%s of %u bytes: item mismatch\n", object ? "object" : "array", (unsigned)sizes[s]);
+				return EXIT_FAILURE;
+			}
+			printf("%-6s %6u %6u %12.2f %12.2f %14.2f\n", object ? "object" : "array", (unsigned)strlen(payload), count,
+				   build / 1e3, lookup / 1e3, iterate / 1e3);
+		}
+	}
+	return EXIT_SUCCESS;
+}
+//===================================
@@ -0,0 +1,274 @@
+/**
+*************************************************************************
+*  	@file: NumberBench.c
+*
+*  	@brief: JSON builder number appenders and record schema benchmark
+*  	@brief: Typed appenders (JsonBuilderAddInt, AddUInt, AddFixed, AddBool) against sprintf
+*			and JsonBuilderAddRaw, the serializers generated by JSONSchema.h, the key
+*			dictionary of JSONBuilder.h and the templates of JSONTemplate.h, on the field
+*			mix of our reports.
+*
+*	@note	The field mix: the four readings of the example report, a timestamp, two
+*			fixed-point values (1 and 3 decimals, possibly negative) and a flag. The
+*			three JSON records are built from the same random values and must be
+*			identical, the CBOR one must decode back to them: the program fails on a mismatch.
+*			The example report (its four readings) is either rebuilt or patched in a
+*			template with the widths of ApplicationExample.c, both must hold the same
+*			values once the padding spaces are removed.
+*
+*	@note	The host libc sprintf is faster than newlib-nano's svfprintf on the target,
+*			the gap measured here is a lower bound.
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "JSONBuilder.h"
+#include "JSONSchema.h"
+#include "JSONTemplate.h"
+#include "Bench.h"
+#include <stdlib.h>
+#include <string.h>
+//==========================================================================//
+
+//==========================================================================//
+//								Bench constants								//
+//==========================================================================//
+#define NUMBER_BENCH_RECORDS	1024		//!< Number of random records
+#define NUMBER_BENCH_SIZE		256			//!< Record buffer size
+//==========================================================================//
+
+//==========================================================================//
+//								Bench schema								//
+//==========================================================================//
+#define NUMBER_BENCH_RECORD(FIELD)													\
+	FIELD(INT,	temperature,	"Engine Temperature (C)")								\
+	FIELD(UINT,	rpm,			"RPM")													\
+	FIELD(INT,	speed,			"Vehicle Speed (MPH)")									\
+	FIELD(INT,	fuel,			"Fuel Level (%)")										\
+	FIELD(UINT,	timestamp,		"ts")													\
+	FIELD(FIX1,	outside,		"Outside (C)")											\
+	FIELD(FIX3,	battery,		"Battery (V)")											\
+	FIELD(BOOL,	moving,			"Moving")
+
+JSON_SCHEMA_DECLARE(NumberBenchRecord, NUMBER_BENCH_RECORD)
+JSON_SCHEMA_DEFINE(NumberBenchRecord, NUMBER_BENCH_RECORD)
+//==========================================================================//
+
+//===================================
+static const JsonKeyAlias keys[] =						//!< Indexes "0" to "7"
+{
+	{"Engine Temperature (C)", NULL}, {"RPM", NULL}, {"Vehicle Speed (MPH)", NULL}, {"Fuel Level (%)", NULL},
+	{"ts", NULL}, {"Outside (C)", NULL}, {"Battery (V)", NULL}, {"Moving", NULL},
+};
+static const JsonDictionary dictionary = {1, sizeof(keys) / sizeof(keys[0]), keys};
+//===================================
+
+//===================================
+static NumberBenchRecord records[NUMBER_BENCH_RECORDS];
+static char typed[NUMBER_BENCH_SIZE];
+static char printed[NUMBER_BENCH_SIZE];
+static char keyed[NUMBER_BENCH_SIZE];
+static char report[NUMBER_BENCH_SIZE];
+static char patched[NUMBER_BENCH_SIZE];
+static JsonTemplate tmpl;
+static char schema[NumberBenchRecord_JSON_SIZE];
+static uint8_t cbor[NumberBenchRecord_CBOR_SIZE];
+static char number[JSON_NUMBER_SIZE + 2];	//!< Sign, 10 digits, decimal point and terminator
+static volatile uint32_t sink;				//!< Keeps the results alive
+static const uint32_t scale[4] = {1, 10, 100, 1000};
+//===================================
+
+//===================================
+/**
+* @brief				: Build a record with the typed appenders
+* @retval  				: Record length, 0 if it did not fit
+*/
+static uint16_t NumberBenchTyped(const NumberBenchRecord * r, char * buf)
+{
+	JsonBuilder b;
+
+	JsonBuilderInit(&b, buf, NUMBER_BENCH_SIZE);
+	JsonBuilderBeginObject(&b, NULL);
+	JsonBuilderAddInt(&b, "Engine Temperature (C)", r->temperature);
+	JsonBuilderAddUInt(&b, "RPM", r->rpm);
+	JsonBuilderAddInt(&b, "Vehicle Speed (MPH)", r->speed);
+	JsonBuilderAddInt(&b, "Fuel Level (%)", r->fuel);
+	JsonBuilderAddUInt(&b, "ts", r->timestamp);
+	JsonBuilderAddFixed(&b, "Outside (C)", r->outside, 1);
+	JsonBuilderAddFixed(&b, "Battery (V)", r->battery, 3);
+	JsonBuilderAddBool(&b, "Moving", r->moving);
+	JsonBuilderEnd(&b);
+	return JsonBuilderFinish(&b) ? 0 : b.len;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Rebuild the example report with the typed appenders
+* @retval  				: Report length, 0 if it did not fit
+*/
+static uint16_t NumberBenchReport(const NumberBenchRecord * r, char * buf)
+{
+	JsonBuilder b;
+
+	JsonBuilderInit(&b, buf, NUMBER_BENCH_SIZE);
+	JsonBuilderBeginObject(&b, NULL);
+	JsonBuilderAddInt(&b, "Engine Temperature (C)", r->temperature);
+	JsonBuilderAddUInt(&b, "RPM", r->rpm);
+	JsonBuilderAddInt(&b, "Vehicle Speed (MPH)", r->speed);
+	JsonBuilderAddInt(&b, "Fuel Level (%)", r->fuel);
+	JsonBuilderEnd(&b);
+	return JsonBuilderFinish(&b) ? 0 : b.len;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Patch the example report template
+* @retval  				: 0 if all the fields were set
+*/
+static uint8_t NumberBenchPatch(const NumberBenchRecord * r)
+{
+	return JsonTemplateSetNumber(&tmpl, 0, r->temperature) | JsonTemplateSetNumber(&tmpl, 1, (int32_t)r->rpm) |
+		   JsonTemplateSetNumber(&tmpl, 2, r->speed) | JsonTemplateSetNumber(&tmpl, 3, r->fuel);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Format a fixed-point value with sprintf
+*/
+static void NumberBenchPrintFixed(char * num, int32_t value, uint8_t decimals)
+{
+	uint32_t mag = (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value;
+
+	snprintf(num, sizeof(number), "%s%lu.%0*lu", (value < 0) ? "-" : "", (unsigned long)(mag / scale[decimals]), decimals,
+			(unsigned long)(mag % scale[decimals]));
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Build a record with sprintf and JsonBuilderAddRaw
+* @retval  				: Record length, 0 if it did not fit
+*/
+static uint16_t NumberBenchPrinted(const NumberBenchRecord * r, char * buf)
+{
+	JsonBuilder b;
+	char num[sizeof(number)];
+
+	JsonBuilderInit(&b, buf, NUMBER_BENCH_SIZE);
+	JsonBuilderBeginObject(&b, NULL);
+	sprintf(num, "%ld", (long)r->temperature);
+	JsonBuilderAddRaw(&b, "Engine Temperature (C)", num);
+	sprintf(num, "%lu", (unsigned long)r->rpm);
+	JsonBuilderAddRaw(&b, "RPM", num);
+	sprintf(num, "%ld", (long)r->speed);
+	JsonBuilderAddRaw(&b, "Vehicle Speed (MPH)", num);
+	sprintf(num, "%ld", (long)r->fuel);
+	JsonBuilderAddRaw(&b, "Fuel Level (%)", num);
+	sprintf(num, "%lu", (unsigned long)r->timestamp);
+	JsonBuilderAddRaw(&b, "ts", num);
+	NumberBenchPrintFixed(num, r->outside, 1);
+	JsonBuilderAddRaw(&b, "Outside (C)", num);
+	NumberBenchPrintFixed(num, r->battery, 3);
+	JsonBuilderAddRaw(&b, "Battery (V)", num);
+	JsonBuilderAddRaw(&b, "Moving", r->moving ? "true" : "false");
+	JsonBuilderEnd(&b);
+	return JsonBuilderFinish(&b) ? 0 : b.len;
+}
+//===================================
+
+//===================================
+int main(void)
+{
+	NumberBenchRecord *r, decoded;
+	double tns, pns, fns, sns, jns, cns, dns, rns, ins;
+	uint32_t i, jsonbytes = 0, cborbytes = 0, dictbytes = 0;
+	uint16_t n, k;
+	char *c;
+
+	JsonTemplateInit(&tmpl, patched, sizeof(patched));
+	JsonBuilderBeginObject(&tmpl.builder, NULL);
+	JsonTemplateAddNumber(&tmpl, "Engine Temperature (C)", 4, 0);
+	JsonTemplateAddNumber(&tmpl, "RPM", 5, 0);
+	JsonTemplateAddNumber(&tmpl, "Vehicle Speed (MPH)", 3, 0);
+	JsonTemplateAddNumber(&tmpl, "Fuel Level (%)", 3, 0);
+	JsonBuilderEnd(&tmpl.builder);
+	if(JsonBuilderFinish(&tmpl.builder) || (tmpl.count != 4))
+	{
+		printf("template: %s\n", patched);
+		return EXIT_FAILURE;
+	}
+	srand(1);
+	for(i = 0, r = records; i < NUMBER_BENCH_RECORDS; i++, r++)
+	{
+		r->temperature = rand() % 130 - 20;
+		r->rpm = (uint32_t)(rand() % 7000);
+		r->speed = rand() % 120;
+		r->fuel = rand() % 101;
+		r->timestamp = 1792300000u + i * 10u;
+		r->outside = rand() % 800 - 300;
+		r->battery = rand() % 15000;
+		r->moving = (uint8_t)(rand() & 1);
+		n = NumberBenchRecordToCbor(r, cbor, sizeof(cbor));
+		memset(&decoded, 0, sizeof(decoded));
+		if(!NumberBenchTyped(r, typed) || (NumberBenchTyped(r, typed) != NumberBenchPrinted(r, printed)) || strcmp(typed, printed) ||
+		   !NumberBenchRecordToJson(r, schema, sizeof(schema)) || strcmp(typed, schema) ||
+		   NumberBenchRecordFromCbor(&decoded, cbor, n) || memcmp(&decoded, r, sizeof(decoded)))
+		{
+			printf("record %u: mismatch\n%s\n%s\n%s\n", i, typed, printed, schema);
+			return EXIT_FAILURE;
+		}
+		jsonbytes += strlen(schema);
+		cborbytes += n;
+		n = NumberBenchReport(r, report);
+		if(NumberBenchPatch(r) || (strlen(patched) != tmpl.builder.len))
+			n = 0;
+		for(c = patched, k = 0; *c && (k < n); c++)										//!< Same text without the padding
+		{
+			if((*c == ' ') && (report[k] != ' '))
+				continue;
+			if(*c != report[k++])
+				break;
+		}
+		if(!n || *c || (k != n))
+		{
+			printf("report %u: mismatch\n%s\n%s\n", i, report, patched);
+			return EXIT_FAILURE;
+		}
+	}
+	JsonBuilderSetDictionary(&dictionary);
+	for(i = 0; i < NUMBER_BENCH_RECORDS; i++)
+		dictbytes += NumberBenchTyped(&records[i], keyed);
+	BENCH_RUN(dns, for(i = 0; i < NUMBER_BENCH_RECORDS; i++) sink += NumberBenchTyped(&records[i], keyed));
+	JsonBuilderSetDictionary(NULL);
+	BENCH_RUN(tns, for(i = 0; i < NUMBER_BENCH_RECORDS; i++) sink += NumberBenchTyped(&records[i], typed));
+	BENCH_RUN(pns, for(i = 0; i < NUMBER_BENCH_RECORDS; i++) sink += NumberBenchPrinted(&records[i], printed));
+	BENCH_RUN(jns, for(i = 0; i < NUMBER_BENCH_RECORDS; i++) sink += NumberBenchRecordToJson(&records[i], schema, sizeof(schema)));
+	BENCH_RUN(cns, for(i = 0; i < NUMBER_BENCH_RECORDS; i++) sink += NumberBenchRecordToCbor(&records[i], cbor, sizeof(cbor)));
+	BENCH_RUN(rns, for(i = 0; i < NUMBER_BENCH_RECORDS; i++) sink += NumberBenchReport(&records[i], report));
+	BENCH_RUN(ins, for(i = 0; i < NUMBER_BENCH_RECORDS; i++) sink += NumberBenchPatch(&records[i]));
+	BENCH_RUN(fns, for(i = 0; i < NUMBER_BENCH_RECORDS; i++) sink += (uint32_t)(uintptr_t)JsonFormatFixed(&number[JSON_NUMBER_SIZE], records[i].battery, 3));
+	BENCH_RUN(sns, for(i = 0; i < NUMBER_BENCH_RECORDS; i++) { NumberBenchPrintFixed(number, records[i].battery, 3); sink += (uint8_t)number[0]; });
+	printf("%-34s %10s %10s\n", "", "typed", "sprintf");
+	printf("%-34s %10.1f %10.1f\n", "record of 8 fields (ns)", tns / NUMBER_BENCH_RECORDS, pns / NUMBER_BENCH_RECORDS);
+	printf("%-34s %10.1f %10.1f\n", "fixed-point, 3 decimals (ns)", fns / NUMBER_BENCH_RECORDS, sns / NUMBER_BENCH_RECORDS);
+	printf("%-34s %10.1f %10.1f\n", "schema record, JSON / CBOR (ns)", jns / NUMBER_BENCH_RECORDS, cns / NUMBER_BENCH_RECORDS);
+	printf("%-34s %10.1f %10.1f\n", "schema record, JSON / CBOR (bytes)", (double)jsonbytes / NUMBER_BENCH_RECORDS,
+		   (double)cborbytes / NUMBER_BENCH_RECORDS);
+	printf("%-34s %10.1f %10.1f\n", "keys, full / dictionary (ns)", tns / NUMBER_BENCH_RECORDS, dns / NUMBER_BENCH_RECORDS);
+	printf("%-34s %10.1f %10.1f\n", "keys, full / dictionary (bytes)", (double)jsonbytes / NUMBER_BENCH_RECORDS,
+		   (double)dictbytes / NUMBER_BENCH_RECORDS);
+	printf("%-34s %10.1f %10.1f\n", "report, rebuilt / patched (ns)", rns / NUMBER_BENCH_RECORDS, ins / NUMBER_BENCH_RECORDS);
+	printf("record example: %s\n", typed);
+	printf("with the dictionary: %s\n", keyed);
+	printf("report template: %s\n", patched);
+	return EXIT_SUCCESS;
+}
+//===================================
@@ -0,0 +1,104 @@
+/**
+*************************************************************************
+*  	@file: SDMStub.c
+*
+*  	@brief: Host stand-in for the serial data manager
+*  	@brief: See SIM800x_SDM.h in this directory for more details.
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "SIM800x_SDM.h"
+#include <time.h>
+//==========================================================================//
+
+//===================================
+static uint8_t fifo[SDM_STUB_FIFO_SIZE];
+static uint16_t head, tail;						//!< Next byte written, next byte read
+static uint32_t skipped;						//!< Milliseconds skipped by wait()
+static SDMStubSendCallBack sendcb;
+//===================================
+
+//===================================
+uint32_t Tick(void)
+{
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint32_t)(t.tv_sec * 1000u + t.tv_nsec / 1000000u) + skipped;
+}
+//===================================
+
+//===================================
+void wait(uint32_t ms)
+{
+	skipped += ms;
+}
+//===================================
+
+//===================================
+uint16_t SIM800xSDMRxAvailable(void)
+{
+	return (uint16_t)((head + SDM_STUB_FIFO_SIZE - tail) % SDM_STUB_FIFO_SIZE);
+}
+//===================================
+
+//===================================
+uint8_t SIM800xSDMReadByte(void)
+{
+	uint8_t c = 0;
+
+	if(head != tail)
+	{
+		c = fifo[tail];
+		tail = (uint16_t)((tail + 1) % SDM_STUB_FIFO_SIZE);
+	}
+	return c;
+}
+//===================================
+
+//===================================
+void SIM800xSDMSendBytes(uint8_t *data, uint16_t cnt)
+{
+	if(sendcb)
+		sendcb(data, cnt);
+}
+//===================================
+
+//===================================
+void SIM800xSDMPrint(const char *str)
+{
+	if(sendcb)
+		sendcb((const uint8_t *)str, (uint16_t)strlen(str));
+}
+//===================================
+
+//===================================
+void SIM800xSDMFlush(void)
+{
+	tail = head;
+}
+//===================================
+
+//===================================
+void SDMStubSetSend(SDMStubSendCallBack cb)
+{
+	sendcb = cb;
+}
+//===================================
+
+//===================================
+uint8_t SDMStubReceive(const uint8_t * data, uint16_t cnt)
+{
+	if((SIM800xSDMRxAvailable() + cnt) >= SDM_STUB_FIFO_SIZE)
+		return 1;
+	while(cnt--)
+	{
+		fifo[head] = *data++;
+		head = (uint16_t)((head + 1) % SDM_STUB_FIFO_SIZE);
+	}
+	return 0;
+}
+//===================================
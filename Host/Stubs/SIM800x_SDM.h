@@ -0,0 +1,87 @@
+/**
+*************************************************************************
+*  	@file: SIM800x_SDM.h
+*
+*  	@brief: Host stand-in for the serial data manager header
+*  	@brief: This file replaces Drivers/SIM800x/Inc/SIM800x_SDM.h in the host build
+*			(See Makefile), so that the portable sources build without the HAL.
+*
+*	@note	The tick, the delay and the modem UART functions the host tests need are
+*			implemented by SDMStub.c, a loopback stand-in for the modem:
+*			- the bytes the driver sends are handed to the call-back registered with
+*			  SDMStubSetSend(), the test peer
+*			- the bytes given to SDMStubReceive() are read back by the driver
+*			- wait() returns at once and moves the tick forward instead, so that
+*			  time-outs and retransmissions take no time
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+#ifndef __SIM800X_SDM_H
+#define __SIM800X_SDM_H
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include <stdint.h>
+#include <string.h>
+#include "SIM800x_CONFIG.h"
+//==========================================================================//
+
+//==========================================================================//
+//								Stub constants								//
+//==========================================================================//
+#define SDM_STUB_FIFO_SIZE		8192		//!< Receive FIFO size, modem to driver
+//==========================================================================//
+
+//===================================
+/**
+* @brief	Bytes sent by the driver, handed to the test peer
+*/
+typedef void (*SDMStubSendCallBack)(const uint8_t * data, uint16_t cnt);
+//===================================
+
+//===================================
+/**
+* @brief				: Millisecond tick, HAL_GetTick() on the target: monotonic clock plus the delays skipped by wait()
+*/
+extern uint32_t Tick(void);
+//===================================
+
+//===================================
+/**
+* @brief				: Delay, HAL_Delay() on the target: moves the tick forward by ms and returns at once
+*/
+extern void wait(uint32_t ms);
+//===================================
+
+//===================================
+/**
+* @brief				: Modem UART functions used by the drivers, See Drivers/SIM800x/Inc/SIM800x_SDM.h
+*/
+extern uint16_t SIM800xSDMRxAvailable(void);
+extern uint8_t SIM800xSDMReadByte(void);
+extern void SIM800xSDMSendBytes(uint8_t *data, uint16_t cnt);
+extern void SIM800xSDMPrint(const char *str);
+extern void SIM800xSDMFlush(void);
+//===================================
+
+//===================================
+/**
+* @brief				: Register the test peer, NULL to drop the bytes sent
+*/
+extern void SDMStubSetSend(SDMStubSendCallBack cb);
+//===================================
+
+//===================================
+/**
+* @brief				: Queue bytes from the modem, to be read by the driver
+* @retval  	0			: Operation succeeded
+* @retval	1			: Operation failed, FIFO full (nothing queued)
+*/
+extern uint8_t SDMStubReceive(const uint8_t * data, uint16_t cnt);
+//===================================
+
+#endif	/* __SIM800X_SDM_H */
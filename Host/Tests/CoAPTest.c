@@ -0,0 +1,557 @@
+/**
+*************************************************************************
+*  	@file: CoAPTest.c
+*
+*  	@brief: CoAP client test
+*  	@brief: SIM800x_CoAP.c against a scripted CoAP server over a loopback stand-in for
+*			the UDP connection: message encoding, response parsing, option parser
+*			bounds, retransmissions and Block1 transfers.
+*
+*	@note	The test provides the TCP/IP toolkit functions the client uses: the
+*			datagrams it sends go to the server, which decodes them with its own option
+*			parser and queues its answers for SIM800xTCPIPRead(). A read that finds no
+*			datagram lets CO_TEST_READ_TIME milliseconds pass (See Stubs/SIM800x_SDM.h),
+*			so that retransmission time-outs take no time.
+*
+*	@note	Malformed responses are read into a buffer filled with option bytes past
+*			their end: a parser reading past the datagram finds more options instead of
+*			stopping, and the message is delivered.
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "SIM800x_CoAP.h"
+#include "SIM800x_SDM.h"
+#include "Test.h"
+//==========================================================================//
+
+//==========================================================================//
+//								Test constants								//
+//==========================================================================//
+#define CO_TEST_DATAGRAM		1472		//!< Largest UDP datagram
+#define CO_TEST_QUEUE			8			//!< Datagrams queued for the client
+#define CO_TEST_READ_TIME		100			//!< Milliseconds passed by an empty read
+#define CO_TEST_OPTIONS			16			//!< Options decoded per message
+#define CO_TEST_BODY			2048		//!< Largest Block1 body
+//==========================================================================//
+
+//===================================
+/**
+* @brief	Decoded message
+*/
+typedef struct
+{
+	uint8_t			type, tkl, code;
+	uint16_t		mid;
+	const uint8_t*	token;
+	uint8_t			count;
+	uint16_t		num[CO_TEST_OPTIONS];
+	const uint8_t*	value[CO_TEST_OPTIONS];
+	uint16_t		vlen[CO_TEST_OPTIONS];
+	const uint8_t*	payload;
+	uint16_t		plen;
+}CoTestMessage;
+//===================================
+
+//===================================
+/**
+* @brief	Scripted server, scenario then state
+*/
+typedef struct
+{
+	uint8_t		separate;					//!< Empty ACK then a separate CON response
+	uint8_t		silent;						//!< No answer at all
+	uint8_t		drop;						//!< CON messages dropped before the first answer
+	int32_t		reject;						//!< Block answered 4.13, or -1
+	//---------
+	uint8_t		received;					//!< Datagrams received
+	uint8_t		last[CO_TEST_DATAGRAM];		//!< Last datagram
+	uint16_t	lastlen;
+	uint32_t	times[8];					//!< Tick of each datagram
+	uint8_t		acks;						//!< Empty ACKs received
+	uint8_t		rsts;						//!< RSTs received
+	uint16_t	emptymid;					//!< Message ID of the last empty ACK or RST
+	uint8_t		body[CO_TEST_BODY];			//!< Block1 body reassembled
+	uint32_t	bodylen;
+	uint32_t	blocks;						//!< Next block number expected
+	uint8_t		violations;
+}CoTestServer;
+//===================================
+
+//===================================
+static CoTestServer server;
+static uint8_t queue[CO_TEST_QUEUE][CO_TEST_DATAGRAM];
+static uint16_t queuelen[CO_TEST_QUEUE];
+static uint8_t queued, poison;
+static uint8_t responses;					//!< Client call-back calls
+static uint16_t responseid;
+static uint8_t responsecode;
+static uint8_t responsepayload[64];
+static uint16_t responselen;
+static uint8_t big[CO_TEST_BODY];
+//===================================
+
+//===================================
+/**
+* @brief				: Decode a message, the server side option parser
+* @retval  				: 0 if well formed
+*/
+static uint8_t CoTestDecode(const uint8_t * m, uint16_t len, CoTestMessage * d)
+{
+	uint32_t pos, num = 0, delta, olen;
+
+	memset(d, 0, sizeof(CoTestMessage));
+	if((len < 4) || ((m[0] >> 6) != 1) || ((m[0] & 0x0F) > 8) || (len < (4u + (m[0] & 0x0F))))
+		return 1;
+	d->type = (m[0] >> 4) & 3;
+	d->tkl = m[0] & 0x0F;
+	d->code = m[1];
+	d->mid = (uint16_t)((m[2] << 8) | m[3]);
+	d->token = &m[4];
+	for(pos = 4u + d->tkl; (pos < len) && (m[pos] != 0xFF); pos += olen)
+	{
+		delta = m[pos] >> 4;
+		olen = m[pos++] & 0x0F;
+		if((delta == 15) || (olen == 15) || (d->count == CO_TEST_OPTIONS))
+			return 1;
+		if(delta >= 13)
+		{
+			if((pos + delta - 12) > len)
+				return 1;
+			delta = (delta == 13) ? (m[pos] + 13u) : (((uint32_t)m[pos] << 8 | m[pos + 1]) + 269u);
+			pos += (delta < 269) ? 1 : 2;
+		}
+		if(olen >= 13)
+		{
+			if((pos + olen - 12) > len)
+				return 1;
+			olen = (olen == 13) ? (m[pos] + 13u) : (((uint32_t)m[pos] << 8 | m[pos + 1]) + 269u);
+			pos += (olen < 269) ? 1 : 2;
+		}
+		if((pos + olen) > len)
+			return 1;
+		num += delta;
+		d->num[d->count] = (uint16_t)num;
+		d->value[d->count] = &m[pos];
+		d->vlen[d->count++] = (uint16_t)olen;
+	}
+	if(pos < len)
+	{
+		if(++pos == len)
+			return 1;																//!< Payload marker and no payload
+		d->payload = &m[pos];
+		d->plen = (uint16_t)(len - pos);
+	}
+	return 0;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Queue a datagram for the client
+*/
+static void CoTestQueue(const uint8_t * m, uint16_t len)
+{
+	if(queued < CO_TEST_QUEUE)
+	{
+		memcpy(queue[queued], m, len);
+		queuelen[queued++] = len;
+	}
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Queue a response: type, code, message ID, 2-byte token, options bytes and payload
+*/
+static void CoTestRespond(uint8_t type, uint8_t code, uint16_t mid, uint16_t token, const uint8_t * opts, uint16_t olen,
+						  const char * payload)
+{
+	uint8_t m[CO_TEST_DATAGRAM];
+	uint16_t n = 0;
+
+	m[n++] = (uint8_t)(0x40 | (type << 4) | 2);
+	m[n++] = code;
+	m[n++] = (uint8_t)(mid >> 8);
+	m[n++] = (uint8_t)mid;
+	m[n++] = (uint8_t)(token >> 8);
+	m[n++] = (uint8_t)token;
+	memcpy(&m[n], opts, olen);
+	n = (uint16_t)(n + olen);
+	if(payload)
+	{
+		m[n++] = 0xFF;
+		memcpy(&m[n], payload, strlen(payload));
+		n = (uint16_t)(n + strlen(payload));
+	}
+	CoTestQueue(m, n);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Server, a datagram from the client
+*/
+static void CoTestServe(const uint8_t * m, uint16_t len)
+{
+	static const uint8_t changed[] = {0xC1, 0x00};						//!< Content-Format text/plain
+	CoTestMessage d;
+	uint32_t block = 0, v;
+	uint8_t i, hasblock = 0, code;
+
+	if(server.received < 8)
+		server.times[server.received] = Tick();
+	server.received++;
+	memcpy(server.last, m, len);
+	server.lastlen = len;
+	if(CoTestDecode(m, len, &d) || ((d.tkl != 2) && d.code) || ((d.tkl == 2) && (((d.token[0] << 8) | d.token[1]) != d.mid)))
+	{
+		server.violations++;														//!< The message ID is the token
+		return;
+	}
+	if(!d.code)
+	{
+		server.acks += (d.type == 2);
+		server.rsts += (d.type == 3);
+		server.emptymid = d.mid;
+		return;
+	}
+	for(i = 0; i < d.count; i++)
+	{
+		if(d.num[i] == 27)
+		{
+			for(v = 0, hasblock = 1; v < d.vlen[i]; v++)
+				block = (block << 8) | d.value[i][v];
+		}
+	}
+	if(server.silent || (d.type != 0))
+		return;
+	if(server.drop)
+	{
+		server.drop--;
+		return;
+	}
+	//---------
+	if(hasblock)
+	{
+		if(server.blocks && ((block >> 4) == (server.blocks - 1)))
+			;																		//!< Retransmission, acknowledged again
+		else if(((block >> 4) != server.blocks) || ((block & 7) != 4) || ((server.bodylen + d.plen) > sizeof(server.body)))
+			server.violations++;
+		else
+		{
+			memcpy(&server.body[server.bodylen], d.payload, d.plen);
+			server.bodylen += d.plen;
+			server.blocks++;
+		}
+		if((int32_t)(block >> 4) == server.reject)
+		{
+			CoTestRespond(2, 0x8D, d.mid, d.mid, NULL, 0, NULL);					//!< 4.13 Request Entity Too Large
+			return;
+		}
+		code = (block & 8) ? 0x5F : 0x44;
+		{
+			uint8_t o[5] = {0xD1, 27 - 13, (uint8_t)block};						//!< Block1 echoed, extended delta
+
+			CoTestRespond(2, code, d.mid, d.mid, o, 3, (code == 0x44) ? "done" : NULL);
+		}
+		return;
+	}
+	if(server.separate)
+	{
+		CoTestRespond(2, 0, d.mid, 0, NULL, 0, NULL);								//!< Empty ACK, no token
+		queue[queued - 1][0] = 0x60;
+		queuelen[queued - 1] = 4;
+		CoTestRespond(0, 0x45, 0x7000, d.mid, changed, sizeof(changed), "later");	//!< 2.05 Content, own message ID
+		return;
+	}
+	CoTestRespond(2, 0x44, d.mid, d.mid, changed, sizeof(changed), "ok");
+}
+//===================================
+
+//===================================
+/**
+* @brief				: TCP/IP toolkit stand-in, See SIM800x_TCPIP.h
+*/
+SIM800x_APIStatusType SIM800xTCPIPConnect(uint8_t n, SIM800xTCPIPModeType mode, const char* host, uint16_t port, uint8_t* rxbuf, uint16_t rxsize,
+										  uint32_t tout, uint16_t* errcode)
+{
+	*errcode = 0;
+	return ((mode == TCPIP_UDP) && (port == 5683)) ? SIM800X_OK : SIM800X_ERROR;
+}
+
+SIM800x_APIStatusType SIM800xTCPIPSend(uint8_t n, const uint8_t* data, uint16_t cnt, uint32_t tout, uint16_t* errcode)
+{
+	*errcode = 0;
+	CoTestServe(data, cnt);
+	return SIM800X_OK;
+}
+
+uint16_t SIM800xTCPIPRead(uint8_t n, uint8_t* data, uint16_t size)
+{
+	uint16_t len;
+
+	if(!queued)
+	{
+		wait(CO_TEST_READ_TIME);
+		return 0;
+	}
+	len = (queuelen[0] < size) ? queuelen[0] : size;
+	memcpy(data, queue[0], len);
+	if(poison)
+		memset(&data[len], 0xD1, size - len);										//!< Options past the end
+	memmove(queue[0], queue[1], sizeof(queue[0]) * (CO_TEST_QUEUE - 1));
+	memmove(queuelen, &queuelen[1], sizeof(queuelen[0]) * (CO_TEST_QUEUE - 1));
+	queued--;
+	return len;
+}
+
+SIM800x_APIStatusType SIM800xTCPIPClose(uint8_t n, uint16_t* errcode)
+{
+	*errcode = 0;
+	return SIM800X_OK;
+}
+//===================================
+
+//===================================
+static void CoTestResponse(uint16_t msgid, uint8_t code, const uint8_t* payload, uint16_t len)
+{
+	responses++;
+	responseid = msgid;
+	responsecode = code;
+	responselen = len;
+	if(payload && (len <= sizeof(responsepayload)))
+		memcpy(responsepayload, payload, len);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Start a scenario
+*/
+static void CoTestReset(void)
+{
+	uint16_t e;
+
+	memset(&server, 0, sizeof(server));
+	server.reject = -1;
+	queued = 0;
+	responses = 0;
+	SIM800xCoAPClose(&e);															//!< Previous scenario dropped
+	SIM800xCoAPOpen(2, "coap.example.org", 5683, 1000, &e);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Exact encoding of requests, piggybacked and separate responses
+*/
+static void CoTestEncoding(void)
+{
+	static const uint8_t non[] =
+		"\x52\x02\0\0\0\0" "\xB7" "sensors" "\x04" "temp" "\x11\x32" "\xFF" "{\"t\":21}";
+	static const uint8_t con[] =
+		"\x42\x03\0\0\0\0" "\xB1" "a" "\x0D\x0E" "very-long-path-segment-here" "\x11\x3C" "\xFF" "x";
+	static const uint8_t text[] = "\x42\x01\0\0\0\0" "\xB1" "r" "\x10";
+	uint8_t ref[sizeof(con)];
+	uint16_t e, id;
+
+	CoTestReset();
+	TEST_CHECK(!SIM800xCoAPRequest(COAP_POST, "/sensors/temp", COAP_FORMAT_JSON, (const uint8_t *)"{\"t\":21}", 8, COAP_NON, &id, 1000, &e));
+	memcpy(ref, non, sizeof(non) - 1);
+	ref[2] = ref[4] = (uint8_t)(id >> 8);
+	ref[3] = ref[5] = (uint8_t)id;
+	TEST_CHECK((server.lastlen == (sizeof(non) - 1)) && !memcmp(server.last, ref, server.lastlen) && !SIM800xCoAPPending());
+	//---------
+	TEST_CHECK(!SIM800xCoAPRequest(COAP_PUT, "a/very-long-path-segment-here", COAP_FORMAT_CBOR, (const uint8_t *)"x", 1, COAP_CON, &id, 1000, &e));
+	memcpy(ref, con, sizeof(con) - 1);
+	ref[2] = ref[4] = (uint8_t)(id >> 8);
+	ref[3] = ref[5] = (uint8_t)id;
+	TEST_CHECK((server.lastlen == (sizeof(con) - 1)) && !memcmp(server.last, ref, server.lastlen) && (SIM800xCoAPPending() == 1));
+	SIM800xCoAPPoll();
+	TEST_CHECK(!SIM800xCoAPPending() && (responses == 1) && (responseid == id) && (responsecode == 0x44));
+	TEST_CHECK((responselen == 2) && !memcmp(responsepayload, "ok", 2));
+	//---------
+	TEST_CHECK(!SIM800xCoAPRequest(COAP_GET, "r", COAP_FORMAT_TEXT, NULL, 0, COAP_CON, &id, 1000, &e));
+	memcpy(ref, text, sizeof(text) - 1);
+	ref[2] = ref[4] = (uint8_t)(id >> 8);
+	ref[3] = ref[5] = (uint8_t)id;
+	TEST_CHECK((server.lastlen == (sizeof(text) - 1)) && !memcmp(server.last, ref, server.lastlen));
+	SIM800xCoAPPoll();
+	//---------
+	server.separate = 1;
+	responses = 0;
+	TEST_CHECK(!SIM800xCoAPRequest(COAP_GET, "r", COAP_FORMAT_NONE, NULL, 0, COAP_CON, &id, 1000, &e));
+	SIM800xCoAPPoll();
+	TEST_CHECK(!SIM800xCoAPPending() && (responses == 1) && (responseid == id) && (responsecode == 0x45));
+	TEST_CHECK((responselen == 5) && !memcmp(responsepayload, "later", 5));
+	TEST_CHECK((server.acks == 1) && (server.emptymid == 0x7000) && !server.violations);	//!< Separate response acknowledged
+	//---------
+	TEST_CHECK(SIM800xCoAPRequest(COAP_GET, "0123456789012345678901234567890123456789012345678901234567890123456789", COAP_FORMAT_NONE,
+								  NULL, 0, COAP_CON, &id, 1000, &e) == SIM800X_ERROR);
+	TEST_CHECK(SIM800xCoAPRequest(COAP_POST, "r", COAP_FORMAT_NONE, NULL, 4, COAP_CON, &id, 1000, &e) == SIM800X_ERROR);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Server messages: resets, duplicates, requests, pings and malformed options
+*/
+static void CoTestParser(void)
+{
+	static const struct
+	{
+		const char*	msg;
+		uint8_t		len;
+	}malformed[] =
+	{
+		{"\x62\x44\0\0\0\0" "\xD1", 7},										//!< Extended delta missing
+		{"\x62\x44\0\0\0\0" "\x1D", 7},										//!< Extended length missing
+		{"\x62\x44\0\0\0\0" "\xE1\x01", 8},									//!< 2-byte extended delta cut
+		{"\x62\x44\0\0\0\0" "\x1E\x01", 8},									//!< 2-byte extended length cut
+		{"\x62\x44\0\0\0\0" "\x14" "abc", 10},								//!< Value past the datagram
+		{"\x62\x44\0\0\0\0" "\x1D\x00" "abcdefghijkl", 20},					//!< Extended value past the datagram
+		{"\x62\x44\0\0\0\0" "\x1E\xFF\xFF" "abc", 12},						//!< Large length, position not wrapped
+		{"\x62\x44\0\0\0\0" "\xF0", 7},										//!< Reserved delta
+		{"\x62\x44\0\0\0\0" "\x1F", 7},										//!< Reserved length
+		{"\x62\x44\0\0\0", 5},												//!< Token cut
+		{"\x69\x44\0\0\0\0\0\0\0\0\0\0\0", 13},								//!< Token length 9
+		{"\x82\x44\0\0\0\0", 6},											//!< Version 2
+	};
+	uint8_t m[32], i;
+	uint16_t e, id;
+
+	CoTestReset();
+	server.silent = 1;
+	TEST_CHECK(!SIM800xCoAPRequest(COAP_GET, "r", COAP_FORMAT_NONE, NULL, 0, COAP_CON, &id, 1000, &e));
+	poison = 1;
+	for(i = 0; i < (sizeof(malformed) / sizeof(malformed[0])); i++)
+	{
+		memcpy(m, malformed[i].msg, malformed[i].len);
+		m[2] = m[4] = (uint8_t)(id >> 8);
+		m[3] = m[5] = (uint8_t)id;
+		CoTestQueue(m, malformed[i].len);
+		SIM800xCoAPPoll();
+		if(responses || (SIM800xCoAPPending() != 1))
+			break;
+	}
+	if(i < (sizeof(malformed) / sizeof(malformed[0])))
+		printf("malformed %u delivered\n", (unsigned)i);
+	TEST_CHECK(i == (sizeof(malformed) / sizeof(malformed[0])));
+	CoTestRespond(2, 0x44, (uint16_t)(id + 1), id, NULL, 0, "x");				//!< Unknown message ID
+	SIM800xCoAPPoll();
+	TEST_CHECK(!responses && (SIM800xCoAPPending() == 1));
+	memcpy(m, "\x62\x44\0\0\0\0" "\xD1\x0E\x0C" "\xE0\x00\x00" "\xFF" "ok", 15);	//!< Block1, then option 296 (2-byte delta)
+	m[2] = m[4] = (uint8_t)(id >> 8);
+	m[3] = m[5] = (uint8_t)id;
+	CoTestQueue(m, 15);
+	CoTestQueue(m, 15);																//!< Duplicate
+	SIM800xCoAPPoll();
+	poison = 0;
+	TEST_CHECK((responses == 1) && (responsecode == 0x44) && (responselen == 2) && !memcmp(responsepayload, "ok", 2));
+	TEST_CHECK(!SIM800xCoAPPending());
+	//---------
+	TEST_CHECK(!SIM800xCoAPRequest(COAP_GET, "r", COAP_FORMAT_NONE, NULL, 0, COAP_CON, &id, 1000, &e));
+	CoTestRespond(3, 0, id, 0, NULL, 0, NULL);										//!< Reset
+	queue[queued - 1][0] = 0x70;
+	queuelen[queued - 1] = 4;
+	SIM800xCoAPPoll();
+	TEST_CHECK((responses == 2) && (responseid == id) && !responsecode && !SIM800xCoAPPending());
+	CoTestRespond(0, 0x01, 0x1234, 0x1234, NULL, 0, NULL);							//!< Request from the server
+	SIM800xCoAPPoll();
+	TEST_CHECK((server.rsts == 1) && (server.emptymid == 0x1234) && (responses == 2));
+	CoTestRespond(0, 0, 0x1235, 0, NULL, 0, NULL);									//!< Ping
+	queue[queued - 1][0] = 0x40;
+	queuelen[queued - 1] = 4;
+	SIM800xCoAPPoll();
+	TEST_CHECK((server.rsts == 2) && (server.emptymid == 0x1235) && !server.violations);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Retransmissions with exponential back-off, give-up and the pending table
+*/
+static void CoTestRetransmissions(void)
+{
+	uint32_t t;
+	uint16_t e, id, i;
+	uint8_t k;
+
+	CoTestReset();
+	server.silent = 1;
+	TEST_CHECK(!SIM800xCoAPRequest(COAP_GET, "r", COAP_FORMAT_NONE, NULL, 0, COAP_CON, &id, 1000, &e));
+	for(i = 0; (i < 2000) && SIM800xCoAPPending(); i++)
+		SIM800xCoAPPoll();
+	TEST_CHECK((server.received == (1 + CONFIG_COAP_MAX_RETRANSMIT)) && (responses == 1) && (responseid == id) && !responsecode);
+	t = server.times[1] - server.times[0];
+	TEST_CHECK((t >= CONFIG_COAP_ACK_TIMEOUT) && (t <= (CONFIG_COAP_ACK_TIMEOUT * 3 / 2 + CO_TEST_READ_TIME)));
+	for(k = 2; k <= CONFIG_COAP_MAX_RETRANSMIT; k++)								//!< Time-out doubled each time
+	{
+		t = server.times[k] - server.times[k - 1];
+		if(((t + CO_TEST_READ_TIME + 2) < (2 * (server.times[k - 1] - server.times[k - 2]))) ||
+		   (t > (2 * (server.times[k - 1] - server.times[k - 2]) + 2)))
+			break;																	//!< Within a read time, each interval rounded up
+	}
+	TEST_CHECK(k > CONFIG_COAP_MAX_RETRANSMIT);
+	//---------
+	for(k = 0; k < CONFIG_COAP_MAX_PENDING; k++)
+		TEST_CHECK(!SIM800xCoAPRequest(COAP_GET, "r", COAP_FORMAT_NONE, NULL, 0, COAP_CON, &id, 1000, &e));
+	TEST_CHECK(SIM800xCoAPRequest(COAP_GET, "r", COAP_FORMAT_NONE, NULL, 0, COAP_CON, &id, 1000, &e) == SIM800X_BUSY);
+	TEST_CHECK(!SIM800xCoAPRequest(COAP_GET, "r", COAP_FORMAT_NONE, NULL, 0, COAP_NON, &id, 1000, &e));	//!< NON not kept
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Block1 transfers: sequence, lost ACK, rejected block and silent server
+*/
+static void CoTestBlock1(void)
+{
+	static const uint8_t first[] = "\xB2" "up" "\x11\x2A" "\xD1\x02\x0C" "\xFF";
+	uint16_t e, id, i;
+
+	for(i = 0; i < sizeof(big); i++)
+		big[i] = (uint8_t)(i * 7 + 1);
+	CoTestReset();
+	TEST_CHECK(!SIM800xCoAPRequest(COAP_POST, "up", COAP_FORMAT_OCTET_STREAM, big, 700, COAP_CON, &id, 10000, &e));
+	TEST_CHECK((server.received == 3) && (server.blocks == 3) && (server.bodylen == 700) && !memcmp(server.body, big, 700) && !server.violations);
+	TEST_CHECK((responses == 1) && (responseid == id) && (responsecode == 0x44) && !memcmp(responsepayload, "done", 4));
+	TEST_CHECK((server.lastlen == (6 + 8 + 1 + 188)) && (server.last[6 + 7] == 0x24));	//!< Last block: number 2, no more, 256 bytes
+	//---------
+	CoTestReset();
+	server.drop = 2;																//!< First block lost twice
+	TEST_CHECK(!SIM800xCoAPRequest(COAP_PUT, "up", COAP_FORMAT_OCTET_STREAM, big, 512, COAP_CON, &id, 60000, &e));
+	TEST_CHECK((server.received == 4) && (server.blocks == 2) && (server.bodylen == 512) && !memcmp(server.body, big, 512) && !server.violations);
+	//---------
+	CoTestReset();
+	server.reject = 1;
+	TEST_CHECK(SIM800xCoAPRequest(COAP_POST, "up", COAP_FORMAT_OCTET_STREAM, big, 1000, COAP_CON, &id, 10000, &e) == SIM800X_ERROR);
+	TEST_CHECK((server.received == 2) && (responses == 1) && (responsecode == 0x8D));
+	//---------
+	CoTestReset();
+	server.silent = 1;
+	TEST_CHECK(SIM800xCoAPRequest(COAP_POST, "up", COAP_FORMAT_OCTET_STREAM, big, 300, COAP_CON, &id, 600000, &e) == SIM800X_ERROR);
+	TEST_CHECK((server.received == (1 + CONFIG_COAP_MAX_RETRANSMIT)) && !memcmp(&server.last[6], first, sizeof(first) - 1));
+	CoTestReset();
+	server.silent = 1;
+	TEST_CHECK(SIM800xCoAPRequest(COAP_POST, "up", COAP_FORMAT_OCTET_STREAM, big, 300, COAP_CON, &id, 5000, &e) == SIM800X_TIME_OUT);
+}
+//===================================
+
+//===================================
+int main(void)
+{
+	SIM800xCoAPSetResponseCallBack(CoTestResponse);
+	CoTestEncoding();
+	CoTestParser();
+	CoTestRetransmissions();
+	CoTestBlock1();
+	return TestEnd();
+}
+//===================================
@@ -0,0 +1,293 @@
+/**
+*************************************************************************
+*  	@file: FOTATest.c
+*
+*  	@brief: Firmware over-the-air update pipeline test
+*  	@brief: SIM800x_FOTA.c against a simulated, RAM-backed, update slot flash.
+*
+*	@note	The simulated flash behaves like the STM32F4 one seen through SIM800xFOTAHALFlash:
+*			an erase or each programmed word stays busy for SIM_FLASH_POLLS status polls,
+*			programmed data is read from the caller's buffer one word at a time, and
+*			programming a word not erased is an error.
+*
+*	@note	Covered: SIM800xFOTABegin() arguments and erases, SIM800xFOTAWrite() with random
+*			chunks, ranges sent again and gaps, SIM800xFOTASync() and resuming after a
+*			reset, SIM800xFOTAFinish() digest check and boot record, flash errors.
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "SIM800x_FOTA.h"
+#include "SIM800x_CRC.h"
+#include "SIM800x_CONFIG.h"
+#include "Test.h"
+//==========================================================================//
+
+//==========================================================================//
+//								Test constants								//
+//==========================================================================//
+#define SIM_SLOT_SIZE			((uint32_t)CONFIG_FOTA_SLOT_SECTORS * CONFIG_FOTA_SECTOR_SIZE)
+#define SIM_RECORD_OFFSET		(SIM_SLOT_SIZE - FOTA_RECORD_SIZE)
+#define SIM_FLASH_POLLS			3			//!< Status polls per erase and per programmed word
+#define SIM_NO_FAILURE			0xFFFFFFFFUL
+#define FOTA_TEST_SIZE			200000		//!< Image over two sectors, the record sector is erased on its own
+#define FOTA_TEST_RANGE			4096		//!< Resumed downloads restart at a range boundary
+//==========================================================================//
+
+//===================================
+static uint8_t simslot[SIM_SLOT_SIZE];
+static SIM800xFOTAFlashStatusType simstatus = FOTA_FLASH_READY;
+static const uint8_t* simdata;				//!< Next word to program, read when it is programmed
+static uint32_t simoffset;
+static uint16_t simleft;
+static uint32_t simpolls;					//!< Polls left for the current erase or word
+static uint32_t simerases;					//!< Number of erases started
+static uint8_t simeraseallowed = 1;			//!< Erases are only expected from SIM800xFOTABegin()
+static uint32_t simbadops;					//!< Operations started while busy, or erases while writing
+static uint32_t simfailoffset = SIM_NO_FAILURE;	//!< Offset of a word failing to program
+static uint8_t image[FOTA_TEST_SIZE];
+static uint8_t digest[FOTA_DIGEST_SIZE];
+//===================================
+
+//===================================
+static uint8_t SimErase(uint8_t sector)
+{
+	if((simstatus == FOTA_FLASH_BUSY) || !simeraseallowed || (sector >= CONFIG_FOTA_SLOT_SECTORS))
+	{
+		simbadops++;
+		return 0;
+	}
+	memset(&simslot[sector * CONFIG_FOTA_SECTOR_SIZE], 0xFF, CONFIG_FOTA_SECTOR_SIZE);
+	simerases++;
+	simleft = 0;
+	simpolls = SIM_FLASH_POLLS;
+	simstatus = FOTA_FLASH_BUSY;
+	return 1;
+}
+//===================================
+
+//===================================
+static uint8_t SimProgram(uint32_t offset, const uint8_t* data, uint16_t len)
+{
+	if((simstatus == FOTA_FLASH_BUSY) || !len || (len & 3) || (offset & 3) || ((offset + len) > SIM_SLOT_SIZE))
+	{
+		simbadops++;
+		return 0;
+	}
+	simdata = data;
+	simoffset = offset;
+	simleft = len;
+	simpolls = SIM_FLASH_POLLS;
+	simstatus = FOTA_FLASH_BUSY;
+	return 1;
+}
+//===================================
+
+//===================================
+static SIM800xFOTAFlashStatusType SimStatus(void)
+{
+	static const uint8_t erased[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+
+	if((simstatus != FOTA_FLASH_BUSY) || --simpolls)
+		return simstatus;
+	if(!simleft)													//!< Erase completed
+		return simstatus = FOTA_FLASH_READY;
+	if((simoffset == simfailoffset) || memcmp(&simslot[simoffset], erased, 4))
+		return simstatus = FOTA_FLASH_ERROR;
+	memcpy(&simslot[simoffset], simdata, 4);
+	simdata += 4;
+	simoffset += 4;
+	simleft = (uint16_t)(simleft - 4);
+	simpolls = SIM_FLASH_POLLS;
+	if(!simleft)
+		simstatus = FOTA_FLASH_READY;
+	return simstatus;
+}
+//===================================
+
+//===================================
+static const SIM800xFOTAFlashType simflash =
+{
+	SimErase,
+	SimProgram,
+	SimStatus,
+	simslot
+};
+//===================================
+
+//===================================
+/**
+* @brief				: Reset the simulated flash to a dirty, not erased, slot
+*/
+static void SimReset(void)
+{
+	memset(simslot, 0x5A, sizeof(simslot));
+	simstatus = FOTA_FLASH_READY;
+	simerases = 0;
+	simeraseallowed = 1;
+	simbadops = 0;
+	simfailoffset = SIM_NO_FAILURE;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Feed image[from...to) in random chunks, sometimes sending data again
+* @retval  				: Last SIM800xFOTAWrite() result
+*/
+static uint8_t FOTATestFeed(uint32_t from, uint32_t to)
+{
+	uint32_t offset = from, len;
+
+	while(offset < to)
+	{
+		len = 1 + (uint32_t)(rand() % 700);
+		if(len > (to - offset))
+			len = to - offset;
+		if(!SIM800xFOTAWrite(&image[offset], (uint16_t)len, offset))
+			return 0;
+		if(!(rand() % 16) && (offset > 100))						//!< Range sent again after a retry
+			offset -= (uint32_t)(rand() % 100);
+		else
+			offset += len;
+		SIM800xFOTAPoll();
+	}
+	return 1;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Check the slot holds the image and its boot record
+*/
+static void FOTATestCheckSlot(void)
+{
+	uint32_t word;
+
+	TEST_CHECK(!memcmp(simslot, image, FOTA_TEST_SIZE));
+	memcpy(&word, &simslot[SIM_RECORD_OFFSET], 4);
+	TEST_CHECK(word == 0x41544F46UL);
+	memcpy(&word, &simslot[SIM_RECORD_OFFSET + 4], 4);
+	TEST_CHECK(word == FOTA_TEST_SIZE);
+	TEST_CHECK(!memcmp(&simslot[SIM_RECORD_OFFSET + 8], digest, FOTA_DIGEST_SIZE));
+	memcpy(&word, &simslot[SIM_RECORD_OFFSET + 8 + FOTA_DIGEST_SIZE], 4);
+	TEST_CHECK(word == 0xFFFFFFFFUL);								//!< Not installed yet
+}
+//===================================
+
+//===================================
+static void FOTATestBegin(void)
+{
+	SimReset();
+	TEST_CHECK(SIM800xFOTABegin(NULL, FOTA_TEST_SIZE, 0) == SIM800X_ERROR);
+	TEST_CHECK(SIM800xFOTABegin(&simflash, 0, 0) == SIM800X_ERROR);
+	TEST_CHECK(SIM800xFOTABegin(&simflash, CONFIG_FOTA_APP_SIZE + 1, 0) == SIM800X_ERROR);
+	TEST_CHECK(SIM800xFOTABegin(&simflash, FOTA_TEST_SIZE, CONFIG_FOTA_BUFFER_SIZE / 2) == SIM800X_ERROR);
+	TEST_CHECK(SIM800xFOTABegin(&simflash, 1000, 1024) == SIM800X_ERROR);
+	TEST_CHECK(simerases == 0);
+	TEST_CHECK(SIM800xFOTABegin(&simflash, FOTA_TEST_SIZE, 0) == SIM800X_OK);
+	TEST_CHECK(simerases == 3);										//!< Two image sectors and the record sector
+	TEST_CHECK((simslot[0] == 0xFF) && (simslot[SIM_SLOT_SIZE - 1] == 0xFF));
+	TEST_CHECK(simstatus == FOTA_FLASH_READY);
+}
+//===================================
+
+//===================================
+static void FOTATestUpdate(void)
+{
+	uint8_t wrong[FOTA_DIGEST_SIZE];
+
+	SimReset();
+	TEST_CHECK(SIM800xFOTABegin(&simflash, FOTA_TEST_SIZE, 0) == SIM800X_OK);
+	simeraseallowed = 0;
+	TEST_CHECK(FOTATestFeed(0, FOTA_TEST_SIZE / 2));
+	TEST_CHECK(!SIM800xFOTAWrite(image, 10, FOTA_TEST_SIZE / 2 + 10));	//!< Gap
+	TEST_CHECK(!SIM800xFOTAWrite(image, 10, FOTA_TEST_SIZE - 5));		//!< Past the end
+	TEST_CHECK(SIM800xFOTAFinish(digest) == SIM800X_ERROR);			//!< Incomplete
+	TEST_CHECK(FOTATestFeed(FOTA_TEST_SIZE / 2, FOTA_TEST_SIZE));
+	memcpy(wrong, digest, sizeof(wrong));
+	wrong[0] ^= 1;
+	TEST_CHECK(SIM800xFOTAFinish(wrong) == SIM800X_ERROR);
+	TEST_CHECK(simslot[SIM_RECORD_OFFSET] == 0xFF);					//!< No record for a wrong image
+	TEST_CHECK(SIM800xFOTAFinish(digest) == SIM800X_OK);
+	TEST_CHECK(simbadops == 0);
+	FOTATestCheckSlot();
+}
+//===================================
+
+//===================================
+static void FOTATestResume(void)
+{
+	uint32_t saved, erases;
+
+	SimReset();
+	TEST_CHECK(SIM800xFOTABegin(&simflash, FOTA_TEST_SIZE, 0) == SIM800X_OK);
+	simeraseallowed = 0;
+	TEST_CHECK(FOTATestFeed(0, 150001));
+	saved = SIM800xFOTASync();										//!< Saved, then power lost
+	TEST_CHECK((saved % CONFIG_FOTA_BUFFER_SIZE) == 0);
+	TEST_CHECK((saved > 150001 - 2 * CONFIG_FOTA_BUFFER_SIZE) && (saved <= 150001));
+	TEST_CHECK(!memcmp(simslot, image, saved));
+	//---------
+	simeraseallowed = 1;
+	erases = simerases;
+	TEST_CHECK(SIM800xFOTABegin(&simflash, FOTA_TEST_SIZE, saved) == SIM800X_OK);
+	TEST_CHECK(simerases == erases + 1);							//!< Record sector only, the second sector holds data
+	TEST_CHECK(!memcmp(simslot, image, saved));
+	simeraseallowed = 0;
+	TEST_CHECK(FOTATestFeed((saved / FOTA_TEST_RANGE) * FOTA_TEST_RANGE, FOTA_TEST_SIZE));
+	TEST_CHECK(SIM800xFOTAFinish(digest) == SIM800X_OK);
+	TEST_CHECK(simbadops == 0);
+	FOTATestCheckSlot();
+	//---------
+	SimReset();																//!< Interrupted in the first sector
+	TEST_CHECK(SIM800xFOTABegin(&simflash, FOTA_TEST_SIZE, 0) == SIM800X_OK);
+	TEST_CHECK(FOTATestFeed(0, 5000));
+	saved = SIM800xFOTASync();
+	erases = simerases;
+	TEST_CHECK(SIM800xFOTABegin(&simflash, FOTA_TEST_SIZE, saved) == SIM800X_OK);
+	TEST_CHECK(simerases == erases + 2);
+	TEST_CHECK(FOTATestFeed((saved / FOTA_TEST_RANGE) * FOTA_TEST_RANGE, FOTA_TEST_SIZE));
+	TEST_CHECK(SIM800xFOTAFinish(digest) == SIM800X_OK);
+	FOTATestCheckSlot();
+}
+//===================================
+
+//===================================
+static void FOTATestFlashError(void)
+{
+	SimReset();
+	TEST_CHECK(SIM800xFOTABegin(&simflash, FOTA_TEST_SIZE, 0) == SIM800X_OK);
+	simfailoffset = 70000;
+	TEST_CHECK(!FOTATestFeed(0, FOTA_TEST_SIZE));
+	TEST_CHECK(SIM800xFOTASync() == 0);
+	TEST_CHECK(SIM800xFOTAPoll() == FOTA_FLASH_ERROR);
+	TEST_CHECK(SIM800xFOTAFinish(digest) == SIM800X_ERROR);
+	TEST_CHECK(simslot[SIM_RECORD_OFFSET] == 0xFF);
+}
+//===================================
+
+//===================================
+int main(void)
+{
+	SIM800xMD5Type md5;
+	uint32_t i;
+
+	srand(1);
+	for(i = 0; i < FOTA_TEST_SIZE; i++)
+		image[i] = (uint8_t)rand();
+	SIM800xMD5Init(&md5);
+	SIM800xMD5Update(&md5, image, FOTA_TEST_SIZE);
+	SIM800xMD5Final(&md5, digest);
+	FOTATestBegin();
+	FOTATestUpdate();
+	FOTATestResume();
+	FOTATestFlashError();
+	return TestEnd();
+}
+//===================================
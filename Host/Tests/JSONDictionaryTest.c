@@ -0,0 +1,192 @@
+/**
+*************************************************************************
+*  	@file: JSONDictionaryTest.c
+*
+*  	@brief: JSON key dictionary test
+*  	@brief: Records built with and without the dictionary of JSONBuilder.h must expand
+*			to the same text with JsonExpandKeys().
+*
+*	@note	The records mix aliased keys, indexed keys, keys not in the dictionary,
+*			nested objects and arrays, and string values equal to an alias, which must
+*			not be replaced.
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "JSONDictionary.h"
+#include "Test.h"
+//==========================================================================//
+
+//==========================================================================//
+//								Test constants								//
+//==========================================================================//
+#define DICTIONARY_TEST_SIZE	512			//!< Record buffer size
+#define DICTIONARY_TEST_TOKENS	64			//!< Expansion tokens
+#define DICTIONARY_TEST_ROUNDS	2000		//!< Random records
+//==========================================================================//
+
+//===================================
+static const JsonKeyAlias keys[] =
+{
+	{"Engine Temperature (C)",	NULL},		//!< "0"
+	{"RPM",						NULL},		//!< "1"
+	{"Vehicle Speed (MPH)",		"v"},
+	{"Fuel Level (%)",			NULL},		//!< "3"
+	{"Battery (V)",				"bat"},
+};
+static const JsonDictionary dictionary = {3, sizeof(keys) / sizeof(keys[0]), keys};
+static char full[DICTIONARY_TEST_SIZE];
+static char small[DICTIONARY_TEST_SIZE];
+static char expanded[DICTIONARY_TEST_SIZE];
+static JsonToken tokens[DICTIONARY_TEST_TOKENS];
+//===================================
+
+//===================================
+/**
+* @brief				: Build a record, nested containers and keys out of the dictionary if nested is set
+* @retval  				: Record length, 0 if it did not fit
+*/
+static uint16_t DictionaryTestRecord(char * buf, uint16_t size, const int32_t * v, uint8_t nested)
+{
+	JsonBuilder b;
+
+	JsonBuilderInit(&b, buf, size);
+	JsonBuilderBeginObject(&b, NULL);
+	JsonBuilderAddInt(&b, "Engine Temperature (C)", v[0]);
+	JsonBuilderAddUInt(&b, "RPM", (uint32_t)v[1]);
+	if(nested)
+	{
+		JsonBuilderAddString(&b, "Unit", "bat");
+		JsonBuilderBeginObject(&b, "Trip");
+		JsonBuilderAddFixed(&b, "Vehicle Speed (MPH)", v[2], 1);
+		JsonBuilderAddInt(&b, "7", v[3]);
+		JsonBuilderEnd(&b);
+		JsonBuilderBeginArray(&b, "Cells");
+		JsonBuilderAddString(&b, NULL, "RPM");
+		JsonBuilderAddString(&b, NULL, "1");
+		JsonBuilderBeginObject(&b, NULL);
+		JsonBuilderAddFixed(&b, "Battery (V)", v[4], 3);
+		JsonBuilderEnd(&b);
+		JsonBuilderEnd(&b);
+	}
+	JsonBuilderAddFixed(&b, "Vehicle Speed (MPH)", v[2], 1);
+	JsonBuilderAddInt(&b, "Fuel Level (%)", v[3]);
+	JsonBuilderAddFixed(&b, "Battery (V)", v[4], 3);
+	JsonBuilderEnd(&b);
+	return JsonBuilderFinish(&b) ? 0 : b.len;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Build a record with and without the dictionary and expand the short one
+* @retval  				: 1 if the expansion is identical to the full record
+*/
+static uint8_t DictionaryTestExpand(const int32_t * v, uint8_t nested)
+{
+	uint16_t fl, sl, el = 0;
+
+	JsonBuilderSetDictionary(NULL);
+	fl = DictionaryTestRecord(full, sizeof(full), v, nested);
+	JsonBuilderSetDictionary(&dictionary);
+	sl = DictionaryTestRecord(small, sizeof(small), v, nested);
+	JsonBuilderSetDictionary(NULL);
+	if(!fl || !sl || (sl >= fl) || strncmp(small, "{\"" JSON_DICTIONARY_KEY "\":3,", 8))
+		return 0;
+	if(JsonExpandKeys(&dictionary, small, sl, tokens, DICTIONARY_TEST_TOKENS, expanded, sizeof(expanded), &el))
+		return 0;
+	return (el == fl) && !strcmp(expanded, full);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Fixed records, exact texts
+*/
+static void DictionaryTestRecords(void)
+{
+	static const int32_t v[5] = {-30, 3500, 355, 50, 12345};
+
+	TEST_CHECK(DictionaryTestExpand(v, 0));
+	TEST_CHECK(!strcmp(small, "{\"$d\":3,\"0\":-30,\"1\":3500,\"v\":35.5,\"3\":50,\"bat\":12.345}"));
+	TEST_CHECK(DictionaryTestExpand(v, 1));
+	TEST_CHECK(!strcmp(small, "{\"$d\":3,\"0\":-30,\"1\":3500,\"Unit\":\"bat\",\"Trip\":{\"v\":35.5,\"7\":50},"
+							  "\"Cells\":[\"RPM\",\"1\",{\"bat\":12.345}],\"v\":35.5,\"3\":50,\"bat\":12.345}"));
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Version, token, output and builder limits
+*/
+static void DictionaryTestLimits(void)
+{
+	static const int32_t v[5] = {1, 2, 3, 4, 5};
+	static const char last[] = "{\"0\":1,\"$d\":3}";
+	JsonDictionary other = dictionary;
+	char buf[DICTIONARY_TEST_SIZE];
+	uint16_t sl, el, n;
+
+	TEST_CHECK(DictionaryTestExpand(v, 1));
+	sl = (uint16_t)strlen(small);
+	other.version = 4;
+	TEST_CHECK(JsonExpandKeys(&other, small, sl, tokens, DICTIONARY_TEST_TOKENS, expanded, sizeof(expanded), &el));
+	TEST_CHECK(JsonExpandKeys(&dictionary, small, sl, tokens, 8, expanded, sizeof(expanded), &el));
+	n = (uint16_t)(strlen(full) + 1);
+	TEST_CHECK(JsonExpandKeys(&dictionary, small, sl, tokens, DICTIONARY_TEST_TOKENS, expanded, (uint16_t)(n - 1), &el));
+	TEST_CHECK(!JsonExpandKeys(&dictionary, small, sl, tokens, DICTIONARY_TEST_TOKENS, expanded, n, &el) && !strcmp(expanded, full));
+	TEST_CHECK(!JsonExpandKeys(&dictionary, last, sizeof(last) - 1, tokens, DICTIONARY_TEST_TOKENS, expanded, sizeof(expanded), &el));
+	TEST_CHECK(!strcmp(expanded, "{\"Engine Temperature (C)\":1}"));
+	//---------
+	JsonBuilderSetDictionary(&dictionary);
+	for(n = 1; n <= (sl + 1); n++)													//!< Every buffer size, nothing past it
+	{
+		memset(buf, '#', sizeof(buf));
+		if((DictionaryTestRecord(buf, n, v, 1) != ((n > sl) ? sl : 0)) || (buf[n] != '#'))
+			break;
+	}
+	JsonBuilderSetDictionary(NULL);
+	TEST_CHECK(n > (sl + 1));
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Random records
+*/
+static void DictionaryTestRandom(void)
+{
+	int32_t v[5];
+	uint32_t k;
+
+	srand(1);
+	for(k = 0; k < DICTIONARY_TEST_ROUNDS; k++)
+	{
+		v[0] = rand() - RAND_MAX / 2;
+		v[1] = rand();
+		v[2] = rand() % 2000 - 1000;
+		v[3] = (k & 1) ? INT32_MIN : INT32_MAX;
+		v[4] = rand() - RAND_MAX / 2;
+		if(!DictionaryTestExpand(v, (uint8_t)(k & 1)))
+			break;
+	}
+	if(k < DICTIONARY_TEST_ROUNDS)
+		printf("record %u:\n%s\n%s\n", (unsigned)k, full, expanded);
+	TEST_CHECK(k == DICTIONARY_TEST_ROUNDS);
+}
+//===================================
+
+//===================================
+int main(void)
+{
+	DictionaryTestRecords();
+	DictionaryTestLimits();
+	DictionaryTestRandom();
+	return TestEnd();
+}
+//===================================
@@ -0,0 +1,167 @@
+/**
+*************************************************************************
+*  	@file: JSONSchemaTest.c
+*
+*  	@brief: Record schema test
+*  	@brief: JSON and CBOR serializers and decoders generated by JSONSchema.h for an example
+*			schema, against reference encodings and in random round trips.
+*
+*	@note	The reference CBOR encoding was decoded by hand against RFC 8949: map of 7,
+*			text keys (one with a 1-byte length), negative and 32-bit integers, true,
+*			and decimal fractions (tag 4) for the fixed-point fields.
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "JSONSchema.h"
+#include "Test.h"
+#include <limits.h>
+//==========================================================================//
+
+//==========================================================================//
+//								Test schema									//
+//==========================================================================//
+#define VEHICLE_RECORD(FIELD)														\
+	FIELD(INT,	temperature,	"Engine Temperature (C)")								\
+	FIELD(INT,	rpm,			"RPM")													\
+	FIELD(FIX1,	speed,			"Vehicle Speed (MPH)")									\
+	FIELD(INT,	fuel,			"Fuel Level (%)")										\
+	FIELD(UINT,	odometer,		"Odometer")												\
+	FIELD(BOOL,	ignition,		"Ignition")												\
+	FIELD(FIX3,	battery,		"A very long key name for the battery voltage reading")
+
+JSON_SCHEMA_DECLARE(VehicleRecord, VEHICLE_RECORD)
+JSON_SCHEMA_DEFINE(VehicleRecord, VEHICLE_RECORD)
+
+#define SCHEMA_TEST_ROUNDS		20000		//!< Random round trips
+//==========================================================================//
+
+//===================================
+static const VehicleRecord reference = {-30, 3500, 355, 50, 4294967295u, 1, -12345};
+static const char referencejson[] =
+	"{\"Engine Temperature (C)\":-30,\"RPM\":3500,\"Vehicle Speed (MPH)\":35.5,\"Fuel Level (%)\":50,"
+	"\"Odometer\":4294967295,\"Ignition\":true,\"A very long key name for the battery voltage reading\":-12.345}";
+static const char referencecbor[] =
+	"\xA7"
+	"\x76" "Engine Temperature (C)"	"\x38\x1D"
+	"\x63" "RPM"					"\x19\x0D\xAC"
+	"\x73" "Vehicle Speed (MPH)"	"\xC4\x82\x20\x19\x01\x63"
+	"\x6E" "Fuel Level (%)"			"\x18\x32"
+	"\x68" "Odometer"				"\x1A\xFF\xFF\xFF\xFF"
+	"\x68" "Ignition"				"\xF5"
+	"\x78\x34" "A very long key name for the battery voltage reading"	"\xC4\x82\x22\x39\x30\x38";
+//===================================
+
+//===================================
+static void SchemaTestReference(void)
+{
+	char json[VehicleRecord_JSON_SIZE];
+	uint8_t cbor[VehicleRecord_CBOR_SIZE];
+	VehicleRecord r;
+	uint16_t n, i;
+
+	n = VehicleRecordToJson(&reference, json, sizeof(json));
+	TEST_CHECK((n == (sizeof(referencejson) - 1)) && !strcmp(json, referencejson));
+	memset(&r, 0, sizeof(r));
+	TEST_CHECK(!VehicleRecordFromJson(&r, json, n) && !memcmp(&r, &reference, sizeof(r)));
+	n = VehicleRecordToCbor(&reference, cbor, sizeof(cbor));
+	TEST_CHECK((n == (sizeof(referencecbor) - 1)) && !memcmp(cbor, referencecbor, n));
+	memset(&r, 0, sizeof(r));
+	TEST_CHECK(!VehicleRecordFromCbor(&r, cbor, n) && !memcmp(&r, &reference, sizeof(r)));
+	for(i = 0; i < n; i++)														//!< Every truncation refused
+	{
+		if(!VehicleRecordFromCbor(&r, cbor, i))
+			break;
+	}
+	TEST_CHECK(i == n);
+	TEST_CHECK(!VehicleRecordToJson(&reference, json, sizeof(json) - 1));		//!< Worst case checked once
+	TEST_CHECK(!VehicleRecordToCbor(&reference, cbor, sizeof(cbor) - 1));
+}
+//===================================
+
+//===================================
+static void SchemaTestDecoders(void)
+{
+	static const char reordered[] =
+		"{\"Ignition\":false,\"A very long key name for the battery voltage reading\":1.5,\"Odometer\":5,"
+		"\"Fuel Level (%)\":4,\"Vehicle Speed (MPH)\":3,\"RPM\":-2,\"Engine Temperature (C)\":1}";
+	static const char decimals[] =
+		"{\"Engine Temperature (C)\":1,\"RPM\":2,\"Vehicle Speed (MPH)\":3.25,\"Fuel Level (%)\":4,"
+		"\"Odometer\":5,\"Ignition\":false,\"A very long key name for the battery voltage reading\":1}";
+	static const char missing[] =
+		"{\"Engine Temperature (C)\":1,\"RPM\":2,\"Vehicle Speed (MPH)\":3,\"Fuel Level (%)\":4,"
+		"\"Odometer\":5,\"Ignition\":false}";
+	static const char types[] =
+		"{\"Engine Temperature (C)\":1,\"RPM\":2,\"Vehicle Speed (MPH)\":3,\"Fuel Level (%)\":4,"
+		"\"Odometer\":-5,\"Ignition\":false,\"A very long key name for the battery voltage reading\":1}";
+	static const char range[] =
+		"{\"Engine Temperature (C)\":2147483648,\"RPM\":2,\"Vehicle Speed (MPH)\":3,\"Fuel Level (%)\":4,"
+		"\"Odometer\":5,\"Ignition\":false,\"A very long key name for the battery voltage reading\":1}";
+	uint8_t cbor[sizeof(referencecbor)];
+	VehicleRecord r;
+
+	TEST_CHECK(!VehicleRecordFromJson(&r, reordered, sizeof(reordered) - 1));	//!< Any key order
+	TEST_CHECK((r.temperature == 1) && (r.rpm == -2) && (r.speed == 30) && (r.fuel == 4) && (r.odometer == 5) &&
+			   (r.ignition == 0) && (r.battery == 1500));
+	TEST_CHECK(VehicleRecordFromJson(&r, decimals, sizeof(decimals) - 1));		//!< More decimals than the field
+	TEST_CHECK(VehicleRecordFromJson(&r, missing, sizeof(missing) - 1));
+	TEST_CHECK(VehicleRecordFromJson(&r, types, sizeof(types) - 1));
+	TEST_CHECK(VehicleRecordFromJson(&r, range, sizeof(range) - 1));
+	memcpy(cbor, referencecbor, sizeof(cbor));
+	cbor[3] = 'X';																//!< Other key
+	TEST_CHECK(VehicleRecordFromCbor(&r, cbor, sizeof(cbor) - 1));
+	memcpy(cbor, referencecbor, sizeof(cbor));
+	cbor[0] = CBOR_MAP | 6;
+	TEST_CHECK(VehicleRecordFromCbor(&r, cbor, sizeof(cbor) - 1));
+}
+//===================================
+
+//===================================
+static void SchemaTestRoundTrips(void)
+{
+	char json[VehicleRecord_JSON_SIZE];
+	uint8_t cbor[VehicleRecord_CBOR_SIZE];
+	VehicleRecord r, d;
+	uint32_t k;
+	uint16_t n;
+
+	srand(1);
+	for(k = 0; k < SCHEMA_TEST_ROUNDS; k++)
+	{
+		memset(&r, 0, sizeof(r));
+		r.temperature = rand() - RAND_MAX / 2;
+		r.rpm = -rand();
+		r.speed = rand() % 2000 - 1000;
+		r.fuel = (k & 1) ? INT32_MIN : INT32_MAX;
+		r.odometer = (uint32_t)rand() * 3u;
+		r.ignition = (uint8_t)(rand() & 1);
+		r.battery = (k < 3) ? (int32_t)k - 1 : rand() - RAND_MAX / 2;
+		n = VehicleRecordToJson(&r, json, sizeof(json));
+		memset(&d, 0, sizeof(d));
+		if(!n || VehicleRecordFromJson(&d, json, n) || memcmp(&d, &r, sizeof(r)))
+			break;
+		n = VehicleRecordToCbor(&r, cbor, sizeof(cbor));
+		memset(&d, 0, sizeof(d));
+		if(!n || VehicleRecordFromCbor(&d, cbor, n) || memcmp(&d, &r, sizeof(r)))
+			break;
+	}
+	if(k < SCHEMA_TEST_ROUNDS)
+		printf("round trip %u: %s\n", (unsigned)k, json);
+	TEST_CHECK(k == SCHEMA_TEST_ROUNDS);
+}
+//===================================
+
+//===================================
+int main(void)
+{
+	SchemaTestReference();
+	SchemaTestDecoders();
+	SchemaTestRoundTrips();
+	return TestEnd();
+}
+//===================================
@@ -0,0 +1,273 @@
+/**
+*************************************************************************
+*  	@file: JSONStreamTest.c
+*
+*  	@brief: JSON stream parser test
+*  	@brief: Event sequence of JSONStream.c for documents fed at every chunk size and split
+*			at every position, and rejection of malformed documents.
+*
+*	@note	The events are recorded as a trace, one line per event: the event letter, the
+*			current key (stream->key), '=' and the key or value. The trace of a document
+*			must not depend on how it is split.
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "JSONStream.h"
+#include "Test.h"
+//==========================================================================//
+
+//==========================================================================//
+//								Test constants								//
+//==========================================================================//
+#define STREAM_TEST_TRACE		4096		//!< Trace buffer size
+#define D10						"0123456789"
+#define D64						D10 D10 D10 D10 D10 D10 "0123"
+#define K32						D10 D10 D10 "ab"
+//==========================================================================//
+
+//===================================
+/**
+* @brief	Recorded events
+*/
+typedef struct
+{
+	char		text[STREAM_TEST_TRACE];
+	size_t		len;
+	uint8_t		abort;						//!< Event aborting the parsing, or 0
+	uint8_t		bad;						//!< Event data inconsistent with its length
+}StreamTestTrace;
+//===================================
+
+//===================================
+/**
+* @brief	Document and its expected trace
+*/
+typedef struct
+{
+	const char*	doc;
+	const char*	trace;
+}StreamTestFixture;
+//===================================
+
+//===================================
+/**
+* @brief	Malformed document and its expected error
+*/
+typedef struct
+{
+	const char*	doc;
+	int8_t		error;
+}StreamTestMalformed;
+//===================================
+
+//===================================
+static const char letters[] = " OoAaKSNTFZ";
+static const StreamTestFixture fixtures[] =
+{
+	{"{}", "O=\no=\n"},
+	{"[]", "A=\na=\n"},
+	{"42", "N=42\n"},
+	{" true ", "T=true\n"},
+	{"null", "Z=null\n"},
+	{"\"x\"", "S=x\n"},
+	{"-0.5e+3", "N=-0.5e+3\n"},
+	{"{\"Engine Temperature (C)\":65,\"RPM\":5639,\"list\":[1,\"two\",{\"three\":3},[],{}],\"ok\":true,\"no\":false,\"nil\":null}",
+	 "O=\nKEngine Temperature (C)\nNEngine Temperature (C)=65\nKRPM\nNRPM=5639\nKlist\nAlist=\nN=1\nS=two\nO=\nKthree\nNthree=3\no=\n"
+	 "A=\na=\nO=\no=\na=\nKok\nTok=true\nKno\nFno=false\nKnil\nZnil=null\no=\n"},
+	{"{\"e\":\"a\\\"b\\\\c\\/d\\b\\f\\n\\r\\t\",\"u\":\"\\u00e9\\u20AC\\ud83d\\ude00\",\"lone\":\"\\ud800x\",\"low\":\"\\udc00\"}",
+	 "O=\nKe\nSe=a\"b\\c/d\b\f\n\r\t\nKu\nSu=\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\nKlone\nSlone=\xEF\xBF\xBD" "x\nKlow\nSlow=\xEF\xBF\xBD\no=\n"},
+	{" \r\n\t{ \"a\" : [ 1 , 2 ] , \"b\" : { } } \n", "O=\nKa\nAa=\nN=1\nN=2\na=\nKb\nOb=\no=\no=\n"},
+	{"{\"" K32 "\":\"" D10 D10 D10 D10 D10 D10 D10 "\",\"s\":\"" D64 "\"}",
+	 "O=\nK" K32 "\ns" K32 "=" D64 "\nS" K32 "=456789\nKs\nSs=" D64 "\no=\n"},
+};
+static const StreamTestMalformed malformed[] =
+{
+	{"", JSON_STREAM_ERROR_PARTIAL},
+	{"{", JSON_STREAM_ERROR_PARTIAL},
+	{"[1", JSON_STREAM_ERROR_PARTIAL},
+	{"{\"a\":1", JSON_STREAM_ERROR_PARTIAL},
+	{"\"abc", JSON_STREAM_ERROR_PARTIAL},
+	{"{\"a\":}", JSON_STREAM_ERROR_INVALID},
+	{"[1,]", JSON_STREAM_ERROR_INVALID},
+	{"{,}", JSON_STREAM_ERROR_INVALID},
+	{"{\"a\" 1}", JSON_STREAM_ERROR_INVALID},
+	{"{\"a\":1,}", JSON_STREAM_ERROR_INVALID},
+	{"[1 2]", JSON_STREAM_ERROR_INVALID},
+	{"{\"a\":1}}", JSON_STREAM_ERROR_INVALID},
+	{"[}", JSON_STREAM_ERROR_INVALID},
+	{"{\"a\":1]", JSON_STREAM_ERROR_INVALID},
+	{"{1:2}", JSON_STREAM_ERROR_INVALID},
+	{"1 2", JSON_STREAM_ERROR_INVALID},
+	{"tru", JSON_STREAM_ERROR_INVALID},
+	{"[tru]", JSON_STREAM_ERROR_INVALID},
+	{"[01]", JSON_STREAM_ERROR_INVALID},
+	{"[1.]", JSON_STREAM_ERROR_INVALID},
+	{"[-]", JSON_STREAM_ERROR_INVALID},
+	{"[1e]", JSON_STREAM_ERROR_INVALID},
+	{"\"a\\x\"", JSON_STREAM_ERROR_INVALID},
+	{"\"\\u12g4\"", JSON_STREAM_ERROR_INVALID},
+	{"\"a\tb\"", JSON_STREAM_ERROR_INVALID},
+	{"{\"" K32 "c\":1}", JSON_STREAM_ERROR_NOMEM},
+	{"[1" D64 "]", JSON_STREAM_ERROR_NOMEM},
+};
+static char doc[STREAM_TEST_TRACE];
+//===================================
+
+//===================================
+/**
+* @brief				: Record an event, string fragments on their own line ('s')
+*/
+static uint8_t StreamTestCallBack(JsonStream * stream, uint8_t event, const char * data, uint16_t len)
+{
+	StreamTestTrace *t = (StreamTestTrace *)stream->user;
+	int n;
+
+	if((event != JSON_EVENT_STRING) && (strlen(data) != len))
+		t->bad = 1;
+	if((event == JSON_EVENT_STRING) && (len > JSON_STREAM_TOKEN_SIZE))
+		t->bad = 1;
+	if(event == JSON_EVENT_KEY)
+		n = snprintf(&t->text[t->len], sizeof(t->text) - t->len, "K%s\n", data);
+	else
+		n = snprintf(&t->text[t->len], sizeof(t->text) - t->len, "%c%s=%s\n",
+					 ((event == JSON_EVENT_STRING) && stream->more) ? 's' : letters[event], stream->key, data);
+	if((n > 0) && ((size_t)n < (sizeof(t->text) - t->len)))
+		t->len += (size_t)n;
+	return event == t->abort;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Parse a document fed in chunks of chunk bytes, or split once at split if chunk is 0
+* @retval  				: JsonStreamFinish() result
+*/
+static uint8_t StreamTestParse(JsonStream * stream, StreamTestTrace * t, const char * d, uint16_t len, uint16_t chunk, uint16_t split)
+{
+	uint16_t pos = 0, n;
+
+	memset(t, 0, sizeof(StreamTestTrace));
+	JsonStreamInit(stream, StreamTestCallBack, t);
+	while(pos < len)
+	{
+		n = chunk ? chunk : (pos < split) ? split : (uint16_t)(len - pos);
+		if(n > (len - pos))
+			n = (uint16_t)(len - pos);
+		if(JsonStreamFeed(stream, &d[pos], n))
+			break;
+		pos = (uint16_t)(pos + n);
+	}
+	return JsonStreamFinish(stream);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Every fixture at every chunk size and every split position
+*/
+static void StreamTestFixtures(void)
+{
+	StreamTestTrace t;
+	JsonStream stream;
+	uint16_t len, n;
+	uint8_t f, ok;
+
+	for(f = 0; f < (sizeof(fixtures) / sizeof(fixtures[0])); f++)
+	{
+		len = (uint16_t)strlen(fixtures[f].doc);
+		for(n = 0; n <= len; n++)
+		{
+			ok = !StreamTestParse(&stream, &t, fixtures[f].doc, len, n ? n : 1, 0) && !t.bad && !strcmp(t.text, fixtures[f].trace);
+			ok = ok && !StreamTestParse(&stream, &t, fixtures[f].doc, len, 0, n) && !t.bad && !strcmp(t.text, fixtures[f].trace);
+			if(!ok)
+			{
+				printf("fixture %u, chunk/split %u:\n%s", (unsigned)f, (unsigned)n, t.text);
+				break;
+			}
+		}
+		TEST_CHECK(n > len);
+		TEST_CHECK(stream.offset == len);
+	}
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Every malformed document at every chunk size, refused with the expected error
+*/
+static void StreamTestMalformedDocs(void)
+{
+	StreamTestTrace t;
+	JsonStream stream;
+	uint16_t len, n;
+	uint8_t m;
+
+	for(m = 0; m < (sizeof(malformed) / sizeof(malformed[0])); m++)
+	{
+		len = (uint16_t)strlen(malformed[m].doc);
+		for(n = 1; n <= (len ? len : 1); n++)
+		{
+			if(!StreamTestParse(&stream, &t, malformed[m].doc, len, n, 0) || (stream.error != malformed[m].error))
+			{
+				printf("malformed %u \"%s\", chunk %u: error %d\n", (unsigned)m, malformed[m].doc, (unsigned)n, stream.error);
+				break;
+			}
+		}
+		TEST_CHECK(n > (len ? len : 1));
+		TEST_CHECK(JsonStreamFeed(&stream, "1", 1) == 1);			//!< Following chunks refused
+	}
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Nesting limit, call-back abort and the HTTP stream sink
+*/
+static void StreamTestLimits(void)
+{
+	StreamTestTrace t;
+	JsonStream stream;
+	const char *report = fixtures[7].doc;
+	uint16_t len, pos;
+
+	memset(doc, '[', JSON_STREAM_DEPTH);
+	memset(&doc[JSON_STREAM_DEPTH], ']', JSON_STREAM_DEPTH);
+	TEST_CHECK(!StreamTestParse(&stream, &t, doc, 2 * JSON_STREAM_DEPTH, 1, 0));
+	memset(doc, '[', JSON_STREAM_DEPTH + 1);
+	memset(&doc[JSON_STREAM_DEPTH + 1], ']', JSON_STREAM_DEPTH + 1);
+	TEST_CHECK(StreamTestParse(&stream, &t, doc, 2 * JSON_STREAM_DEPTH + 2, 7, 0) && (stream.error == JSON_STREAM_ERROR_NOMEM));
+	//---------
+	len = (uint16_t)strlen(report);
+	memset(&t, 0, sizeof(t));
+	t.abort = JSON_EVENT_KEY;
+	JsonStreamInit(&stream, StreamTestCallBack, &t);
+	TEST_CHECK(JsonStreamFeed(&stream, report, len) && (stream.error == JSON_STREAM_ERROR_ABORTED));
+	TEST_CHECK(!strcmp(t.text, "O=\nKEngine Temperature (C)\n"));
+	//---------
+	memset(&t, 0, sizeof(t));
+	JsonStreamInit(&stream, StreamTestCallBack, &t);
+	JsonStreamSetSink(&stream);
+	for(pos = 0; pos < len; pos = (uint16_t)(pos + 5))
+		TEST_CHECK(JsonStreamSink((const uint8_t *)&report[pos], (uint16_t)(((len - pos) < 5) ? (len - pos) : 5), pos));
+	TEST_CHECK(!JsonStreamFinish(&stream) && !strcmp(t.text, fixtures[7].trace));
+	JsonStreamInit(&stream, StreamTestCallBack, &t);
+	TEST_CHECK(JsonStreamSink((const uint8_t *)report, 5, 0));
+	TEST_CHECK(!JsonStreamSink((const uint8_t *)&report[10], 5, 10));	//!< Gap
+}
+//===================================
+
+//===================================
+int main(void)
+{
+	StreamTestFixtures();
+	StreamTestMalformedDocs();
+	StreamTestLimits();
+	return TestEnd();
+}
+//===================================
@@ -0,0 +1,681 @@
+/**
+*************************************************************************
+*  	@file: PPPTest.c
+*
+*  	@brief: PPP client test
+*  	@brief: SIM800x_PPP.c against a scripted peer playing the network side, the part
+*			pppd would play on a pty pair: HDLC framing and FCS, LCP, PAP, CHAP and IPCP
+*			negotiation, IP datagrams, echo, rejects and link termination.
+*
+*	@note	The peer is driven by the bytes the client sends (See Stubs/SIM800x_SDM.h):
+*			it decodes each frame with its own bit-wise FCS, checks its framing, and
+*			queues its answers for the client to read. It checks that:
+*			- LCP frames are sent uncompressed with every control character escaped
+*			- the other frames follow the negotiated ACCM, PFC and ACFC
+*			Each scenario changes what the peer asks for, refuses or leaves unanswered.
+*
+*	@note	pppd itself is not used: it is not installed on the build hosts, and it
+*			needs root and a pty pair. The peer follows RFC 1661, 1662, 1332, 1334 and
+*			1994 instead, with the CHAP-MD5 response checked against a reference value.
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include "SIM800x_PPP.h"
+#include "SIM800x_SDM.h"
+#include "SIM800x_GPRS.h"
+#include "Test.h"
+//==========================================================================//
+
+//==========================================================================//
+//								Test constants								//
+//==========================================================================//
+#define PEER_FRAME_SIZE			2048		//!< Largest frame, escaped
+#define PEER_PROTO_IP			0x0021
+#define PEER_PROTO_IPCP			0x8021
+#define PEER_PROTO_IPV6CP		0x8057
+#define PEER_PROTO_LCP			0xC021
+#define PEER_PROTO_PAP			0xC023
+#define PEER_PROTO_CHAP			0xC223
+#define PEER_ACCM				0x000A0000UL	//!< XON and XOFF escaped
+#define PEER_MAGIC				0x11223344UL
+#define PEER_CHAP_ID			7
+//==========================================================================//
+
+//===================================
+/**
+* @brief	Scripted peer, scenario then state
+*/
+typedef struct
+{
+	uint16_t	auth;						//!< Authentication asked for: PEER_PROTO_PAP, PEER_PROTO_CHAP or 0
+	uint8_t		drop;						//!< Client LCP requests left unanswered before the first answer
+	uint8_t		silent;						//!< No answer at all
+	uint8_t		refuse;						//!< PAP Authenticate-Nak or CHAP Failure
+	uint8_t		nakmagic;					//!< Magic-Number clash reported once
+	uint8_t		rejaccm;					//!< ACCM option rejected
+	uint8_t		rejdns2;					//!< Secondary DNS option rejected
+	//---------
+	uint8_t		lcpid, ipcpid;				//!< Identifiers of the peer requests
+	uint8_t		lcpopts[32], lcplen;		//!< Options of the last peer LCP request
+	uint8_t		unknownlcp, unknownipcp;	//!< Unknown option still in the peer requests
+	uint8_t		lcpreqs, ipcpreqs, authreqs;//!< Client requests received
+	uint8_t		lastlcpid;					//!< Identifier of the last client LCP request
+	uint32_t	magics[16];					//!< Client magic numbers, per LCP request
+	uint8_t		accm;						//!< ACCM option in the last client LCP request
+	uint8_t		lcpopen;					//!< Both LCP requests acknowledged
+	uint8_t		ipcpopen;					//!< Client IPCP request acknowledged
+	uint8_t		ackedlcp;					//!< Client LCP request acknowledged
+	uint8_t		violations;					//!< Framing violations
+	uint8_t		badfcs;						//!< Frames with a bad FCS
+	uint8_t		terminated;					//!< Terminate-Request received
+	uint8_t		termid;						//!< Its identifier
+	uint8_t		rejcode, rejid;				//!< Last Code-Reject or Protocol-Reject received
+	uint8_t		rej[64];
+	uint16_t	rejlen;
+	uint8_t		echo[16];					//!< Last Echo-Reply data
+	uint16_t	echolen;
+	uint8_t		ip[PEER_FRAME_SIZE];		//!< Last IP datagram received
+	uint16_t	iplen;
+	uint8_t		loop;						//!< IP datagrams sent back
+	//---------
+	uint8_t		frame[PEER_FRAME_SIZE];		//!< Frame being received, unescaped
+	uint16_t	flen;
+	uint8_t		esc;
+	uint32_t	raw;						//!< Control characters received unescaped in the frame
+	uint32_t	escaped;					//!< Control characters received escaped in the frame
+	char		text[64];					//!< Characters received outside frames, ex. "+++"
+	uint16_t	tlen;
+}PPPTestPeer;
+//===================================
+
+//===================================
+static PPPTestPeer peer;
+static SIM800x_APIStatusType datamode = SIM800X_OK;
+static uint8_t received[PEER_FRAME_SIZE];		//!< Last datagram delivered to the client call-back
+static uint16_t receivedlen;
+static uint8_t datagram[PEER_FRAME_SIZE];
+static const uint8_t chapchallenge[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+static const uint8_t chapresponse[16] =			//!< MD5(PEER_CHAP_ID, "secret", chapchallenge), from Python hashlib
+{
+	0x82, 0x16, 0x43, 0x66, 0x5B, 0x43, 0x03, 0x59, 0xE5, 0x2A, 0xC5, 0x24, 0xD2, 0x9C, 0x8F, 0x95
+};
+static const uint8_t peeraddr[4] = {10, 0, 0, 1};
+static const uint8_t clientaddr[4] = {10, 64, 1, 2};
+static const uint8_t dns1[4] = {8, 8, 8, 8};
+static const uint8_t dns2[4] = {8, 8, 4, 4};
+//===================================
+
+//===================================
+/**
+* @brief				: FCS-16 of RFC 1662, bit by bit
+*/
+static uint16_t PeerFcs(uint16_t fcs, const uint8_t * p, uint16_t n)
+{
+	uint8_t i;
+
+	while(n--)
+	{
+		fcs ^= *p++;
+		for(i = 0; i < 8; i++)
+			fcs = (fcs & 1) ? (uint16_t)((fcs >> 1) ^ 0x8408) : (uint16_t)(fcs >> 1);
+	}
+	return fcs;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Send a frame to the client, compressed header if compress, control characters escaped if all
+*/
+static void PeerSendFrame(uint16_t proto, const uint8_t * pkt, uint16_t len, uint8_t compress, uint8_t all, uint8_t corrupt)
+{
+	static uint8_t f[PEER_FRAME_SIZE], out[2 * PEER_FRAME_SIZE + 2];
+	uint16_t k = 0, m = 0, fcs, i;
+
+	if(!compress)
+	{
+		f[k++] = 0xFF;
+		f[k++] = 0x03;
+	}
+	if(!compress || (proto > 0xFF))
+		f[k++] = (uint8_t)(proto >> 8);
+	f[k++] = (uint8_t)proto;
+	memcpy(&f[k], pkt, len);
+	k = (uint16_t)(k + len);
+	fcs = (uint16_t)~PeerFcs(0xFFFF, f, k);
+	f[k++] = (uint8_t)fcs;
+	f[k++] = (uint8_t)(fcs >> 8);
+	if(corrupt)
+		f[k - 3] ^= 0x01;
+	out[m++] = 0x7E;
+	for(i = 0; i < k; i++)
+	{
+		if((f[i] == 0x7E) || (f[i] == 0x7D) || (all && (f[i] < 0x20)) || (f[i] == 'A'))	//!< 'A' escaped for nothing, still valid
+		{
+			out[m++] = 0x7D;
+			out[m++] = f[i] ^ 0x20;
+		}else
+			out[m++] = f[i];
+	}
+	out[m++] = 0x7E;
+	SDMStubReceive(out, m);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Send a control packet to the client, LCP escaping every control character
+*/
+static void PeerSendCP(uint16_t proto, uint8_t code, uint8_t id, const uint8_t * data, uint16_t len)
+{
+	uint8_t p[256];
+
+	p[0] = code;
+	p[1] = id;
+	p[2] = (uint8_t)((len + 4) >> 8);
+	p[3] = (uint8_t)(len + 4);
+	memcpy(&p[4], data, len);
+	PeerSendFrame(proto, p, (uint16_t)(len + 4), 0, proto == PEER_PROTO_LCP, 0);
+}
+//===================================
+
+//===================================
+static void PeerPut32(uint8_t * p, uint32_t v)
+{
+	p[0] = (uint8_t)(v >> 24);
+	p[1] = (uint8_t)(v >> 16);
+	p[2] = (uint8_t)(v >> 8);
+	p[3] = (uint8_t)v;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Peer LCP request, with an unknown option (Callback) until the client rejects it
+*/
+static void PeerLcpRequest(void)
+{
+	uint8_t *o = peer.lcpopts, n = 0;
+
+	if(peer.unknownlcp)
+	{
+		o[n++] = 13;	o[n++] = 3;		o[n++] = 6;
+	}
+	o[n++] = 1;			o[n++] = 4;		o[n++] = 0x05;		o[n++] = 0xDC;
+	o[n++] = 2;			o[n++] = 6;		PeerPut32(&o[n], PEER_ACCM);	n += 4;
+	if(peer.auth)
+	{
+		o[n++] = 3;		o[n++] = (peer.auth == PEER_PROTO_CHAP) ? 5 : 4;
+		o[n++] = (uint8_t)(peer.auth >> 8);		o[n++] = (uint8_t)peer.auth;
+		if(peer.auth == PEER_PROTO_CHAP)
+			o[n++] = 5;
+	}
+	o[n++] = 5;			o[n++] = 6;		PeerPut32(&o[n], PEER_MAGIC);	n += 4;
+	o[n++] = 7;			o[n++] = 2;
+	o[n++] = 8;			o[n++] = 2;
+	peer.lcplen = n;
+	PeerSendCP(PEER_PROTO_LCP, 1, ++peer.lcpid, o, n);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Peer IPCP request, with an unknown option (IP-Compression-Protocol) until the client rejects it
+*/
+static void PeerIpcpRequest(void)
+{
+	uint8_t o[16], n = 0;
+
+	if(peer.unknownipcp)
+	{
+		o[n++] = 2;		o[n++] = 6;		o[n++] = 0x00;	o[n++] = 0x2D;	o[n++] = 0x0F;	o[n++] = 0x01;
+	}
+	o[n++] = 3;			o[n++] = 6;		memcpy(&o[n], peeraddr, 4);		n += 4;
+	PeerSendCP(PEER_PROTO_IPCP, 1, ++peer.ipcpid, o, n);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Client LCP packet
+*/
+static void PeerLcp(uint8_t code, uint8_t id, uint8_t * d, uint16_t len)
+{
+	uint16_t i;
+
+	switch(code)
+	{
+		case 1:																		//!< Configure-Request
+			peer.lastlcpid = id;
+			peer.accm = 0;
+			for(i = 0; (i + 1) < len; i = (uint16_t)(i + d[i + 1]))
+			{
+				if((d[i] == 5) && (d[i + 1] == 6) && (peer.lcpreqs < 16))
+					peer.magics[peer.lcpreqs] = ((uint32_t)d[i + 2] << 24) | ((uint32_t)d[i + 3] << 16) | ((uint32_t)d[i + 4] << 8) | d[i + 5];
+				if((d[i] == 2) && (d[i + 1] == 6))
+				{
+					peer.accm = 1;
+					if(d[i + 2] | d[i + 3] | d[i + 4] | d[i + 5])
+						peer.violations++;
+				}
+				if(d[i + 1] < 2)
+					break;
+			}
+			peer.lcpreqs++;
+			if(peer.silent || (peer.lcpreqs <= peer.drop))
+			{
+				wait(CONFIG_PPP_RESTART_TIME);										//!< Let the client time out
+				return;
+			}
+			if(peer.nakmagic)
+			{
+				peer.nakmagic = 0;
+				PeerSendCP(PEER_PROTO_LCP, 3, id, (const uint8_t *)"\x05\x06\x00\x00\x00\x01", 6);
+				return;
+			}
+			if(peer.rejaccm && peer.accm)
+			{
+				PeerSendCP(PEER_PROTO_LCP, 4, id, (const uint8_t *)"\x02\x06\x00\x00\x00\x00", 6);
+				return;
+			}
+			PeerSendCP(PEER_PROTO_LCP, 2, id, d, len);
+			peer.ackedlcp = 1;
+			if(!peer.lcpid)
+				PeerLcpRequest();
+			break;
+		case 2:																		//!< Configure-Ack
+			if((id != peer.lcpid) || (len != peer.lcplen) || memcmp(d, peer.lcpopts, len) || !peer.ackedlcp)
+			{
+				peer.violations++;
+				return;
+			}
+			peer.lcpopen = 1;
+			if(peer.auth == PEER_PROTO_CHAP)
+			{
+				uint8_t c[1 + sizeof(chapchallenge) + 4];
+
+				c[0] = sizeof(chapchallenge);
+				memcpy(&c[1], chapchallenge, sizeof(chapchallenge));
+				memcpy(&c[1 + sizeof(chapchallenge)], "peer", 4);
+				PeerSendCP(PEER_PROTO_CHAP, 1, PEER_CHAP_ID, c, sizeof(c));
+			}else if(!peer.auth)
+				PeerIpcpRequest();
+			break;
+		case 4:																		//!< Configure-Reject
+			if((id == peer.lcpid) && (len == 3) && !memcmp(d, "\x0D\x03\x06", 3))
+			{
+				peer.unknownlcp = 0;
+				PeerLcpRequest();
+			}else
+				peer.violations++;
+			break;
+		case 5:																		//!< Terminate-Request
+			peer.terminated = 1;
+			peer.termid = id;
+			PeerSendCP(PEER_PROTO_LCP, 6, id, NULL, 0);
+			break;
+		case 7:																		//!< Code-Reject
+		case 8:																		//!< Protocol-Reject
+			peer.rejcode = code;
+			peer.rejid = id;
+			peer.rejlen = (len < sizeof(peer.rej)) ? len : sizeof(peer.rej);
+			memcpy(peer.rej, d, peer.rejlen);
+			break;
+		case 10:																	//!< Echo-Reply
+			peer.echolen = (len < sizeof(peer.echo)) ? len : sizeof(peer.echo);
+			memcpy(peer.echo, d, peer.echolen);
+			break;
+		default:
+			break;
+	}
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Client PAP or CHAP packet
+*/
+static void PeerAuth(uint16_t proto, uint8_t code, uint8_t id, const uint8_t * d, uint16_t len)
+{
+	uint8_t ok;
+
+	peer.authreqs++;
+	if(proto == PEER_PROTO_PAP)
+	{
+		ok = (code == 1) && (len == 12) && !memcmp(d, "\x04" "user" "\x06" "secret", 12);
+		if(!ok)
+			peer.violations++;
+		PeerSendCP(PEER_PROTO_PAP, (ok && !peer.refuse) ? 2 : 3, id, (const uint8_t *)"\x00", 1);
+	}else
+	{
+		ok = (code == 2) && (id == PEER_CHAP_ID) && (len == 21) && (d[0] == 16) && !memcmp(&d[1], chapresponse, 16) &&
+			 !memcmp(&d[17], "user", 4);
+		if(!ok)
+			peer.violations++;
+		PeerSendCP(PEER_PROTO_CHAP, (ok && !peer.refuse) ? 3 : 4, id, NULL, 0);
+	}
+	if(ok && !peer.refuse)
+		PeerIpcpRequest();
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Client IPCP packet
+*/
+static void PeerIpcp(uint8_t code, uint8_t id, uint8_t * d, uint16_t len)
+{
+	static const uint8_t zero[4] = {0, 0, 0, 0};
+	uint8_t nak[18], n = 0, i, assigned;
+	const uint8_t *a;
+
+	switch(code)
+	{
+		case 1:																		//!< Configure-Request
+			peer.ipcpreqs++;
+			for(i = 0, assigned = 1; (i + 5) < len; i = (uint8_t)(i + 6))
+			{
+				if(d[i + 1] != 6)
+				{
+					peer.violations++;
+					return;
+				}
+				if(peer.rejdns2 && (d[i] == 131))
+				{
+					PeerSendCP(PEER_PROTO_IPCP, 4, id, &d[i], 6);
+					return;
+				}
+				a = (d[i] == 3) ? clientaddr : (d[i] == 129) ? dns1 : dns2;
+				nak[n++] = d[i];
+				nak[n++] = 6;
+				memcpy(&nak[n], a, 4);
+				n = (uint8_t)(n + 4);
+				if(memcmp(&d[i + 2], a, 4))
+				{
+					assigned = 0;
+					if(memcmp(&d[i + 2], zero, 4))
+						peer.violations++;											//!< Neither asked nor assigned
+				}
+			}
+			PeerSendCP(PEER_PROTO_IPCP, assigned ? 2 : 3, id, assigned ? d : nak, assigned ? len : n);
+			break;
+		case 2:																		//!< Configure-Ack
+			peer.ipcpopen = (id == peer.ipcpid);
+			break;
+		case 4:																		//!< Configure-Reject
+			if((id == peer.ipcpid) && (len == 6) && (d[0] == 2))
+			{
+				peer.unknownipcp = 0;
+				PeerIpcpRequest();
+			}else
+				peer.violations++;
+			break;
+		default:
+			break;
+	}
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Decode a client frame, check its framing and dispatch it
+*/
+static void PeerFrame(void)
+{
+	uint8_t *f = peer.frame, header;
+	uint16_t len = peer.flen, proto, i = 0, plen;
+
+	if((len < 4) || (PeerFcs(0xFFFF, f, len) != 0xF0B8))
+	{
+		peer.badfcs++;
+		return;
+	}
+	len = (uint16_t)(len - 2);
+	header = (f[0] == 0xFF) && (f[1] == 0x03);
+	if(header)
+		i = 2;
+	proto = f[i++];
+	if(!(proto & 1))
+		proto = (uint16_t)((proto << 8) | f[i++]);
+	if(proto == PEER_PROTO_LCP)
+	{
+		if(!header || (f[2] != 0xC0) || peer.raw)									//!< RFC 1662 section 7.1
+			peer.violations++;
+	}else if(peer.lcpopen)
+	{
+		if(header || (i != ((proto > 0xFF) ? 2 : 1)) || (peer.raw & PEER_ACCM) || (peer.escaped & ~PEER_ACCM))
+			peer.violations++;														//!< ACFC, PFC and ACCM as acknowledged
+	}
+	if(proto == PEER_PROTO_IP)
+	{
+		peer.iplen = (uint16_t)(len - i);
+		memcpy(peer.ip, &f[i], peer.iplen);
+		if(peer.loop)
+			PeerSendFrame(PEER_PROTO_IP, peer.ip, peer.iplen, 1, 0, 0);
+		return;
+	}
+	plen = (uint16_t)((f[i + 2] << 8) | f[i + 3]);
+	if((plen < 4) || (plen > (len - i)))
+	{
+		peer.violations++;
+		return;
+	}
+	if(peer.silent && (proto != PEER_PROTO_LCP))
+		return;
+	switch(proto)
+	{
+		case PEER_PROTO_LCP:	PeerLcp(f[i], f[i + 1], &f[i + 4], (uint16_t)(plen - 4));					break;
+		case PEER_PROTO_PAP:
+		case PEER_PROTO_CHAP:	PeerAuth(proto, f[i], f[i + 1], &f[i + 4], (uint16_t)(plen - 4));			break;
+		case PEER_PROTO_IPCP:	PeerIpcp(f[i], f[i + 1], &f[i + 4], (uint16_t)(plen - 4));					break;
+		default:				peer.violations++;															break;
+	}
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Bytes sent by the client, SDM stub call-back
+*/
+static void PeerInput(const uint8_t * data, uint16_t cnt)
+{
+	uint8_t c;
+
+	while(cnt--)
+	{
+		c = *data++;
+		if(c == 0x7E)
+		{
+			if(peer.flen)
+				PeerFrame();
+			peer.flen = 0;
+			peer.esc = 0;
+			peer.raw = 0;
+			peer.escaped = 0;
+			peer.tlen = 0;
+			continue;
+		}
+		if((peer.tlen + 1u) < sizeof(peer.text))										//!< Text after the last frame
+		{
+			peer.text[peer.tlen++] = (char)c;
+			peer.text[peer.tlen] = '\0';
+		}
+		if(c == 0x7D)
+		{
+			peer.esc = 1;
+			continue;
+		}
+		if(peer.esc)
+		{
+			c ^= 0x20;
+			peer.esc = 0;
+			if(c < 0x20)
+				peer.escaped |= 1UL << c;
+		}else if(c < 0x20)
+			peer.raw |= 1UL << c;
+		if(peer.flen < sizeof(peer.frame))
+			peer.frame[peer.flen++] = c;
+	}
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Data mode, AT+CGDATA on the target
+*/
+SIM800x_APIStatusType SIM800xGPRSSetDataMode(uint8_t cid, uint16_t* errcode)
+{
+	*errcode = 0;
+	return datamode;
+}
+//===================================
+
+//===================================
+static void PeerDeliver(const uint8_t * pkt, uint16_t len)
+{
+	memcpy(received, pkt, len);
+	receivedlen = len;
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Start a scenario
+*/
+static void PeerReset(uint16_t auth)
+{
+	memset(&peer, 0, sizeof(peer));
+	peer.auth = auth;
+	peer.unknownlcp = 1;
+	peer.unknownipcp = 1;
+	peer.loop = 1;
+	receivedlen = 0;
+	SIM800xSDMFlush();
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Link up with PAP, then datagrams, echo, rejects and termination
+*/
+static void PPPTestPap(void)
+{
+	uint8_t ip[4], d1[4], d2[4], rejid;
+	uint16_t e, i;
+
+	PeerReset(PEER_PROTO_PAP);
+	TEST_CHECK(SIM800xPPPSend(datagram, 20) == SIM800X_ERROR);					//!< Link down
+	TEST_CHECK(SIM800xPPPOpen(1, "user", "secret", 10000, &e) == SIM800X_OK);
+	TEST_CHECK((SIM800xPPPGetPhase() == PPP_RUNNING) && peer.lcpopen && peer.ipcpopen);
+	TEST_CHECK((peer.lcpreqs == 1) && (peer.authreqs == 1) && (peer.ipcpreqs == 2) && !peer.violations && !peer.badfcs);
+	TEST_CHECK(!SIM800xPPPGetAddress(ip, d1, d2) && !memcmp(ip, clientaddr, 4) && !memcmp(d1, dns1, 4) && !memcmp(d2, dns2, 4));
+	//---------
+	for(i = 0; i < 256; i++)														//!< Every byte value, through the peer and back
+		datagram[i] = (uint8_t)i;
+	TEST_CHECK(SIM800xPPPSend(datagram, 256) == SIM800X_OK);
+	TEST_CHECK((peer.iplen == 256) && !memcmp(peer.ip, datagram, 256) && !peer.violations);
+	TEST_CHECK((SIM800xPPPPoll() == PPP_RUNNING) && (receivedlen == 256) && !memcmp(received, datagram, 256));
+	TEST_CHECK(SIM800xPPPSend(datagram, CONFIG_PPP_MRU + 1) == SIM800X_ERROR);	//!< Larger than the peer MRU
+	receivedlen = 0;
+	PeerSendFrame(PEER_PROTO_IP, datagram, 40, 1, 0, 1);							//!< Bad FCS
+	PeerSendFrame(PEER_PROTO_IP, datagram, CONFIG_PPP_MRU + 16, 1, 0, 0);		//!< Larger than the client MRU
+	SIM800xPPPPoll();
+	TEST_CHECK(receivedlen == 0);
+	PeerSendFrame(PEER_PROTO_IP, datagram, 41, 0, 1, 0);							//!< Uncompressed, all escaped
+	SIM800xPPPPoll();
+	TEST_CHECK((receivedlen == 41) && !memcmp(received, datagram, 41));
+	//---------
+	PeerSendCP(PEER_PROTO_LCP, 9, 0x42, (const uint8_t *)"\x11\x22\x33\x44" "ping", 8);	//!< Echo-Request
+	SIM800xPPPPoll();
+	TEST_CHECK((peer.echolen == 8) && !memcmp(&peer.echo[4], "ping", 4));
+	TEST_CHECK(((uint32_t)peer.echo[0] << 24 | (uint32_t)peer.echo[1] << 16 | (uint32_t)peer.echo[2] << 8 | peer.echo[3]) == peer.magics[0]);
+	PeerSendCP(PEER_PROTO_LCP, 0x20, 0x43, (const uint8_t *)"xy", 2);				//!< Unknown code
+	SIM800xPPPPoll();
+	TEST_CHECK((peer.rejcode == 7) && (peer.rejlen == 6) && (peer.rej[0] == 0x20) && (peer.rej[1] == 0x43));
+	rejid = peer.rejid;
+	PeerSendCP(PEER_PROTO_IPV6CP, 1, 0x44, (const uint8_t *)"\x01\x0A" "abcdefgh", 10);	//!< Unknown protocol
+	SIM800xPPPPoll();
+	TEST_CHECK((peer.rejcode == 8) && (peer.rejid != rejid) && (peer.rejlen == 16) && (peer.rej[0] == 0x80) && (peer.rej[1] == 0x57));
+	TEST_CHECK((SIM800xPPPGetPhase() == PPP_RUNNING) && !peer.violations);
+	//---------
+	TEST_CHECK((SIM800xPPPClose() == SIM800X_OK) && peer.terminated && (SIM800xPPPGetPhase() == PPP_DEAD));
+	TEST_CHECK(peer.termid == (uint8_t)(peer.lastlcpid + 1));						//!< Rejects kept out of the request identifiers
+	TEST_CHECK(!strcmp(peer.text, "+++ATH\r\n"));
+	TEST_CHECK(SIM800xPPPGetAddress(ip, d1, d2) == SIM800X_ERROR);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: Link up with CHAP-MD5, after a magic number clash and a rejected secondary DNS
+*/
+static void PPPTestChap(void)
+{
+	uint8_t ip[4], d1[4], d2[4] = {1, 1, 1, 1};
+	uint16_t e;
+
+	PeerReset(PEER_PROTO_CHAP);
+	peer.nakmagic = 1;
+	peer.rejdns2 = 1;
+	TEST_CHECK(SIM800xPPPOpen(2, "user", "secret", 10000, &e) == SIM800X_OK);
+	TEST_CHECK((peer.lcpreqs == 2) && (peer.magics[0] != peer.magics[1]) && (peer.authreqs == 1) && !peer.violations);
+	TEST_CHECK((peer.ipcpreqs == 3) && !SIM800xPPPGetAddress(ip, d1, d2) && !memcmp(ip, clientaddr, 4) && !memcmp(d1, dns1, 4));
+	TEST_CHECK(!memcmp(d2, "\0\0\0\0", 4));
+	TEST_CHECK(SIM800xPPPClose() == SIM800X_OK);
+}
+//===================================
+
+//===================================
+/**
+* @brief				: No authentication, lost and rejected requests, and failures
+*/
+static void PPPTestFailures(void)
+{
+	uint16_t e;
+
+	PeerReset(0);
+	peer.drop = 2;
+	peer.rejaccm = 1;
+	TEST_CHECK(SIM800xPPPOpen(1, NULL, NULL, 60000, &e) == SIM800X_OK);		//!< Retransmitted after the restart time
+	TEST_CHECK((peer.lcpreqs == 4) && !peer.accm && (peer.lastlcpid == 4) && !peer.authreqs && !peer.violations);
+	TEST_CHECK(SIM800xPPPClose() == SIM800X_OK);
+	//---------
+	PeerReset(PEER_PROTO_PAP);
+	peer.refuse = 1;
+	TEST_CHECK(SIM800xPPPOpen(1, "user", "secret", 10000, &e) == SIM800X_ERROR);
+	TEST_CHECK((peer.authreqs == 1) && (SIM800xPPPGetPhase() == PPP_DEAD) && !strcmp(peer.text, "+++ATH\r\n"));
+	PeerReset(PEER_PROTO_CHAP);
+	peer.refuse = 1;
+	TEST_CHECK(SIM800xPPPOpen(1, "user", "secret", 10000, &e) == SIM800X_ERROR);
+	TEST_CHECK(peer.authreqs == 1);
+	PeerReset(PEER_PROTO_CHAP);
+	TEST_CHECK(SIM800xPPPOpen(1, "user", "wrong", 10000, &e) == SIM800X_ERROR);	//!< Wrong response
+	PeerReset(PEER_PROTO_PAP);
+	peer.silent = 1;
+	TEST_CHECK(SIM800xPPPOpen(1, "user", "secret", 600000, &e) == SIM800X_ERROR);
+	TEST_CHECK((peer.lcpreqs == CONFIG_PPP_MAX_CONFIGURE) && !peer.violations);
+	//---------
+	PeerReset(PEER_PROTO_PAP);
+	datamode = SIM800X_CME_ERROR;
+	TEST_CHECK((SIM800xPPPOpen(1, "user", "secret", 10000, &e) == SIM800X_CME_ERROR) && !peer.lcpreqs);
+	datamode = SIM800X_OK;
+}
+//===================================
+
+//===================================
+int main(void)
+{
+	SDMStubSetSend(PeerInput);
+	SIM800xPPPSetInputCallBack(PeerDeliver);
+	PPPTestPap();
+	PPPTestChap();
+	PPPTestFailures();
+	return TestEnd();
+}
+//===================================
@@ -0,0 +1,64 @@
+/**
+*************************************************************************
+*  	@file: Test.h
+*
+*  	@brief: Header file for the host test harness
+*  	@brief: This file provide the check helpers shared by the host tests.
+*
+*	@note	The tests build the driver sources with the host compiler (See ../Makefile):
+*			- make test, from the Host directory
+*			Each test program exits with a failure status when a check fails, after
+*			printing the failed checks.
+*
+*	@note 	history:
+*				- Initial release   : October 18, 2026
+*************************************************************************
+*/
+
+#ifndef __TEST_H
+#define __TEST_H
+
+//==========================================================================//
+//								Includes									//
+//==========================================================================//
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+//==========================================================================//
+
+//===================================
+static uint32_t testchecks;					//!< Number of checks
+static uint32_t testfailures;				//!< Number of failed checks
+//===================================
+
+//===================================
+/**
+* @brief				: Check a condition, printing it when it fails
+* @param	cond		: Condition expected to hold
+*/
+#define TEST_CHECK(cond)															\
+	do																				\
+	{																				\
+		testchecks++;																\
+		if(!(cond))																	\
+		{																			\
+			testfailures++;															\
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);		\
+		}																			\
+	}while(0)
+//===================================
+
+//===================================
+/**
+* @brief				: Print the test summary
+* @retval  				: Exit status of the test program
+*/
+static inline int TestEnd(void)
+{
+	printf("%u checks, %u failed\n", (unsigned)testchecks, (unsigned)testfailures);
+	return testfailures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+//===================================
+
+#endif	/* __TEST_H */